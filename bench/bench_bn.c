@@ -281,7 +281,7 @@ static void util(void) {
 }
 
 static void arith(void) {
-	bn_t a, b, c, d, e;
+	bn_t a, b, c, d, e, x[64], y[64];
 	dig_t f;
 	int len;
 
@@ -290,12 +290,20 @@ static void arith(void) {
 	bn_null(c);
 	bn_null(d);
 	bn_null(e);
+	for (int i = 0; i < 64; i++) {
+		bn_null(x[i]);
+		bn_null(y[i]);
+	}
 
 	bn_new(a);
 	bn_new(b);
 	bn_new(c);
 	bn_new(d);
 	bn_new(e);
+	for (int i = 0; i < 64; i++) {
+		bn_new(x[i]);
+		bn_new(y[i]);
+	}
 
 	BENCH_BEGIN("bn_add") {
 		bn_rand(a, RLC_POS, RLC_BN_BITS);
@@ -662,6 +670,42 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	for (int i = 0; i < 64; i++) {
+		bn_rand(x[i], RLC_POS, RLC_BN_BITS);
+		bn_mod(x[i], x[i], b);
+		bn_rand(y[i], RLC_POS, RLC_BN_BITS);
+	}
+
+	BENCH_BEGIN("bn_mxp (4 times)") {
+		BENCH_ADD(for (int j = 0; j < 4; j++) bn_mxp(c, x[j], y[j], b));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("bn_mxp_sim (4)") {
+		BENCH_ADD(bn_mxp_sim(c, (const bn_t *)x, (const bn_t *)y, 4, b));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("bn_mxp_sim_const (4)") {
+		BENCH_ADD(bn_mxp_sim_const(c, (const bn_t *)x, (const bn_t *)y, 4,
+						b));
+	}
+	BENCH_END;
+
+	for (int i = 0; i < 64; i++) {
+		bn_rand(y[i], RLC_POS, RLC_DIG);
+	}
+
+	BENCH_BEGIN("bn_mxp (64 times)") {
+		BENCH_ADD(for (int j = 0; j < 64; j++) bn_mxp(c, x[j], y[j], b));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("bn_mxp_sim (64)") {
+		BENCH_ADD(bn_mxp_sim(c, (const bn_t *)x, (const bn_t *)y, 64, b));
+	}
+	BENCH_END;
+
 	BENCH_BEGIN("bn_srt") {
 		bn_rand(a, RLC_POS, RLC_BN_BITS);
 		BENCH_ADD(bn_srt(b, a));
@@ -915,6 +959,10 @@ static void arith(void) {
 	bn_free(c);
 	bn_free(d);
 	bn_free(e);
+	for (int i = 0; i < 64; i++) {
+		bn_free(x[i]);
+		bn_free(y[i]);
+	}
 }
 
 int main(void) {
@@ -235,38 +235,91 @@ static void benaloh(void) {
 }
 
 static void paillier(void) {
-	bn_t n, l;
+	phpe_t pub, prv;
+	phpe_pool_t pool;
+	bn_t c, e[16], k[16];
 	uint8_t in[1000], new[1000], out[RLC_BN_BITS / 8 + 1];
 	int in_len, out_len;
 
-	bn_null(n);
-	bn_null(l);
+	phpe_null(pub);
+	phpe_null(prv);
+	phpe_pool_null(pool);
+	bn_null(c);
+	for (int i = 0; i < 16; i++) {
+		bn_null(e[i]);
+		bn_null(k[i]);
+	}
 
-	bn_new(n);
-	bn_new(l);
+	phpe_new(pub);
+	phpe_new(prv);
+	phpe_pool_new(pool, BENCH + 1);
+	bn_new(c);
+	for (int i = 0; i < 16; i++) {
+		bn_new(e[i]);
+		bn_new(k[i]);
+	}
 
-	BENCH_ONCE("cp_phpe_gen", cp_phpe_gen(n, l, RLC_BN_BITS / 2));
+	BENCH_ONCE("cp_phpe_gen", cp_phpe_gen(pub, prv, RLC_BN_BITS / 2));
 
 	BENCH_BEGIN("cp_phpe_enc") {
-		in_len = bn_size_bin(n);
+		in_len = bn_size_bin(pub->n);
+		out_len = RLC_BN_BITS / 8 + 1;
+		memset(in, 0, sizeof(in));
+		rand_bytes(in + 1, in_len - 1);
+		BENCH_ADD(cp_phpe_enc(out, &out_len, in, in_len, pub));
+		cp_phpe_dec(new, in_len, out, out_len, prv);
+	} BENCH_END;
+
+	BENCH_ONCE("cp_phpe_pre", cp_phpe_pre(pool, pub));
+
+	BENCH_BEGIN("cp_phpe_enc_pre") {
+		in_len = bn_size_bin(pub->n);
 		out_len = RLC_BN_BITS / 8 + 1;
 		memset(in, 0, sizeof(in));
 		rand_bytes(in + 1, in_len - 1);
-		BENCH_ADD(cp_phpe_enc(out, &out_len, in, in_len, n));
-		cp_phpe_dec(new, in_len, out, out_len, n, l);
+		cp_phpe_pre(pool, pub);
+		BENCH_ADD(cp_phpe_enc_pre(out, &out_len, in, in_len, pub, pool));
 	} BENCH_END;
 
 	BENCH_BEGIN("cp_phpe_dec") {
-		in_len = bn_size_bin(n);
+		in_len = bn_size_bin(pub->n);
 		out_len = RLC_BN_BITS / 8 + 1;
 		memset(in, 0, sizeof(in));
 		rand_bytes(in + 1, in_len - 1);
-		cp_phpe_enc(out, &out_len, in, in_len, n);
-		BENCH_ADD(cp_phpe_dec(new, in_len, out, out_len, n, l));
+		cp_phpe_enc(out, &out_len, in, in_len, pub);
+		BENCH_ADD(cp_phpe_dec(new, in_len, out, out_len, prv));
 	} BENCH_END;
 
-	bn_free(n);
-	bn_free(l);
+	in_len = bn_size_bin(pub->n);
+	for (int i = 0; i < 16; i++) {
+		out_len = RLC_BN_BITS / 8 + 1;
+		memset(in, 0, sizeof(in));
+		rand_bytes(in + 1, in_len - 1);
+		cp_phpe_enc(out, &out_len, in, in_len, pub);
+		bn_read_bin(e[i], out, out_len);
+		bn_rand_mod(k[i], pub->n);
+	}
+
+	BENCH_BEGIN("cp_phpe_add_vec (16)") {
+		BENCH_ADD(cp_phpe_add_vec(c, e, 16, pub));
+	} BENCH_END;
+
+	BENCH_BEGIN("cp_phpe_scal_vec (16)") {
+		BENCH_ADD(cp_phpe_scal_vec(e, e, k, 16, pub));
+	} BENCH_END;
+
+	BENCH_BEGIN("cp_phpe_ip (16)") {
+		BENCH_ADD(cp_phpe_ip(c, e, k, 16, pub));
+	} BENCH_END;
+
+	phpe_free(pub);
+	phpe_free(prv);
+	phpe_pool_free(pool);
+	bn_free(c);
+	for (int i = 0; i < 16; i++) {
+		bn_free(e[i]);
+		bn_free(k[i]);
+	}
 }
 
 #endif
@@ -294,6 +347,20 @@ static void ecdh(void) {
 	}
 	BENCH_END;
 
+	if (fp_param_get() == PRIME_25519) {
+		uint8_t k[32], q[32], z[32];
+
+		BENCH_BEGIN("cp_x25519_gen") {
+			BENCH_ADD(cp_x25519_gen(k, q));
+		}
+		BENCH_END;
+
+		BENCH_BEGIN("cp_x25519_key") {
+			BENCH_ADD(cp_x25519_key(z, k, q));
+		}
+		BENCH_END;
+	}
+
 	bn_free(d);
 	ec_free(p);
 }
@@ -376,17 +443,23 @@ static void ecies(void) {
 static void ecdsa(void) {
 	uint8_t msg[5] = { 0, 1, 2, 3, 4 }, h[RLC_MD_LEN];
 	bn_t r, s, d;
-	ec_t p;
+	ec_t p, t[RLC_EC_TABLE];
 
 	bn_null(r);
 	bn_null(s);
 	bn_null(d);
 	ec_null(p);
+	for (int i = 0; i < RLC_EC_TABLE; i++) {
+		ec_null(t[i]);
+	}
 
 	bn_new(r);
 	bn_new(s);
 	bn_new(d);
 	ec_new(p);
+	for (int i = 0; i < RLC_EC_TABLE; i++) {
+		ec_new(t[i]);
+	}
 
 	BENCH_BEGIN("cp_ecdsa_gen") {
 		BENCH_ADD(cp_ecdsa_gen(d, p));
@@ -415,26 +488,47 @@ static void ecdsa(void) {
 	}
 	BENCH_END;
 
+	ec_mul_pre(t, p);
+	BENCH_BEGIN("cp_ecdsa_ver_pre (h = 0)") {
+		BENCH_ADD(cp_ecdsa_ver_pre(r, s, msg, 5, 0, (const ec_t *)t));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("cp_ecdsa_ver_pre (h = 1)") {
+		md_map(h, msg, 5);
+		BENCH_ADD(cp_ecdsa_ver_pre(r, s, h, RLC_MD_LEN, 1, (const ec_t *)t));
+	}
+	BENCH_END;
+
 	bn_free(r);
 	bn_free(s);
 	bn_free(d);
 	ec_free(p);
+	for (int i = 0; i < RLC_EC_TABLE; i++) {
+		ec_free(t[i]);
+	}
 }
 
 static void ecss(void) {
 	uint8_t msg[5] = { 0, 1, 2, 3, 4 };
 	bn_t r, s, d;
-	ec_t p;
+	ec_t p, t[RLC_EC_TABLE];
 
 	bn_null(r);
 	bn_null(s);
 	bn_null(d);
 	ec_null(p);
+	for (int i = 0; i < RLC_EC_TABLE; i++) {
+		ec_null(t[i]);
+	}
 
 	bn_new(r);
 	bn_new(s);
 	bn_new(d);
 	ec_new(p);
+	for (int i = 0; i < RLC_EC_TABLE; i++) {
+		ec_new(t[i]);
+	}
 
 	BENCH_BEGIN("cp_ecss_gen") {
 		BENCH_ADD(cp_ecss_gen(d, p));
@@ -451,10 +545,19 @@ static void ecss(void) {
 	}
 	BENCH_END;
 
+	ec_mul_pre(t, p);
+	BENCH_BEGIN("cp_ecss_ver_pre") {
+		BENCH_ADD(cp_ecss_ver_pre(r, s, msg, 5, (const ec_t *)t));
+	}
+	BENCH_END;
+
 	bn_free(r);
 	bn_free(s);
 	bn_free(d);
 	ec_free(p);
+	for (int i = 0; i < RLC_EC_TABLE; i++) {
+		ec_free(t[i]);
+	}
 }
 
 static void vbnn(void) {
@@ -465,7 +568,7 @@ static void vbnn(void) {
 
 	uint8_t m[] = "Thrice the brinded cat hath mew'd.";
 
-	ec_t r;
+	ec_t r, t[RLC_EC_TABLE];
 	bn_t z;
 	bn_t h;
 
@@ -478,6 +581,9 @@ static void vbnn(void) {
 	ec_null(mpk);
 	bn_null(pka);
 	bn_null(pkb);
+	for (int i = 0; i < RLC_EC_TABLE; i++) {
+		ec_null(t[i]);
+	}
 
 	bn_new(z);
 	bn_new(h);
@@ -488,6 +594,9 @@ static void vbnn(void) {
 	ec_new(mpk);
 	ec_new(pka);
 	ec_new(pkb);
+	for (int i = 0; i < RLC_EC_TABLE; i++) {
+		ec_new(t[i]);
+	}
 
 	BENCH_BEGIN("cp_vbnn_gen") {
 		BENCH_ADD(cp_vbnn_gen(msk, mpk));
@@ -511,6 +620,13 @@ static void vbnn(void) {
 	}
 	BENCH_END;
 
+	ec_mul_pre(t, mpk);
+	BENCH_BEGIN("cp_vbnn_ver_pre") {
+		BENCH_ADD(cp_vbnn_ver_pre(r, z, h, ida, sizeof(ida), m, sizeof(m),
+			(const ec_t *)t));
+	}
+	BENCH_END;
+
 	bn_free(h);
 	bn_free(msk);
 	bn_free(ska);
@@ -519,23 +635,86 @@ static void vbnn(void) {
 	ec_free(mpk);
 	ec_free(pka);
 	ec_free(pkb);
+	for (int i = 0; i < RLC_EC_TABLE; i++) {
+		ec_free(t[i]);
+	}
 }
 
 #endif /* WITH_EC */
 
+#if defined(WITH_ED)
+
+/* Number of signatures verified in a batch. */
+#define EDDSA_N		16
+
+static void eddsa(void) {
+	uint8_t k[RLC_FP_BYTES], m[EDDSA_N][5], *ms[EDDSA_N];
+	int i, ls[EDDSA_N];
+	bn_t s[EDDSA_N];
+	ed_t q[EDDSA_N], r[EDDSA_N];
+
+	for (i = 0; i < EDDSA_N; i++) {
+		bn_null(s[i]);
+		ed_null(q[i]);
+		ed_null(r[i]);
+		bn_new(s[i]);
+		ed_new(q[i]);
+		ed_new(r[i]);
+		rand_bytes(m[i], sizeof(m[i]));
+		ms[i] = m[i];
+		ls[i] = sizeof(m[i]);
+	}
+
+	BENCH_BEGIN("cp_eddsa_gen") {
+		BENCH_ADD(cp_eddsa_gen(k, q[0]));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("cp_eddsa_sig") {
+		BENCH_ADD(cp_eddsa_sig(r[0], s[0], m[0], sizeof(m[0]), k, q[0]));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("cp_eddsa_ver") {
+		BENCH_ADD(cp_eddsa_ver(r[0], s[0], m[0], sizeof(m[0]), q[0]));
+	}
+	BENCH_END;
+
+	for (i = 0; i < EDDSA_N; i++) {
+		cp_eddsa_gen(k, q[i]);
+		cp_eddsa_sig(r[i], s[i], m[i], sizeof(m[i]), k, q[i]);
+	}
+
+	BENCH_BEGIN("cp_eddsa_ver_sim (per sig)") {
+		BENCH_ADD(cp_eddsa_ver_sim(r, s, ms, ls, q, EDDSA_N));
+	}
+	BENCH_DIV(EDDSA_N);
+
+	for (i = 0; i < EDDSA_N; i++) {
+		bn_free(s[i]);
+		ed_free(q[i]);
+		ed_free(r[i]);
+	}
+}
+
+#endif /* WITH_ED */
+
 #if defined(WITH_PC)
 
 static void sokaka(void) {
 	sokaka_t k;
 	bn_t s;
+	idc_t c;
 	uint8_t key1[RLC_MD_LEN];
 	char id_a[5] = { 'A', 'l', 'i', 'c', 'e' };
 	char id_b[3] = { 'B', 'o', 'b' };
 
 	sokaka_null(k);
+	idc_null(c);
 
 	sokaka_new(k);
 	bn_new(s);
+	idc_new(c, 16);
 
 	BENCH_BEGIN("cp_sokaka_gen") {
 		BENCH_ADD(cp_sokaka_gen(s));
@@ -553,6 +732,12 @@ static void sokaka(void) {
 	}
 	BENCH_END;
 
+	BENCH_BEGIN("cp_sokaka_key_pre (g1)") {
+		BENCH_ADD(cp_sokaka_key_pre(key1, RLC_MD_LEN, id_b, sizeof(id_b), k,
+						id_a, sizeof(id_a), c));
+	}
+	BENCH_END;
+
 	if (pc_map_is_type3()) {
 		cp_sokaka_gen_prv(k, id_a, sizeof(id_a), s);
 
@@ -565,6 +750,7 @@ static void sokaka(void) {
 
 	sokaka_free(k);
 	bn_free(s);
+	idc_free(c);
 }
 
 static void ibe(void) {
@@ -574,14 +760,17 @@ static void ibe(void) {
 	uint8_t in[10], out[10 + 2 * RLC_FP_BYTES + 1];
 	char id[5] = { 'A', 'l', 'i', 'c', 'e' };
 	int in_len, out_len;
+	idc_t c;
 
 	bn_null(s);
 	g1_null(pub);
 	g2_null(prv);
+	idc_null(c);
 
 	bn_new(s);
 	g1_new(pub);
 	g2_new(prv);
+	idc_new(c, 16);
 
 	rand_bytes(in, sizeof(in));
 
@@ -604,6 +793,16 @@ static void ibe(void) {
 	}
 	BENCH_END;
 
+	BENCH_BEGIN("cp_ibe_enc_pre") {
+		in_len = sizeof(in);
+		out_len = in_len + 2 * RLC_FP_BYTES + 1;
+		rand_bytes(in, sizeof(in));
+		BENCH_ADD(cp_ibe_enc_pre(out, &out_len, in, in_len, id, sizeof(id),
+				pub, c));
+		cp_ibe_dec(out, &out_len, out, out_len, prv);
+	}
+	BENCH_END;
+
 	BENCH_BEGIN("cp_ibe_dec") {
 		in_len = sizeof(in);
 		out_len = in_len + 2 * RLC_FP_BYTES + 1;
@@ -616,6 +815,7 @@ static void ibe(void) {
 	bn_free(s);
 	g1_free(pub);
 	g2_free(prv);
+	idc_free(c);
 }
 
 static void bgn(void) {
@@ -623,6 +823,8 @@ static void bgn(void) {
 	g2_t d[2];
 	gt_t e[4];
 	bgn_t pub, prv;
+	pc_dlog_t t1, t2, tt;
+	bgn_pool_t pool;
 	dig_t in;
 
 	g1_null(c[0]);
@@ -631,6 +833,10 @@ static void bgn(void) {
 	g2_null(d[1]);
 	bgn_null(pub);
 	bgn_null(prv);
+	pc_dlog_null(t1);
+	pc_dlog_null(t2);
+	pc_dlog_null(tt);
+	bgn_pool_null(pool);
 
 	g1_new(c[0]);
 	g1_new(c[1]);
@@ -638,6 +844,10 @@ static void bgn(void) {
 	g2_new(d[1]);
 	bgn_new(pub);
 	bgn_new(prv);
+	pc_dlog_new(t1, 1024);
+	pc_dlog_new(t2, 1024);
+	pc_dlog_new(tt, 1024);
+	bgn_pool_new(pool, BENCH + 1);
 	for (int i = 0; i < 4; i++) {
 		gt_null(e[i]);
 		gt_new(e[i]);
@@ -647,6 +857,10 @@ static void bgn(void) {
 		BENCH_ADD(cp_bgn_gen(pub, prv));
 	} BENCH_END;
 
+	BENCH_SMALL("cp_bgn_tab1 (1024)", cp_bgn_tab1(t1, prv));
+	BENCH_SMALL("cp_bgn_tab2 (1024)", cp_bgn_tab2(t2, prv));
+	BENCH_SMALL("cp_bgn_tab (1024)", cp_bgn_tab(tt, prv));
+
 	in = 10;
 
 	BENCH_BEGIN("cp_bgn_enc1") {
@@ -654,6 +868,13 @@ static void bgn(void) {
 		cp_bgn_dec1(&in, c, prv);
 	} BENCH_END;
 
+	BENCH_ONCE("cp_bgn_pre", cp_bgn_pre(pool, pub));
+
+	BENCH_BEGIN("cp_bgn_enc1_pre") {
+		cp_bgn_pre(pool, pub);
+		BENCH_ADD(cp_bgn_enc1_pre(c, in, pub, pool));
+	} BENCH_END;
+
 	BENCH_BEGIN("cp_bgn_dec1 (10)") {
 		cp_bgn_enc1(c, in, pub);
 		BENCH_ADD(cp_bgn_dec1(&in, c, prv));
@@ -664,6 +885,11 @@ static void bgn(void) {
 		cp_bgn_dec2(&in, d, prv);
 	} BENCH_END;
 
+	BENCH_BEGIN("cp_bgn_enc2_pre") {
+		cp_bgn_pre(pool, pub);
+		BENCH_ADD(cp_bgn_enc2_pre(d, in, pub, pool));
+	} BENCH_END;
+
 	BENCH_BEGIN("cp_bgn_dec2 (10)") {
 		cp_bgn_enc2(d, in, pub);
 		BENCH_ADD(cp_bgn_dec2(&in, d, prv));
@@ -677,6 +903,17 @@ static void bgn(void) {
 		BENCH_ADD(cp_bgn_dec(&in, e, prv));
 	} BENCH_END;
 
+	BENCH_SMALL("cp_bgn_dec_tab (100)",
+			cp_bgn_dec_tab(&in, e, prv, tt, 1 << 20));
+
+	in = 1000000;
+	cp_bgn_enc1(c, in, pub);
+	BENCH_SMALL("cp_bgn_dec1_tab (10^6)",
+			cp_bgn_dec1_tab(&in, c, prv, t1, 1 << 20));
+	cp_bgn_enc2(d, in, pub);
+	BENCH_SMALL("cp_bgn_dec2_tab (10^6)",
+			cp_bgn_dec2_tab(&in, d, prv, t2, 1 << 20));
+
 	BENCH_BEGIN("cp_bgn_add") {
 		BENCH_ADD(cp_bgn_add(e, e, e));
 	} BENCH_END;
@@ -687,6 +924,10 @@ static void bgn(void) {
 	g2_free(d[1]);
 	bgn_free(pub);
 	bgn_free(prv);
+	pc_dlog_free(t1);
+	pc_dlog_free(t2);
+	pc_dlog_free(tt);
+	bgn_pool_free(pool);
 	for (int i = 0; i < 4; i++) {
 		gt_free(e[i]);
 	}
@@ -775,14 +1016,18 @@ static void bbs(void) {
 	g2_free(p);
 }
 
+/* Numbers of attributes in the credential benchmarks, the largest last. */
+static const int attrs[] = { 5, 10, 20, 50 };
+#define ATTRS		50
+
 static int cls(void) {
-	int i, code = RLC_ERR;
-	bn_t r, t, u, v, _v[4];
-	g1_t a, A, b, B, c, _A[4], _B[4];
-	g2_t x, y, z, _z[4];
+	int i, n, code = RLC_ERR;
+	bn_t r, t, u, v, _v[ATTRS - 1];
+	g1_t a, A, b, B, c, _A[ATTRS - 1], _B[ATTRS - 1];
+	g2_t x, y, z, _z[ATTRS - 1];
 	uint8_t m[5] = { 0, 1, 2, 3, 4 };
-	uint8_t *msgs[5] = {m, m, m, m, m};
-	int lens[5] = {sizeof(m), sizeof(m), sizeof(m), sizeof(m), sizeof(m)};
+	uint8_t *msgs[ATTRS];
+	int lens[ATTRS];
 
 	bn_null(r);
 	bn_null(t);
@@ -796,7 +1041,7 @@ static int cls(void) {
 	g2_null(x);
 	g2_null(y);
 	g2_null(z);
-	for (i = 0; i < 4; i++) {
+	for (i = 0; i < ATTRS - 1; i++) {
 		bn_null(_v[i]);
 		g1_null(_A[i]);
 		g1_null(_B[i]);
@@ -815,12 +1060,16 @@ static int cls(void) {
 	g2_new(x);
 	g2_new(y);
 	g2_new(z);
-	for (i = 0; i < 4; i++) {
+	for (i = 0; i < ATTRS - 1; i++) {
 		bn_new(_v[i]);
 		g1_new(_A[i]);
 		g1_new(_B[i]);
 		g2_new(_z[i]);
 	}
+	for (i = 0; i < ATTRS; i++) {
+		msgs[i] = m;
+		lens[i] = sizeof(m);
+	}
 
 	BENCH_BEGIN("cp_cls_gen") {
 		BENCH_ADD(cp_cls_gen(u, v, x, y));
@@ -847,17 +1096,23 @@ static int cls(void) {
 		BENCH_ADD(cp_cli_ver(a, A, b, B, c, m, sizeof(m), r, x, y, z));
 	} BENCH_END;
 
-	BENCH_BEGIN("cp_clb_gen (5)") {
-		BENCH_ADD(cp_clb_gen(t, u, _v, x, y, _z, 5));
-	} BENCH_END;
+	for (i = 0; i < (int)(sizeof(attrs) / sizeof(attrs[0])); i++) {
+		n = attrs[i];
+		util_print("(%2d attrs) ", n);
+		BENCH_BEGIN("cp_clb_gen") {
+			BENCH_ADD(cp_clb_gen(t, u, _v, x, y, _z, n));
+		} BENCH_END;
 
-	BENCH_BEGIN("cp_clb_sig (5)") {
-		BENCH_ADD(cp_clb_sig(a, _A, b, _B, c, msgs, lens, t, u, _v, 5));
-	} BENCH_END;
+		util_print("(%2d attrs) ", n);
+		BENCH_BEGIN("cp_clb_sig") {
+			BENCH_ADD(cp_clb_sig(a, _A, b, _B, c, msgs, lens, t, u, _v, n));
+		} BENCH_END;
 
-	BENCH_BEGIN("cp_clb_ver (5)") {
-		BENCH_ADD(cp_clb_ver(a, _A, b, _B, c, msgs, lens, x, y, _z, 5));
-	} BENCH_END;
+		util_print("(%2d attrs) ", n);
+		BENCH_BEGIN("cp_clb_ver") {
+			BENCH_ADD(cp_clb_ver(a, _A, b, _B, c, msgs, lens, x, y, _z, n));
+		} BENCH_END;
+	}
 
 	bn_free(r);
 	bn_free(t);
@@ -871,7 +1126,7 @@ static int cls(void) {
 	g2_free(x);
 	g2_free(y);
 	g2_free(z);
-	for (i = 0; i < 4; i++) {
+	for (i = 0; i < ATTRS - 1; i++) {
 		bn_free(_v[i]);
 		g1_free(_A[i]);
 		g1_free(_B[i]);
@@ -881,12 +1136,12 @@ static int cls(void) {
 }
 
 static void pss(void) {
-	bn_t u, v, _v[5];
-	g1_t a, b;
-	g2_t g, x, y, _y[5];
+	bn_t u, v, _v[ATTRS];
+	g1_t a, b, as[4], bs[4];
+	g2_t g, x, y, _y[ATTRS];
 	uint8_t m[5] = { 0, 1, 2, 3, 4 };
-	uint8_t *msgs[5] = {m, m, m, m, m};
-	int i, lens[5] = {sizeof(m), sizeof(m), sizeof(m), sizeof(m), sizeof(m)};
+	uint8_t *msgs[ATTRS], **bmsgs[4];
+	int i, j, n, lens[ATTRS], *blens[4];
 
 	bn_null(u);
 	bn_null(v);
@@ -895,10 +1150,14 @@ static void pss(void) {
 	g2_null(g);
 	g2_null(x);
 	g2_null(y);
-	for (i = 0; i < 5; i++) {
+	for (i = 0; i < ATTRS; i++) {
 		bn_null(_v[i]);
 		g2_null(_y[i]);
 	}
+	for (i = 0; i < 4; i++) {
+		g1_null(as[i]);
+		g1_null(bs[i]);
+	}
 
 	bn_new(u);
 	bn_new(v);
@@ -907,9 +1166,17 @@ static void pss(void) {
 	g2_new(g);
 	g2_new(x);
 	g2_new(y);
-	for (i = 0; i < 5; i++) {
+	for (i = 0; i < ATTRS; i++) {
 		bn_new(_v[i]);
 		g2_new(_y[i]);
+		msgs[i] = m;
+		lens[i] = sizeof(m);
+	}
+	for (i = 0; i < 4; i++) {
+		g1_new(as[i]);
+		g1_new(bs[i]);
+		bmsgs[i] = msgs;
+		blens[i] = lens;
 	}
 
 	BENCH_BEGIN("cp_pss_gen") {
@@ -924,17 +1191,40 @@ static void pss(void) {
 		BENCH_ADD(cp_pss_ver(a, b, m, sizeof(m), g, x, y));
 	} BENCH_END;
 
-	BENCH_BEGIN("cp_psb_gen (5)") {
-		BENCH_ADD(cp_psb_gen(u, _v, g, x, _y, 5));
-	} BENCH_END;
+	for (i = 0; i < 4; i++) {
+		cp_pss_sig(as[i], bs[i], m, sizeof(m), u, v);
+	}
 
-	BENCH_BEGIN("cp_psb_sig (5)") {
-		BENCH_ADD(cp_psb_sig(a, b, msgs, lens, u, _v, 5));
+	BENCH_BEGIN("cp_pss_ver_sim (4)") {
+		BENCH_ADD(cp_pss_ver_sim(as, bs, msgs, lens, g, x, y, 4));
 	} BENCH_END;
 
-	BENCH_BEGIN("cp_psb_ver (5)") {
-		BENCH_ADD(cp_psb_ver(a, b, msgs, lens, g, x, _y, 5));
-	} BENCH_END;
+	for (i = 0; i < (int)(sizeof(attrs) / sizeof(attrs[0])); i++) {
+		n = attrs[i];
+		util_print("(%2d attrs) ", n);
+		BENCH_BEGIN("cp_psb_gen") {
+			BENCH_ADD(cp_psb_gen(u, _v, g, x, _y, n));
+		} BENCH_END;
+
+		util_print("(%2d attrs) ", n);
+		BENCH_BEGIN("cp_psb_sig") {
+			BENCH_ADD(cp_psb_sig(a, b, msgs, lens, u, _v, n));
+		} BENCH_END;
+
+		util_print("(%2d attrs) ", n);
+		BENCH_BEGIN("cp_psb_ver") {
+			BENCH_ADD(cp_psb_ver(a, b, msgs, lens, g, x, _y, n));
+		} BENCH_END;
+
+		for (j = 0; j < 4; j++) {
+			cp_psb_sig(as[j], bs[j], msgs, lens, u, _v, n);
+		}
+
+		util_print("(%2d attrs) ", n);
+		BENCH_BEGIN("cp_psb_ver_sim (4)") {
+			BENCH_ADD(cp_psb_ver_sim(as, bs, bmsgs, blens, g, x, _y, n, 4));
+		} BENCH_END;
+	}
 
 	bn_free(u);
 	bn_free(v);
@@ -943,9 +1233,13 @@ static void pss(void) {
 	g2_free(g);
 	g2_free(x);
 	g2_free(y);
-	for (i = 0; i < 5; i++) {
+	for (i = 0; i < ATTRS; i++) {
 		bn_free(_v[i]);
-		g1_free(_y[i]);
+		g2_free(_y[i]);
+	}
+	for (i = 0; i < 4; i++) {
+		g1_free(as[i]);
+		g1_free(bs[i]);
 	}
 }
 
@@ -1255,6 +1549,104 @@ static void lhs(void) {
 	}
 }
 
+/* Maximum number of labels for benchmarking functions with large weights.
+ * Building with -DMKLHS_LOT=100000 also times the largest batches, which
+ * takes minutes and hundreds of megabytes. */
+#ifndef MKLHS_LOT
+#define MKLHS_LOT	1000
+#endif
+
+static void mklhs_lot(void) {
+	char (*lb)[16] = malloc(MKLHS_LOT * sizeof(*lb));
+	char **ls = malloc(MKLHS_LOT * sizeof(char *));
+	int flen[1], *lens = malloc(MKLHS_LOT * sizeof(int));
+	bn_t m, n, sk, mu[1], *f[1], *msg = calloc(MKLHS_LOT, sizeof(bn_t));
+	g1_t sig, *a = calloc(MKLHS_LOT, sizeof(g1_t));
+	g2_t pk[1];
+
+	f[0] = calloc(MKLHS_LOT, sizeof(bn_t));
+	if (lb == NULL || ls == NULL || lens == NULL || msg == NULL ||
+			f[0] == NULL || a == NULL) {
+		util_print("FATAL ERROR!\n");
+		free(lb);
+		free(ls);
+		free(lens);
+		free(msg);
+		free(f[0]);
+		free(a);
+		return;
+	}
+
+	bn_null(m);
+	bn_null(n);
+	bn_null(sk);
+	bn_null(mu[0]);
+	g1_null(sig);
+	g2_null(pk[0]);
+
+	bn_new(m);
+	bn_new(n);
+	bn_new(sk);
+	bn_new(mu[0]);
+	g1_new(sig);
+	g2_new(pk[0]);
+
+	g1_get_ord(n);
+	cp_mklhs_gen(sk, pk[0]);
+	for (int l = 0; l < MKLHS_LOT; l++) {
+		bn_null(msg[l]);
+		bn_null(f[0][l]);
+		g1_null(a[l]);
+		bn_new(msg[l]);
+		bn_new(f[0][l]);
+		g1_new(a[l]);
+		lens[l] = snprintf(lb[l], sizeof(*lb), "l%d", l);
+		ls[l] = lb[l];
+		bn_rand_mod(msg[l], n);
+		bn_rand_mod(f[0][l], n);
+		cp_mklhs_sig(a[l], msg[l], ls[l], lens[l], sk);
+	}
+
+	/* Time a single run for many labels, since hashing dominates. */
+	for (int t = 10; t <= MKLHS_LOT; t *= 10) {
+		flen[0] = t;
+		cp_mklhs_fun_lot(mu[0], msg, f[0], t);
+		bn_copy(m, mu[0]);
+		util_print("(%6d lbs) ", t);
+		if (t <= 100) {
+			BENCH_SMALL("cp_mklhs_evl_lot", cp_mklhs_evl_lot(sig, a, f[0], t));
+		} else {
+			BENCH_ONCE("cp_mklhs_evl_lot", cp_mklhs_evl_lot(sig, a, f[0], t));
+		}
+		util_print("(%6d lbs) ", t);
+		if (t <= 100) {
+			BENCH_SMALL("cp_mklhs_ver_lot",
+				cp_mklhs_ver_lot(sig, m, mu, ls, lens, f, flen, pk, 1));
+		} else {
+			BENCH_ONCE("cp_mklhs_ver_lot",
+				cp_mklhs_ver_lot(sig, m, mu, ls, lens, f, flen, pk, 1));
+		}
+	}
+
+	bn_free(m);
+	bn_free(n);
+	bn_free(sk);
+	bn_free(mu[0]);
+	g1_free(sig);
+	g2_free(pk[0]);
+	for (int l = 0; l < MKLHS_LOT; l++) {
+		bn_free(msg[l]);
+		bn_free(f[0][l]);
+		g1_free(a[l]);
+	}
+	free(lb);
+	free(ls);
+	free(lens);
+	free(msg);
+	free(f[0]);
+	free(a);
+}
+
 #endif /* WITH_PC */
 
 int main(void) {
@@ -1301,6 +1693,16 @@ int main(void) {
 		pss();
 		zss();
 		lhs();
+		mklhs_lot();
+	} else {
+		THROW(ERR_NO_CURVE);
+	}
+#endif
+
+#if defined(WITH_ED)
+	util_banner("Protocols based on Edwards curves:\n", 0);
+	if (ed_param_set_any() == RLC_OK) {
+		eddsa();
 	} else {
 		THROW(ERR_NO_CURVE);
 	}
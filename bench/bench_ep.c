@@ -161,6 +161,29 @@ static void util(void) {
 		BENCH_ADD(ep_read_bin(p, bin, l));
 	} BENCH_END;
 
+	BENCH_BEGIN("ep_param_set") {
+		BENCH_ADD(ep_param_set(ep_param_get()));
+	} BENCH_END;
+
+	if (ep_curve_size_pre() > 0) {
+		uint8_t *pre = RLC_ALLOCA(uint8_t, ep_curve_size_pre());
+
+		BENCH_BEGIN("ep_curve_write_pre") {
+			BENCH_ADD(ep_curve_write_pre(pre, ep_curve_size_pre()));
+		} BENCH_END;
+
+		BENCH_BEGIN("ep_curve_map_pre") {
+			BENCH_ADD(ep_curve_map_pre(pre, ep_curve_size_pre()));
+		} BENCH_END;
+
+		BENCH_BEGIN("ep_param_set (mapped)") {
+			BENCH_ADD(ep_param_set(ep_param_get()));
+		} BENCH_END;
+
+		ep_curve_map_pre(NULL, 0);
+		RLC_FREE(pre);
+	}
+
 	ep_free(p);
 	ep_free(q);
 	for (int j = 0; j < 4; j++) {
@@ -451,6 +474,25 @@ static void arith(void) {
 	}
 #endif
 
+	{
+		ep_pre_t u;
+
+		ep_pre_null(u);
+		ep_pre_new(u, 8);
+		BENCH_BEGIN("ep_mul_pre_dynam (8)") {
+			ep_rand(p);
+			BENCH_ADD(ep_mul_pre_dynam(u, p));
+		} BENCH_END;
+
+		BENCH_BEGIN("ep_mul_fix_dynam (8)") {
+			bn_rand_mod(k, n);
+			ep_rand(p);
+			ep_mul_pre_dynam(u, p);
+			BENCH_ADD(ep_mul_fix_dynam(q, u, k));
+		} BENCH_END;
+		ep_pre_free(u);
+	}
+
 #if EP_FIX == COMBD || !defined(STRIP)
 	for (int i = 0; i < RLC_EP_TABLE_COMBD; i++) {
 		ep_new(t[i]);
@@ -462,6 +462,25 @@ static void arith(void) {
 	}
 #endif
 
+	{
+		ep2_pre_t u;
+
+		ep2_pre_null(u);
+		ep2_pre_new(u, 8);
+		BENCH_BEGIN("ep2_mul_pre_dynam (8)") {
+			ep2_rand(p);
+			BENCH_ADD(ep2_mul_pre_dynam(u, p));
+		} BENCH_END;
+
+		BENCH_BEGIN("ep2_mul_fix_dynam (8)") {
+			bn_rand_mod(k, n);
+			ep2_rand(p);
+			ep2_mul_pre_dynam(u, p);
+			BENCH_ADD(ep2_mul_fix_dynam(q, u, k));
+		} BENCH_END;
+		ep2_pre_free(u);
+	}
+
 #if EP_FIX == COMBD || !defined(STRIP)
 	for (int i = 0; i < RLC_EPX_TABLE_COMBD; i++) {
 		ep2_new(t[i]);
@@ -609,6 +609,56 @@ static void arith(void) {
 	fp_free(f[1]);
 }
 
+static void batch(void) {
+	fp_t f[64];
+	fp_x8_t u, v, w;
+
+	for (int i = 0; i < 64; i++) {
+		fp_null(f[i]);
+		fp_new(f[i]);
+		fp_rand(f[i]);
+	}
+	fp_x8_conv(u, (const fp_t *)f);
+	fp_x8_conv(v, (const fp_t *)f + 8);
+
+	BENCH_BEGIN("fp_x8_conv") {
+		BENCH_ADD(fp_x8_conv(w, (const fp_t *)f));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("fp_x8_back") {
+		BENCH_ADD(fp_x8_back(f + 16, u));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("fp_add_x8") {
+		BENCH_ADD(fp_add_x8(w, u, v));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("fp_mul_x8") {
+		BENCH_ADD(fp_mul_x8(w, u, v));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("fp_sqr_x8") {
+		BENCH_ADD(fp_sqr_x8(w, u));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("fp_inv_sim (64)") {
+		for (int i = 0; i < 64; i++) {
+			fp_rand(f[i]);
+		}
+		BENCH_ADD(fp_inv_sim(f, (const fp_t *)f, 64));
+	}
+	BENCH_END;
+
+	for (int i = 0; i < 64; i++) {
+		fp_free(f[i]);
+	}
+}
+
 int main(void) {
 	if (core_init() != RLC_OK) {
 		core_clean();
@@ -626,6 +676,8 @@ int main(void) {
 	util();
 	util_banner("Arithmetic:\n", 0);
 	arith();
+	util_banner("Batched arithmetic:\n", 0);
+	batch();
 
 	core_clean();
 	return 0;
@@ -1020,12 +1020,14 @@ static void util6(void) {
 }
 
 static void arith6(void) {
-	fp6_t a, b, c;
+	fp6_t a, b, c, e[2];
 	bn_t d;
 
 	fp6_new(a);
 	fp6_new(b);
 	fp6_new(c);
+	fp6_new(e[0]);
+	fp6_new(e[1]);
 	bn_new(d);
 
 	BENCH_BEGIN("fp6_add") {
@@ -1107,6 +1109,13 @@ static void arith6(void) {
 	}
 	BENCH_END;
 
+	BENCH_BEGIN("fp6_inv_sim (2)") {
+		fp6_rand(e[0]);
+		fp6_rand(e[1]);
+		BENCH_ADD(fp6_inv_sim(e, e, 2));
+	}
+	BENCH_END;
+
 	BENCH_BEGIN("fp6_exp") {
 		fp6_rand(a);
 		d->used = RLC_FP_DIGS;
@@ -1745,7 +1754,7 @@ static void util12(void) {
 }
 
 static void arith12(void) {
-	fp12_t a, b, c, d[2];
+	fp12_t a, b, c, d[2], t[2];
 	bn_t e;
 
 	fp12_new(a);
@@ -1753,6 +1762,8 @@ static void arith12(void) {
 	fp12_new(c);
 	fp12_new(d[0]);
 	fp12_new(d[1]);
+	fp12_new(t[0]);
+	fp12_new(t[1]);
 	bn_new(e);
 
 	BENCH_BEGIN("fp12_add") {
@@ -1983,11 +1994,39 @@ static void arith12(void) {
 	}
 	BENCH_END;
 
+	BENCH_BEGIN("fp12_pck_max") {
+		fp12_rand(a);
+		fp12_conv_cyc(a, a);
+		BENCH_ADD(fp12_pck_max(c, a));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("fp12_upk_max") {
+		fp12_rand(a);
+		fp12_conv_cyc(a, a);
+		fp12_pck_max(a, a);
+		BENCH_ADD(fp12_upk_max(c, a));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("fp12_upk_max_sim (2)") {
+		fp12_rand(d[0]);
+		fp12_conv_cyc(d[0], d[0]);
+		fp12_pck_max(d[0], d[0]);
+		fp12_rand(d[1]);
+		fp12_conv_cyc(d[1], d[1]);
+		fp12_pck_max(d[1], d[1]);
+		BENCH_ADD(fp12_upk_max_sim(t, d, 2));
+	}
+	BENCH_END;
+
 	fp12_free(a);
 	fp12_free(b);
 	fp12_free(c);
 	fp12_free(d[0]);
 	fp12_free(d[1]);
+	fp12_free(t[0]);
+	fp12_free(t[1]);
 	bn_free(e);
 }
 
@@ -153,6 +153,8 @@ static void util1(void) {
 static void arith1(void) {
 	g1_t p, q, r, t[RLC_G1_TABLE];
 	bn_t k, l, n;
+	pc_dlog_t d;
+	dig_t m;
 
 	g1_null(p);
 	g1_null(q);
@@ -160,6 +162,7 @@ static void arith1(void) {
 	for (int i = 0; i < RLC_G1_TABLE; i++) {
 		g1_null(t[i]);
 	}
+	pc_dlog_null(d);
 
 	g1_new(p);
 	g1_new(q);
@@ -273,6 +276,18 @@ static void arith1(void) {
 		BENCH_ADD(g1_map(p, msg, 5));
 	} BENCH_END;
 
+	pc_dlog_new(d, 1024);
+
+	g1_rand(p);
+	BENCH_SMALL("g1_dlog_tab (1024)", g1_dlog_tab(d, p));
+
+	rand_bytes((uint8_t *)&m, sizeof(dig_t));
+	g1_mul_dig(q, p, m & 0xFFFFF);
+	BENCH_SMALL("g1_dlog (2^20)", g1_dlog(&m, q, p, d, 1 << 20));
+	BENCH_SMALL("g1_dlog_kgr (2^20)", g1_dlog_kgr(&m, q, p, 1 << 20));
+
+	pc_dlog_free(d);
+
 	g1_free(p);
 	g1_free(q);
 	bn_free(k);
@@ -636,6 +651,24 @@ static void util(void) {
 			gt_write_bin(bin, l, a, 1);
 			BENCH_ADD(gt_read_bin(a, bin, l));
 		} BENCH_END;
+
+		BENCH_BEGIN("gt_size_bin (2)") {
+			gt_rand(a);
+			BENCH_ADD(gt_size_bin(a, 2));
+		} BENCH_END;
+
+		BENCH_BEGIN("gt_write_bin (2)") {
+			gt_rand(a);
+			l = gt_size_bin(a, 2);
+			BENCH_ADD(gt_write_bin(bin, l, a, 2));
+		} BENCH_END;
+
+		BENCH_BEGIN("gt_read_bin (2)") {
+			gt_rand(a);
+			l = gt_size_bin(a, 2);
+			gt_write_bin(bin, l, a, 2);
+			BENCH_ADD(gt_read_bin(a, bin, l));
+		} BENCH_END;
 	}
 
 	BENCH_BEGIN("gt_is_valid") {
@@ -650,6 +683,10 @@ static void util(void) {
 static void arith(void) {
 	gt_t a, b, c;
 	bn_t d, e;
+	pc_dlog_t t;
+	dig_t m;
+
+	pc_dlog_null(t);
 
 	gt_new(a);
 	gt_new(b);
@@ -693,6 +730,18 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	pc_dlog_new(t, 1024);
+
+	gt_rand(a);
+	BENCH_SMALL("gt_dlog_tab (1024)", gt_dlog_tab(t, a));
+
+	rand_bytes((uint8_t *)&m, sizeof(dig_t));
+	gt_exp_dig(b, a, m & 0xFFFFF);
+	BENCH_SMALL("gt_dlog (2^20)", gt_dlog(&m, b, a, t, 1 << 20));
+	BENCH_SMALL("gt_dlog_kgr (2^20)", gt_dlog_kgr(&m, b, a, 1 << 20));
+
+	pc_dlog_free(t);
+
 	gt_free(a);
 	gt_free(b);
 	gt_free(c);
@@ -0,0 +1,39 @@
+# Generates the prime field code used by the Fiat-Crypto backend.
+#
+# Input variables:
+#   FIAT_CRYPTO - root folder of a Fiat-Crypto build.
+#   FIAT_PRIME  - prime modulus, or empty to read it from the output of test_fp.
+#   FIAT_TEST   - path to the test_fp binary.
+#   FIAT_WSIZE  - digit size in bits.
+#   FIAT_TMPL   - backend folder containing the templates.
+#   FIAT_DIR    - output folder in the build tree.
+
+set(FIAT_GEN "${FIAT_CRYPTO}/src/ExtractionOCaml/word_by_word_montgomery")
+if(NOT EXISTS ${FIAT_GEN})
+	message(FATAL_ERROR "Could not find ${FIAT_GEN}, please set FIAT_CRYPTO.")
+endif()
+
+if(NOT FIAT_PRIME)
+	execute_process(COMMAND ${FIAT_TEST} OUTPUT_VARIABLE FIAT_OUT)
+	string(REGEX MATCH "Prime modulus:[^\n]*\n[ ]*([0-9A-F ]+)" FIAT_OUT "${FIAT_OUT}")
+	string(REPLACE " " "" FIAT_PRIME "${CMAKE_MATCH_1}")
+	if(NOT FIAT_PRIME)
+		message(FATAL_ERROR "Could not read prime modulus from ${FIAT_TEST}.")
+	endif()
+	set(FIAT_PRIME "0x${FIAT_PRIME}")
+endif()
+message(STATUS "Generating Fiat-Crypto code for prime ${FIAT_PRIME}")
+file(MAKE_DIRECTORY ${FIAT_DIR})
+
+execute_process(COMMAND ${FIAT_GEN} --static --use-value-barrier --inline
+	fp ${FIAT_WSIZE} ${FIAT_PRIME}
+	OUTPUT_FILE ${FIAT_DIR}/fiat_fp.c RESULT_VARIABLE FIAT_RES)
+if(NOT FIAT_RES EQUAL 0)
+	message(FATAL_ERROR "Fiat-Crypto failed to generate code for ${FIAT_PRIME}.")
+endif()
+
+file(GLOB FIAT_TMPLS ${FIAT_TMPL}/*.tmpl)
+foreach(TMPL ${FIAT_TMPLS})
+	get_filename_component(NAME ${TMPL} NAME_WE)
+	configure_file(${TMPL} ${FIAT_DIR}/${NAME}.c COPYONLY)
+endforeach(TMPL)
@@ -341,6 +341,26 @@ void fp_rdcn_low(dig_t *c, dig_t *a);
  */
 void fp_invn_low(dig_t *c, const dig_t *a);
 
+#ifdef FP_ADX
+
+/**
+ * Checks if the MULX/ADX kernels are used by the low-level multiplication,
+ * squaring and reduction functions.
+ *
+ * @return 1 if the kernels are used, 0 otherwise.
+ */
+int fp_adx_low(void);
+
+/**
+ * Enables or disables the MULX/ADX kernels. The kernels are only enabled if
+ * the processor supports them.
+ *
+ * @param[in] on			- 1 to enable the kernels, 0 to disable them.
+ */
+void fp_adx_low_set(int on);
+
+#endif
+
 #endif /* ASM */
 
 #endif /* !RLC_FP_LOW_H */
@@ -51,7 +51,7 @@
  * @param[in] FUNCTION		- the function to benchmark.
  */
 #define BENCH_ONCE(LABEL, FUNCTION)											\
-	bench_reset();															\
+	bench_reset_label(LABEL);												\
 	util_print("BENCH: " LABEL "%*c = ", (int)(32 - strlen(LABEL)), ' ');	\
 	bench_before();															\
 	FUNCTION;																\
@@ -66,7 +66,7 @@
  * @param[in] FUNCTION		- the function to benchmark.
  */
 #define BENCH_SMALL(LABEL, FUNCTION)										\
-	bench_reset();															\
+	bench_reset_label(LABEL);												\
 	util_print("BENCH: " LABEL "%*c = ", (int)(32 - strlen(LABEL)), ' ');	\
 	bench_before();															\
 	for (int i = 0; i < BENCH; i++)	{										\
@@ -82,7 +82,7 @@
  * @param[in] LABEL			- the label for this benchmark.
  */
 #define BENCH_BEGIN(LABEL)													\
-	bench_reset();															\
+	bench_reset_label(LABEL);												\
 	util_print("BENCH: " LABEL "%*c = ", (int)(32 - strlen(LABEL)), ' ');	\
 	for (int _b = 0; _b < BENCH; _b++)	{									\
 
@@ -117,10 +117,64 @@
 	}																		\
 	bench_after();															\
 
+/**
+ * Maximum number of timing samples kept for computing the statistics of a
+ * benchmark.
+ */
+#define RLC_BENCH_SAMPLES	(4 * BENCH)
+
 /*============================================================================*/
 /* Type definitions                                                           */
 /*============================================================================*/
 
+/**
+ * Formats of machine-readable benchmark output.
+ */
+enum {
+	/** Only print the results. */
+	RLC_BENCH_TXT,
+	/** Also write the results as JSON objects, one per line. */
+	RLC_BENCH_JSON,
+	/** Also write the results as comma-separated values. */
+	RLC_BENCH_CSV
+};
+
+/**
+ * Statistics computed from the timing samples of a benchmark.
+ */
+enum {
+	/** Fastest sample. */
+	RLC_BENCH_MIN,
+	/** Median sample. */
+	RLC_BENCH_MED,
+	/** 90th percentile. */
+	RLC_BENCH_P90,
+	/** 99th percentile. */
+	RLC_BENCH_P99,
+	/** Standard deviation. */
+	RLC_BENCH_DEV,
+	/** Number of statistics. */
+	RLC_BENCH_STATS
+};
+
+/**
+ * Hardware events counted when the library is built with PERFC.
+ */
+enum {
+	/** Processor cycles. */
+	RLC_BENCH_CYCLES,
+	/** Retired instructions. */
+	RLC_BENCH_INSTRS,
+	/** Level 1 data cache read misses. */
+	RLC_BENCH_L1D,
+	/** Last level cache read misses. */
+	RLC_BENCH_LLC,
+	/** Mispredicted branches. */
+	RLC_BENCH_BRANCH,
+	/** Number of hardware events. */
+	RLC_BENCH_EVENTS
+};
+
 /**
  * Timer type.
  */
@@ -158,17 +212,46 @@ typedef unsigned long long bench_t;
 /* Function prototypes                                                        */
 /*============================================================================*/
 
+/**
+ * Initializes the benchmark module, selecting a machine-readable output from
+ * the RELIC_BENCH_JSON or RELIC_BENCH_CSV environment variables, which hold the
+ * path of the output file. If the library is built with PERFC, also opens the
+ * hardware performance counters available to the calling thread.
+ */
+void bench_init(void);
+
+/**
+ * Finalizes the benchmark module, closing the machine-readable output.
+ */
+void bench_clean(void);
+
+/**
+ * Selects a machine-readable output for the benchmark results, in addition to
+ * the printed results.
+ *
+ * @param[in] format		- the output format.
+ * @param[in] path			- the path of the output file.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int bench_output(int format, const char *path);
+
 /**
  * Measures and prints benchmarking overhead.
  */
 void bench_overhead(void);
 
 /**
- * Resets the benchmark data.
+ * Resets the benchmark data. The next results are not written to the
+ * machine-readable output, since they carry no label.
+ */
+void bench_reset(void);
+
+/**
+ * Resets the benchmark data and labels the next results.
  *
  * @param[in] label			- the benchmark label.
  */
-void bench_reset(void);
+void bench_reset_label(const char *label);
 
 /**
  * Measures the time before a benchmark is executed.
@@ -181,14 +264,20 @@ void bench_before(void);
 void bench_after(void);
 
 /**
- * Computes the mean elapsed time between the start and the end of a benchmark.
+ * Computes the mean elapsed time between the start and the end of a benchmark,
+ * together with the statistics of the individual samples. Each sample is the
+ * time between a pair of calls to bench_before() and bench_after(), scaled so
+ * that the samples average to the mean.
  *
  * @param benches			- the number of executed benchmarks.
  */
 void bench_compute(int benches);
 
 /**
- * Prints the last benchmark.
+ * Prints the last benchmark and writes it to the machine-readable output. If
+ * the library is built with COUNT, the field operations executed per benchmark
+ * are printed next to the timings. If it is built with PERFC, so are the
+ * instructions per cycle and the cache and branch misses per benchmark.
  */
 void bench_print(void);
 
@@ -199,4 +288,30 @@ void bench_print(void);
  */
 ull_t bench_total(void);
 
+/**
+ * Returns a statistic of the last benchmark.
+ *
+ * @param[in] stat			- the statistic, such as RLC_BENCH_MED.
+ * @return the statistic.
+ */
+ull_t bench_stat(int stat);
+
+/**
+ * Returns the number of hardware events per execution of the last benchmark.
+ *
+ * @param[in] event			- the event, such as RLC_BENCH_L1D.
+ * @return the number of events, or a negative value if the event is not
+ * available.
+ */
+double bench_event(int event);
+
+/**
+ * Returns the fraction of time the hardware counters were running during the
+ * last benchmark. Values below one mean that the kernel multiplexed the
+ * counters and the event counts are scaled estimates.
+ *
+ * @return the fraction of time, or a negative value if no event is available.
+ */
+double bench_running(void);
+
 #endif /* !RLC_BENCH_H */
@@ -1018,6 +1018,36 @@ void bn_mxp_monty(bn_t c, const bn_t a, const bn_t b, const bn_t m);
  */
 void bn_mxp_dig(bn_t c, const bn_t a, dig_t b, const bn_t m);
 
+/**
+ * Computes the product of several powers modulo a positive integer
+ * simultaneously, sharing squarings among all bases. Uses interleaved sliding
+ * windows for a few bases and the bucket method for many bases.
+ * Computes c = a_1^b_1 * ... * a_n^b_n mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the bases.
+ * @param[in] b				- the exponents.
+ * @param[in] n				- the number of bases.
+ * @param[in] m				- the modulus.
+ * @throw ERR_NO_VALID		- if a negative exponent has a non-invertible basis.
+ */
+void bn_mxp_sim(bn_t c, const bn_t a[], const bn_t b[], int n, const bn_t m);
+
+/**
+ * Computes the product of several powers modulo a positive integer
+ * simultaneously using fixed windows and constant-time table lookups, for
+ * secret exponents. Computes c = a_1^b_1 * ... * a_n^b_n mod m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the bases.
+ * @param[in] b				- the exponents.
+ * @param[in] n				- the number of bases.
+ * @param[in] m				- the modulus.
+ * @throw ERR_NO_VALID		- if a negative exponent has a non-invertible basis.
+ */
+void bn_mxp_sim_const(bn_t c, const bn_t a[], const bn_t b[], int n,
+		const bn_t m);
+
 /**
  * Extracts an approximate integer square-root of a multiple precision integer.
  *
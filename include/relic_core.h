@@ -98,6 +98,25 @@
  */
 #define RLC_NE			2
 
+/**
+ * Flags to select the modules set up by core_init_with(). @{
+ */
+/** Prime field module. */
+#define RLC_CORE_FP		0x01
+/** Binary field module. */
+#define RLC_CORE_FB		0x02
+/** Prime elliptic curve module. */
+#define RLC_CORE_EP		0x04
+/** Binary elliptic curve module. */
+#define RLC_CORE_EB		0x08
+/** Edwards elliptic curve module. */
+#define RLC_CORE_ED		0x10
+/** Pairing module, including curves over extension fields. */
+#define RLC_CORE_PP		0x20
+/** All modules. */
+#define RLC_CORE_ALL	0x3F
+/** @} */
+
 /**
  * Optimization identifer for the case where a coefficient is 0.
  */
@@ -133,16 +152,160 @@
  */
 #define RLC_TERMS		16
 
+/**
+ * Field operations counted when the library is built with COUNT. Each counter
+ * is incremented by the field-level functions and all their algorithm
+ * variants, such as fp_mul_comba() and fp_mul_integ(). The low-level fp_*_low
+ * and fp2_*_low routines, and the unreduced products used by lazy reduction,
+ * are not counted. In lazy-reduction builds, the prime field counters therefore
+ * miss most of the work done inside extension field operations, which is
+ * counted only by the extension field counters.
+ */
+enum {
+	/** Prime field additions and subtractions. */
+	RLC_CNT_FP_ADD,
+	/** Prime field multiplications. */
+	RLC_CNT_FP_MUL,
+	/** Prime field squarings. */
+	RLC_CNT_FP_SQR,
+	/** Prime field inversions. */
+	RLC_CNT_FP_INV,
+	/** Prime field square roots. */
+	RLC_CNT_FP_SRT,
+	/** Quadratic extension field multiplications. */
+	RLC_CNT_FP2_MUL,
+	/** Quadratic extension field squarings. */
+	RLC_CNT_FP2_SQR,
+	/** Quadratic extension field inversions. */
+	RLC_CNT_FP2_INV,
+	/** Dodecic extension field multiplications. */
+	RLC_CNT_FP12_MUL,
+	/** Dodecic extension field squarings. */
+	RLC_CNT_FP12_SQR,
+	/** Dodecic extension field cyclotomic squarings, also in compressed form. */
+	RLC_CNT_FP12_CYC,
+	/** Dodecic extension field multiplications by sparse elements. */
+	RLC_CNT_FP12_DXS,
+	/** Dodecic extension field inversions. */
+	RLC_CNT_FP12_INV,
+	/** Number of counters. */
+	RLC_CNT_MAX
+};
+
+/*============================================================================*/
+/* Macro definitions                                                          */
+/*============================================================================*/
+
+/**
+ * Counts one execution of a field operation in the current library context.
+ *
+ * @param[in] OP			- the operation, such as RLC_CNT_FP_MUL.
+ */
+#ifdef COUNT
+#define RLC_COUNT(OP)		core_get()->cnt[OP]++
+#else
+#define RLC_COUNT(OP)		/* empty */
+#endif
+
+/**
+ * Initializes a lock protecting data shared between threads.
+ *
+ * @param[out] L			- the lock.
+ */
+#if MULTI == PTHREAD
+#define core_lock_init(L)	pthread_mutex_init(&(L), NULL)
+#elif MULTI == OPENMP
+#define core_lock_init(L)	omp_init_lock(&(L))
+#else
+#define core_lock_init(L)	(void)(L)
+#endif
+
+/**
+ * Acquires a lock.
+ *
+ * @param[in,out] L			- the lock.
+ */
+#if MULTI == PTHREAD
+#define core_lock(L)		pthread_mutex_lock(&(L))
+#elif MULTI == OPENMP
+#define core_lock(L)		omp_set_lock(&(L))
+#else
+#define core_lock(L)		(void)(L)
+#endif
+
+/**
+ * Releases a lock.
+ *
+ * @param[in,out] L			- the lock.
+ */
+#if MULTI == PTHREAD
+#define core_unlock(L)		pthread_mutex_unlock(&(L))
+#elif MULTI == OPENMP
+#define core_unlock(L)		omp_unset_lock(&(L))
+#else
+#define core_unlock(L)		(void)(L)
+#endif
+
+/**
+ * Destroys a lock.
+ *
+ * @param[out] L			- the lock.
+ */
+#if MULTI == PTHREAD
+#define core_lock_clean(L)	pthread_mutex_destroy(&(L))
+#elif MULTI == OPENMP
+#define core_lock_clean(L)	omp_destroy_lock(&(L))
+#else
+#define core_lock_clean(L)	(void)(L)
+#endif
+
 /*============================================================================*/
 /* Type definitions                                                           */
 /*============================================================================*/
 
+/**
+ * Represents a lock protecting data shared between threads.
+ */
+#if MULTI == PTHREAD
+typedef pthread_mutex_t lock_t;
+#elif MULTI == OPENMP
+typedef omp_lock_t lock_t;
+#else
+typedef int lock_t;
+#endif
+
+#ifdef WITH_FB
+/**
+ * Precomputed tables of a binary field.
+ */
+struct _fb_pre_st {
+	/** The irreducible polynomial used to build the tables. */
+	fb_st poly;
+#if FB_SLV == QUICK || !defined(STRIP)
+	/** Table of precomputed half-traces. */
+	fb_st half[(RLC_DIG / 8 + 1) * RLC_FB_DIGS][16];
+#endif /* FB_SLV == QUICK */
+#if (FB_SRT == QUICK || !defined(STRIP)) && defined(FB_PRECO)
+	/** Multiplication table for the z^(1/2). */
+	fb_st srz[256];
+#endif /* FB_SRT == QUICK */
+#if FB_INV == ITOHT || !defined(STRIP)
+	/** Tables for repeated squarings. */
+	fb_st sqr[RLC_TERMS][RLC_FB_TABLE];
+	/** Pointers to the elements in the tables of repeated squarings. */
+	fb_st *ptr[RLC_TERMS][RLC_FB_TABLE];
+#endif /* FB_INV == ITOHT */
+};
+#endif /* WITH_FB */
+
 /**
  * Library context.
  */
 typedef struct _ctx_t {
 	/** The value returned by the last call, can be RLC_OK or RLC_ERR. */
 	int code;
+	/** The modules already set up in this context. */
+	int mods;
 
 #ifdef CHECK
 	/** The state of the last error caught. */
@@ -170,28 +333,20 @@ typedef struct _ctx_t {
 	/** Powers of z with non-zero traces. */
 	int fb_ta, fb_tb, fb_tc;
 #endif /* FB_TRC == QUICK */
-#if FB_SLV == QUICK || !defined(STRIP)
-	/** Table of precomputed half-traces. */
-	fb_st fb_half[(RLC_DIG / 8 + 1) * RLC_FB_DIGS][16];
-#endif /* FB_SLV == QUICK */
 #if FB_SRT == QUICK || !defined(STRIP)
 	/** Square root of z. */
 	fb_st fb_srz;
-#ifdef FB_PRECO
-	/** Multiplication table for the z^(1/2). */
-	fb_st fb_tab_srz[256];
-#endif /* FB_PRECO */
 #endif /* FB_SRT == QUICK */
 #if FB_INV == ITOHT || !defined(STRIP)
 	/** Stores an addition chain for (RLC_FB_BITS - 1). */
 	int chain[RLC_TERMS + 1];
 	/** Stores the length of the addition chain. */
 	int chain_len;
-	/** Tables for repeated squarings. */
-	fb_st fb_tab_sqr[RLC_TERMS][RLC_FB_TABLE];
-	/** Pointers to the elements in the tables of repeated squarings. */
-	fb_st *fb_tab_ptr[RLC_TERMS][RLC_FB_TABLE];
 #endif /* FB_INV == ITOHT */
+	/** Precomputed tables in use, possibly shared with other contexts. */
+	fb_pre_st *fb_pre;
+	/** Precomputed tables allocated by this context. */
+	fb_pre_st *fb_own;
 #endif /* WITH_FB */
 
 #ifdef WITH_EB
@@ -246,6 +401,14 @@ typedef struct _ctx_t {
 	int qnr;
 	/** Cubic non-residue. */
 	int cnr;
+	/** Prime modulus in radix 2^52, for batched arithmetic. */
+	uint64_t x8_prime[RLC_FP_X8_DIGS];
+	/** Value (-p^{-1} mod 2^52) for batched Montgomery reduction. */
+	uint64_t x8_u;
+	/** Value for converting field elements to the batched representation. */
+	uint64_t x8_conv[RLC_FP_X8_DIGS];
+	/** Value for converting field elements from the batched representation. */
+	uint64_t x8_back[RLC_FP_X8_DIGS];
 #if FP_RDC == QUICK || !defined(STRIP)
 	/** Sparse representation of prime modulus. */
 	int sps[RLC_TERMS + 1];
@@ -293,6 +456,8 @@ typedef struct _ctx_t {
 	ep_st ep_pre[RLC_EP_TABLE];
 	/** Array of pointers to the precomputation table. */
 	ep_st *ep_ptr[RLC_EP_TABLE];
+	/** Persisted precomputation table, if one was provided. */
+	const void *ep_map;
 #endif /* EP_PRECO */
 #endif /* WITH_EP */
 
@@ -322,6 +487,8 @@ typedef struct _ctx_t {
 	ep2_st ep2_pre[RLC_EP_TABLE];
 	/** Array of pointers to the precomputation table. */
 	ep2_st *ep2_ptr[RLC_EP_TABLE];
+	/** Persisted precomputation table, if one was provided. */
+	const void *ep2_map;
 #endif /* EP_PRECO */
 #if ALLOC == STACK
 /** In case of stack allocation, we need to get global memory for the table. */
@@ -368,6 +535,11 @@ typedef struct _ctx_t {
 	/** @} */
 #endif /* WITH_PP */
 
+#ifdef COUNT
+	/** Number of executions of each field operation. */
+	ull_t cnt[RLC_CNT_MAX];
+#endif /* COUNT */
+
 #if BENCH > 0
 	/** Stores the time measured before the execution of the benchmark. */
 	bench_t before;
@@ -375,6 +547,40 @@ typedef struct _ctx_t {
 	bench_t after;
 	/** Stores the sum of timings for the current benchmark. */
 	long long total;
+	/** Stores the individual timing samples of the current benchmark. */
+	long long samples[RLC_BENCH_SAMPLES];
+	/** Number of samples stored for the current benchmark. */
+	int sampled;
+	/** Statistics computed from the samples of the current benchmark. */
+	long long stats[RLC_BENCH_STATS];
+	/** Label of the current benchmark. */
+	const char *label;
+	/** Format of the machine-readable output. */
+	int format;
+	/** File receiving the machine-readable output. */
+	void *output;
+#ifdef COUNT
+	/** Operation counters when the current benchmark sample started. */
+	ull_t cnt_before[RLC_CNT_MAX];
+	/** Operation counts accumulated for the current benchmark. */
+	ull_t cnt_total[RLC_CNT_MAX];
+#endif /* COUNT */
+#ifdef PERFC
+	/** File descriptors of the hardware performance counters. */
+	int perf_fd[RLC_BENCH_EVENTS];
+	/** Hardware events and their enabled and running times when the current
+	 * benchmark sample started. */
+	ull_t perf_before[RLC_BENCH_EVENTS][3];
+	/** Hardware events accumulated for the current benchmark, scaled by the
+	 * fraction of time the counters were multiplexed out. */
+	double perf_total[RLC_BENCH_EVENTS];
+	/** Time the counters were enabled during the current benchmark. */
+	ull_t perf_enabled[RLC_BENCH_EVENTS];
+	/** Time the counters were running during the current benchmark. */
+	ull_t perf_running[RLC_BENCH_EVENTS];
+#endif /* PERFC */
+	/** Number of executions of the current benchmark. */
+	int benches;
 #ifdef OVERH
 	/** Benchmarking overhead to be measured and subtracted from benchmarks. */
 	long long over;
@@ -405,6 +611,25 @@ typedef struct _ctx_t {
  */
 int core_init(void);
 
+/**
+ * Initializes the library, setting up only the selected modules. Modules left
+ * out are set up on demand when their parameters are first configured.
+ *
+ * @param[in] mods				- the modules to set up, a combination of the
+ * 								RLC_CORE_* flags.
+ * @return RLC_OK if no error occurs, RLC_ERR otherwise.
+ */
+int core_init_with(int mods);
+
+/**
+ * Sets up the selected modules and their dependencies in the current library
+ * context, skipping modules already set up.
+ *
+ * @param[in] mods				- the modules to set up.
+ * @throw ERR_CAUGHT			- if a module cannot be set up.
+ */
+void core_init_mod(int mods);
+
 /**
  * Finalizes the library.
  *
@@ -426,4 +651,20 @@ ctx_t *core_get(void);
  */
 void core_set(ctx_t *ctx);
 
+/**
+ * Copies the field operation counters of the current library context. The
+ * counters are only updated if the library is built with COUNT. Operations are
+ * counted at every call, so operations built from other counted operations,
+ * such as square roots or extension field multiplications, also increase the
+ * counters of the operations they use.
+ *
+ * @param[out] cnt				- the counters, indexed by the RLC_CNT_* values.
+ */
+void core_cnt_get(ull_t cnt[RLC_CNT_MAX]);
+
+/**
+ * Resets the field operation counters of the current library context.
+ */
+void core_cnt_reset(void);
+
 #endif /* !RLC_CORE_H */
@@ -38,9 +38,11 @@
 
 #include "relic_conf.h"
 #include "relic_types.h"
+#include "relic_core.h"
 #include "relic_bn.h"
 #include "relic_ec.h"
 #include "relic_pc.h"
+#include "relic_md.h"
 
 /*============================================================================*/
 /* Type definitions.                                                          */
@@ -116,6 +118,18 @@ typedef struct _bdpe_t {
 	bn_t y;
 	/** The divisor of (p-1) such that gcd(t, (p-1)/t) = gcd(t, q-1) = 1. */
 	dig_t t;
+	/** The generator x = y^((p-1)(q-1)/t) of the subgroup of order t. */
+	bn_t x;
+	/** The giant step x^(-size) used when the table does not cover t. */
+	bn_t g;
+	/** The number of powers of x in the decryption table. */
+	int size;
+	/** The number of slots in the decryption table, a power of two. */
+	int slots;
+	/** The fingerprints of the powers of x stored in each slot. */
+	uint64_t *keys;
+	/** The exponent stored in each slot, or -1 if the slot is empty. */
+	int *vals;
 } bdpe_st;
 
 /**
@@ -127,6 +141,60 @@ typedef bdpe_st bdpe_t[1];
 typedef bdpe_st *bdpe_t;
 #endif
 
+/**
+ * Represents a Paillier's Homomorphic Probabilistic Encryption key pair.
+ */
+typedef struct _phpe_t {
+	/** The modulus n = pq. */
+	bn_t n;
+	/** The first prime p. */
+	bn_t p;
+	/** The second prime q. */
+	bn_t q;
+	/** The inverse of -q modulo p, used for decryption modulo p^2. */
+	bn_t dp;
+	/** The inverse of -p modulo q, used for decryption modulo q^2. */
+	bn_t dq;
+	/** The inverse of q modulo p. */
+	bn_t qi;
+} phpe_st;
+
+/**
+ * Pointer to a Paillier's Homomorphic Probabilistic Encryption key pair.
+ */
+#if ALLOC == AUTO
+typedef phpe_st phpe_t[1];
+#else
+typedef phpe_st *phpe_t;
+#endif
+
+/**
+ * Represents a pool of precomputed randomizers for Paillier's encryption.
+ */
+typedef struct {
+	/** The capacity of the pool. */
+	int size;
+	/** The number of randomizers available. */
+	int len;
+	/** The number of encryptions that consumed a randomizer from the pool. */
+	int hits;
+	/** The number of encryptions that found the pool empty. */
+	int miss;
+	/** The precomputed randomizers r^n mod n^2. */
+	bn_t *r;
+	/** The flag indicating if the pool was bound to a public key. */
+	int bound;
+	/** The digest of the public key the randomizers were computed with. */
+	uint8_t key[RLC_MD_LEN];
+	/** The lock protecting the pool when shared between threads. */
+	lock_t lock;
+} phpe_pool_st;
+
+/**
+ * Pointer to a pool of precomputed randomizers for Paillier's encryption.
+ */
+typedef phpe_pool_st *phpe_pool_t;
+
 /**
  * Represents a SOKAKA key pair.
  */
@@ -146,6 +214,44 @@ typedef sokaka_st sokaka_t[1];
 typedef sokaka_st *sokaka_t;
 #endif
 
+/**
+ * Represents a cache of pairings computed with the hashes of identities, with
+ * the least recently used entry replaced when full.
+ */
+typedef struct {
+	/** The capacity of the cache. */
+	int size;
+	/** The number of cached identities. */
+	int len;
+	/** The number of lookups that found the identity in the cache. */
+	int hits;
+	/** The number of lookups that did not find the identity. */
+	int miss;
+	/** The counter incremented at each access to order the entries. */
+	uint64_t tick;
+	/** The time of the last access to each entry. */
+	uint64_t *ages;
+	/** The hashes of the cached identities. */
+	uint64_t *keys;
+	/** The lengths of the cached identities. */
+	int *lens;
+	/** The cached identities. */
+	uint8_t **ids;
+	/** The cached pairings, serialized without compression. */
+	uint8_t **vals;
+	/** The flag indicating if the cache was bound to a key. */
+	int bound;
+	/** The digest of the key the pairings were computed with. */
+	uint8_t key[RLC_MD_LEN];
+	/** The lock protecting the cache when shared between threads. */
+	lock_t lock;
+} idc_st;
+
+/**
+ * Pointer to a cache of pairings computed with identities.
+ */
+typedef idc_st *idc_t;
+
 /**
  * Represents a Boneh-Goh-Nissim cryptosystem key pair.
  */
@@ -179,6 +285,41 @@ typedef bgn_st bgn_t[1];
 typedef bgn_st *bgn_t;
 #endif
 
+/**
+ * Represents a pool of precomputed randomizers for BGN encryption.
+ */
+typedef struct {
+	/** The capacity of the pool in each group. */
+	int size;
+	/** The number of randomizers available in G_1. */
+	int len1;
+	/** The number of randomizers available in G_2. */
+	int len2;
+	/** The number of encryptions that consumed a randomizer from the pool. */
+	int hits;
+	/** The number of encryptions that found the pool empty. */
+	int miss;
+	/** The precomputed elements rG in G_1. */
+	g1_t *r1;
+	/** The precomputed elements r(xG) in G_1. */
+	g1_t *s1;
+	/** The precomputed elements rH in G_2. */
+	g2_t *r2;
+	/** The precomputed elements r(xH) in G_2. */
+	g2_t *s2;
+	/** The flag indicating if the pool was bound to a public key. */
+	int bound;
+	/** The digest of the public key the randomizers were computed with. */
+	uint8_t key[RLC_MD_LEN];
+	/** The lock protecting the pool when shared between threads. */
+	lock_t lock;
+} bgn_pool_st;
+
+/**
+ * Pointer to a pool of precomputed randomizers for BGN encryption.
+ */
+typedef bgn_pool_st *bgn_pool_t;
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -388,7 +529,12 @@ typedef bgn_st *bgn_t;
 	bn_new((A)->y);															\
 	bn_new((A)->p);															\
 	bn_new((A)->q);															\
+	bn_new((A)->x);															\
+	bn_new((A)->g);															\
 	(A)->t = 0;																\
+	(A)->size = (A)->slots = 0;												\
+	(A)->keys = NULL;														\
+	(A)->vals = NULL;														\
 
 #elif ALLOC == AUTO
 #define bdpe_new(A)															\
@@ -396,7 +542,12 @@ typedef bgn_st *bgn_t;
 	bn_new((A)->y);															\
 	bn_new((A)->p);															\
 	bn_new((A)->q);															\
+	bn_new((A)->x);															\
+	bn_new((A)->g);															\
 	(A)->t = 0;																\
+	(A)->size = (A)->slots = 0;												\
+	(A)->keys = NULL;														\
+	(A)->vals = NULL;														\
 
 #elif ALLOC == STACK
 #define bdpe_new(A)															\
@@ -405,6 +556,12 @@ typedef bgn_st *bgn_t;
 	bn_new((A)->y);															\
 	bn_new((A)->p);															\
 	bn_new((A)->q);															\
+	bn_new((A)->x);															\
+	bn_new((A)->g);															\
+	(A)->t = 0;																\
+	(A)->size = (A)->slots = 0;												\
+	(A)->keys = NULL;														\
+	(A)->vals = NULL;														\
 
 #endif
 
@@ -420,13 +577,21 @@ typedef bgn_st *bgn_t;
 		bn_free((A)->y);													\
 		bn_free((A)->p);													\
 		bn_free((A)->q);													\
+		bn_free((A)->x);													\
+		bn_free((A)->g);													\
+		free((A)->keys);													\
+		free((A)->vals);													\
 		(A)->t = 0;															\
 		free(A);															\
 		A = NULL;															\
 	}
 
 #elif ALLOC == AUTO
-#define bdpe_free(A)			/* empty */
+#define bdpe_free(A)														\
+	free((A)->keys);														\
+	free((A)->vals);														\
+	(A)->keys = NULL;														\
+	(A)->vals = NULL;														\
 
 #elif ALLOC == STACK
 #define bdpe_free(A)														\
@@ -434,11 +599,132 @@ typedef bgn_st *bgn_t;
 	bn_free((A)->y);														\
 	bn_free((A)->p);														\
 	bn_free((A)->q);														\
+	bn_free((A)->x);														\
+	bn_free((A)->g);														\
+	free((A)->keys);														\
+	free((A)->vals);														\
 	(A)->t = 0;																\
 	A = NULL;																\
 
 #endif
 
+/**
+ * Initializes a Paillier's key pair with a null value.
+ *
+ * @param[out] A			- the key pair to initialize.
+ */
+#if ALLOC == AUTO
+#define phpe_null(A)			/* empty */
+#else
+#define phpe_null(A)			A = NULL;
+#endif
+
+/**
+ * Calls a function to allocate and initialize a Paillier's key pair.
+ *
+ * @param[out] A			- the new key pair.
+ */
+#if ALLOC == DYNAMIC
+#define phpe_new(A)															\
+	A = (phpe_t)calloc(1, sizeof(phpe_st));									\
+	if (A == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	bn_new((A)->n);															\
+	bn_new((A)->p);															\
+	bn_new((A)->q);															\
+	bn_new((A)->dp);														\
+	bn_new((A)->dq);														\
+	bn_new((A)->qi);														\
+
+#elif ALLOC == AUTO
+#define phpe_new(A)															\
+	bn_new((A)->n);															\
+	bn_new((A)->p);															\
+	bn_new((A)->q);															\
+	bn_new((A)->dp);														\
+	bn_new((A)->dq);														\
+	bn_new((A)->qi);														\
+
+#elif ALLOC == STACK
+#define phpe_new(A)															\
+	A = (phpe_t)alloca(sizeof(phpe_st));									\
+	bn_new((A)->n);															\
+	bn_new((A)->p);															\
+	bn_new((A)->q);															\
+	bn_new((A)->dp);														\
+	bn_new((A)->dq);														\
+	bn_new((A)->qi);														\
+
+#endif
+
+/**
+ * Calls a function to clean and free a Paillier's key pair.
+ *
+ * @param[out] A			- the key pair to clean and free.
+ */
+#if ALLOC == DYNAMIC
+#define phpe_free(A)														\
+	if (A != NULL) {														\
+		bn_free((A)->n);													\
+		bn_free((A)->p);													\
+		bn_free((A)->q);													\
+		bn_free((A)->dp);													\
+		bn_free((A)->dq);													\
+		bn_free((A)->qi);													\
+		free(A);															\
+		A = NULL;															\
+	}
+
+#elif ALLOC == AUTO
+#define phpe_free(A)			/* empty */
+
+#elif ALLOC == STACK
+#define phpe_free(A)														\
+	bn_free((A)->n);														\
+	bn_free((A)->p);														\
+	bn_free((A)->q);														\
+	bn_free((A)->dp);														\
+	bn_free((A)->dq);														\
+	bn_free((A)->qi);														\
+	A = NULL;																\
+
+#endif
+
+/**
+ * Initializes a pool of Paillier's randomizers with a null value.
+ *
+ * @param[out] P			- the pool to initialize.
+ */
+#define phpe_pool_null(P)		P = NULL;
+
+/**
+ * Allocates an empty pool of Paillier's randomizers with the given capacity.
+ *
+ * @param[out] P			- the new pool.
+ * @param[in] M				- the capacity.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ * @throw ERR_NO_VALID		- if the capacity is not positive.
+ */
+#define phpe_pool_new(P, M)													\
+	P = (phpe_pool_t)calloc(1, sizeof(phpe_pool_st));						\
+	if (P == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	cp_phpe_pool_make(P, M);												\
+
+/**
+ * Cleans and frees a pool of Paillier's randomizers.
+ *
+ * @param[out] P			- the pool to free.
+ */
+#define phpe_pool_free(P)													\
+	if (P != NULL) {														\
+		cp_phpe_pool_clean(P);												\
+		free(P);															\
+		P = NULL;															\
+	}																		\
+
 /**
  * Initializes a SOKAKA key pair with a null value.
  *
@@ -500,6 +786,40 @@ typedef bgn_st *bgn_t;
 
 #endif
 
+/**
+ * Initializes a cache of identity pairings with a null value.
+ *
+ * @param[out] C			- the cache to initialize.
+ */
+#define idc_null(C)				C = NULL;
+
+/**
+ * Allocates an empty cache of identity pairings with the given capacity.
+ *
+ * @param[out] C			- the new cache.
+ * @param[in] M				- the capacity.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ * @throw ERR_NO_VALID		- if the capacity is not positive.
+ */
+#define idc_new(C, M)														\
+	C = (idc_t)calloc(1, sizeof(idc_st));									\
+	if (C == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	cp_idc_make(C, M);														\
+
+/**
+ * Cleans and frees a cache of identity pairings.
+ *
+ * @param[out] C			- the cache to free.
+ */
+#define idc_free(C)															\
+	if (C != NULL) {														\
+		cp_idc_clean(C);													\
+		free(C);															\
+		C = NULL;															\
+	}																		\
+
 /**
  * Initializes a BGN key pair with a null value.
  *
@@ -589,6 +909,40 @@ typedef bgn_st *bgn_t;
 
 #endif
 
+/**
+ * Initializes a pool of BGN randomizers with a null value.
+ *
+ * @param[out] P			- the pool to initialize.
+ */
+#define bgn_pool_null(P)		P = NULL;
+
+/**
+ * Allocates an empty pool of BGN randomizers with the given capacity.
+ *
+ * @param[out] P			- the new pool.
+ * @param[in] M				- the capacity in each group.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ * @throw ERR_NO_VALID		- if the capacity is not positive.
+ */
+#define bgn_pool_new(P, M)													\
+	P = (bgn_pool_t)calloc(1, sizeof(bgn_pool_st));							\
+	if (P == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	cp_bgn_pool_make(P, M);													\
+
+/**
+ * Cleans and frees a pool of BGN randomizers.
+ *
+ * @param[out] P			- the pool to free.
+ */
+#define bgn_pool_free(P)													\
+	if (P != NULL) {														\
+		cp_bgn_pool_clean(P);												\
+		free(P);															\
+		P = NULL;															\
+	}																		\
+
 /**
  * Generates a new RSA key pair.
  *
@@ -780,7 +1134,9 @@ int cp_rabin_dec(uint8_t *out, int *out_len, uint8_t *in, int in_len,
 		rabin_t prv);
 
 /**
- * Generates a key pair for Benaloh's Dense Probabilistic Encryption.
+ * Generates a key pair for Benaloh's Dense Probabilistic Encryption. The
+ * private key keeps a table of powers of the subgroup generator, so that
+ * decryption needs a single exponentiation and a table lookup.
  *
  * @param[out] pub			- the public key.
  * @param[out] prv			- the private key.
@@ -790,6 +1146,16 @@ int cp_rabin_dec(uint8_t *out, int *out_len, uint8_t *in, int in_len,
  */
 int cp_bdpe_gen(bdpe_t pub, bdpe_t prv, dig_t block, int bits);
 
+/**
+ * Builds the decryption table of a Benaloh's private key from its factors,
+ * block size and public element. Key generation already builds the table,
+ * so this is only needed for private keys assembled by the caller.
+ *
+ * @param[in,out] prv		- the private key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bdpe_pre(bdpe_t prv);
+
 /**
  * Encrypts using Benaloh's cryptosystem.
  *
@@ -802,7 +1168,8 @@ int cp_bdpe_gen(bdpe_t pub, bdpe_t prv, dig_t block, int bits);
 int cp_bdpe_enc(uint8_t *out, int *out_len, dig_t in, bdpe_t pub);
 
 /**
- * Decrypts using Benaloh's cryptosystem.
+ * Decrypts using Benaloh's cryptosystem. The private key is not modified, so
+ * it can be shared between threads, and must have its decryption table built.
  *
  * @param[out] out			- the decrypted small integer.
  * @param[in] in			- the input buffer.
@@ -815,12 +1182,12 @@ int cp_bdpe_dec(dig_t *out, uint8_t *in, int in_len, bdpe_t prv);
 /**
  * Generates a key pair for Paillier's Homomorphic Probabilistic Encryption.
  *
- * @param[out] n			- the public key.
- * @param[out] l			- the private key.
+ * @param[out] pub			- the public key.
+ * @param[out] prv			- the private key.
  * @param[in] bits			- the key length in bits.
  * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
  */
-int cp_phpe_gen(bn_t n, bn_t l, int bits);
+int cp_phpe_gen(phpe_t pub, phpe_t prv, int bits);
 
 /**
  * Encrypts using the Paillier cryptosystem.
@@ -829,10 +1196,11 @@ int cp_phpe_gen(bn_t n, bn_t l, int bits);
  * @param[in, out] out_len	- the buffer capacity and number of bytes written.
  * @param[in] in			- the input buffer.
  * @param[in] in_len		- the number of bytes to encrypt.
- * @param[in] n				- the public key.
+ * @param[in] pub			- the public key.
  * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
  */
-int cp_phpe_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len, bn_t n);
+int cp_phpe_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len,
+		phpe_t pub);
 
 /**
  * Decrypts using the Paillier cryptosystem. Since this system is homomorphic,
@@ -841,13 +1209,99 @@ int cp_phpe_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len, bn_t n);
  *
  * @param[out] out			- the output buffer.
  * @param[out] out_len		- the number of bytes to write in the output buffer.
+ * @param[in] in			- the input buffer.
  * @param[in] in_len		- the number of bytes to decrypt.
- * @param[in] n				- the public key.
- * @param[in] l				- the private key.
+ * @param[in] prv			- the private key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_phpe_dec(uint8_t *out, int out_len, uint8_t *in, int in_len,
+		phpe_t prv);
+
+/**
+ * Adds homomorphically a vector of Paillier ciphertexts, represented as
+ * integers reduced modulo n^2. Computes the encryption of the sum of the
+ * plaintexts.
+ *
+ * @param[out] c			- the resulting ciphertext.
+ * @param[in] a				- the ciphertexts.
+ * @param[in] len			- the number of ciphertexts.
+ * @param[in] pub			- the public key.
  * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
  */
-int cp_phpe_dec(uint8_t *out, int out_len, uint8_t *in, int in_len, bn_t n,
-		bn_t l);
+int cp_phpe_add_vec(bn_t c, bn_t a[], int len, phpe_t pub);
+
+/**
+ * Multiplies homomorphically each Paillier ciphertext in a vector by the
+ * corresponding plaintext scalar. Computes c_i = a_i^k_i mod n^2.
+ *
+ * @param[out] c			- the resulting ciphertexts.
+ * @param[in] a				- the ciphertexts.
+ * @param[in] k				- the scalars.
+ * @param[in] len			- the number of ciphertexts.
+ * @param[in] pub			- the public key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_phpe_scal_vec(bn_t c[], bn_t a[], bn_t k[], int len, phpe_t pub);
+
+/**
+ * Computes homomorphically the inner product of a vector of Paillier
+ * ciphertexts and a vector of plaintexts, using simultaneous exponentiation.
+ * Computes c = prod a_i^k_i mod n^2.
+ *
+ * @param[out] c			- the resulting ciphertext.
+ * @param[in] a				- the ciphertexts.
+ * @param[in] k				- the plaintexts.
+ * @param[in] len			- the number of ciphertexts.
+ * @param[in] pub			- the public key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_phpe_ip(bn_t c, bn_t a[], bn_t k[], int len, phpe_t pub);
+
+/**
+ * Allocates the randomizers of an empty pool for Paillier's encryption.
+ *
+ * @param[out] p			- the pool.
+ * @param[in] m				- the capacity.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ * @throw ERR_NO_VALID		- if the capacity is not positive.
+ */
+void cp_phpe_pool_make(phpe_pool_t p, int m);
+
+/**
+ * Frees the randomizers of a pool for Paillier's encryption.
+ *
+ * @param[out] p			- the pool.
+ */
+void cp_phpe_pool_clean(phpe_pool_t p);
+
+/**
+ * Fills a pool with randomizers for Paillier's encryption under the given
+ * public key. The pool can be refilled by one thread while others encrypt.
+ * The first refill binds the pool to the public key until it is freed, and
+ * refills under other keys fail.
+ *
+ * @param[in,out] p			- the pool.
+ * @param[in] pub			- the public key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_phpe_pre(phpe_pool_t p, phpe_t pub);
+
+/**
+ * Encrypts using the Paillier cryptosystem and a randomizer taken from a pool
+ * filled for the same public key. If the pool is empty, a fresh randomizer is
+ * computed and the miss is counted. Encryption fails if the pool is bound to
+ * another public key.
+ *
+ * @param[out] out			- the output buffer.
+ * @param[in, out] out_len	- the buffer capacity and number of bytes written.
+ * @param[in] in			- the input buffer.
+ * @param[in] in_len		- the number of bytes to encrypt.
+ * @param[in] pub			- the public key.
+ * @param[in,out] p			- the pool of randomizers.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_phpe_enc_pre(uint8_t *out, int *out_len, uint8_t *in, int in_len,
+		phpe_t pub, phpe_pool_t p);
 
 /**
  * Generates an ECDH key pair.
@@ -869,6 +1323,26 @@ int cp_ecdh_gen(bn_t d, ec_t q);
  */
 int cp_ecdh_key(uint8_t *key, int key_len, bn_t d, ec_t q);
 
+/**
+ * Generates an X25519 key pair, as specified in RFC 7748. Requires the prime
+ * field to be configured with PRIME_25519.
+ *
+ * @param[out] k			- the private key with 32 bytes.
+ * @param[out] q			- the public u-coordinate with 32 bytes.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_x25519_gen(uint8_t *k, uint8_t *q);
+
+/**
+ * Derives a shared secret using X25519 with an x-only Montgomery ladder.
+ *
+ * @param[out] key			- the 32-byte shared secret.
+ * @param[in] k				- the private key.
+ * @param[in] q				- the u-coordinate received from the other party.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_x25519_key(uint8_t *key, uint8_t *k, uint8_t *q);
+
 /**
  * Generate an ECMQV key pair.
  *
@@ -968,6 +1442,22 @@ int cp_ecdsa_sig(bn_t r, bn_t s, uint8_t *msg, int len, int hash, bn_t d);
  */
 int cp_ecdsa_ver(bn_t r, bn_t s, uint8_t *msg, int len, int hash, ec_t q);
 
+/**
+ * Verifies a message signed with ECDSA using a precomputation table for the
+ * public key, built with ec_mul_pre(). Useful when the same key verifies many
+ * signatures.
+ *
+ * @param[in] r				- the first component of the signature.
+ * @param[in] s				- the second component of the signature.
+ * @param[in] msg			- the signed message.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] hash			- the flag to indicate the message format.
+ * @param[in] t				- the precomputation table for the public key.
+ * @return a boolean value indicating if the signature is valid.
+ */
+int cp_ecdsa_ver_pre(bn_t r, bn_t s, uint8_t *msg, int len, int hash,
+		const ec_t *t);
+
 /**
  * Generates an Elliptic Curve Schnorr Signature key pair.
  *
@@ -1002,6 +1492,122 @@ int cp_ecss_sig(bn_t e, bn_t s, uint8_t *msg, int len, bn_t d);
  */
 int cp_ecss_ver(bn_t e, bn_t s, uint8_t *msg, int len, ec_t q);
 
+/**
+ * Verifies a message signed with the Elliptic Curve Schnorr Signature using a
+ * precomputation table for the public key, built with ec_mul_pre().
+ *
+ * @param[in] e				- the first component of the signature.
+ * @param[in] s				- the second component of the signature.
+ * @param[in] msg			- the signed message.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] t				- the precomputation table for the public key.
+ * @return a boolean value indicating if the signature is valid.
+ */
+int cp_ecss_ver_pre(bn_t e, bn_t s, uint8_t *msg, int len, const ec_t *t);
+
+/**
+ * Generates an EdDSA key pair.
+ *
+ * @param[out] k			- the private key with RLC_FP_BYTES bytes.
+ * @param[out] q			- the public key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_eddsa_gen(uint8_t *k, ed_t q);
+
+/**
+ * Signs a message using EdDSA.
+ *
+ * @param[out] r			- the first component of the signature.
+ * @param[out] s			- the second component of the signature.
+ * @param[in] msg			- the message to sign.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] k				- the private key.
+ * @param[in] q				- the public key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_eddsa_sig(ed_t r, bn_t s, uint8_t *msg, int len, uint8_t *k, ed_t q);
+
+/**
+ * Verifies a message signed with EdDSA. The verification equation is
+ * multiplied by the cofactor, as in RFC 8032.
+ *
+ * @param[in] r				- the first component of the signature.
+ * @param[in] s				- the second component of the signature.
+ * @param[in] msg			- the signed message.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] q				- the public key.
+ * @return a boolean value indicating if the signature is valid.
+ */
+int cp_eddsa_ver(ed_t r, bn_t s, uint8_t *msg, int len, ed_t q);
+
+/**
+ * Verifies a batch of messages signed with EdDSA using a random linear
+ * combination of the verification equations and a single multi-scalar
+ * multiplication. The combined equation is multiplied by the cofactor.
+ *
+ * @param[in] r				- the first components of the signatures.
+ * @param[in] s				- the second components of the signatures.
+ * @param[in] msgs			- the signed messages.
+ * @param[in] lens			- the message lengths in bytes.
+ * @param[in] q				- the public keys.
+ * @param[in] n				- the number of signatures.
+ * @return a boolean value indicating if all the signatures are valid.
+ */
+int cp_eddsa_ver_sim(ed_t *r, bn_t *s, uint8_t *msgs[], int lens[], ed_t *q,
+		int n);
+
+/**
+ * Allocates the entries of an empty cache of identity pairings.
+ *
+ * @param[out] c			- the cache.
+ * @param[in] m				- the capacity.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ * @throw ERR_NO_VALID		- if the capacity is not positive.
+ */
+void cp_idc_make(idc_t c, int m);
+
+/**
+ * Frees the entries of a cache of identity pairings.
+ *
+ * @param[out] c			- the cache.
+ */
+void cp_idc_clean(idc_t c);
+
+/**
+ * Binds a cache of identity pairings to the key material the pairings are
+ * computed with. The first call binds the cache until it is freed, and later
+ * calls check that the key material is the same.
+ *
+ * @param[in,out] c			- the cache.
+ * @param[in] key			- the serialized key material.
+ * @param[in] len			- the length of the key material in bytes.
+ * @return RLC_OK if the cache is bound to the same key, RLC_ERR otherwise.
+ */
+int cp_idc_bind(idc_t c, const uint8_t *key, int len);
+
+/**
+ * Looks up the pairing cached for an identity, counting the hit or miss.
+ *
+ * @param[out] e			- the cached pairing, if found.
+ * @param[in,out] c			- the cache.
+ * @param[in] id			- the identity.
+ * @param[in] len			- the length of the identity in bytes.
+ * @return 1 if the identity was found, 0 otherwise.
+ */
+int cp_idc_get(gt_t e, idc_t c, const uint8_t *id, int len);
+
+/**
+ * Stores the pairing computed for an identity, replacing the least recently
+ * used entry if the cache is full.
+ *
+ * @param[in,out] c			- the cache.
+ * @param[in] id			- the identity.
+ * @param[in] len			- the length of the identity in bytes.
+ * @param[in] e				- the pairing.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+void cp_idc_put(idc_t c, const uint8_t *id, int len, gt_t e);
+
 /**
  * Generates a master key for the SOKAKA identity-based non-interactive
  * authenticated key agreement protocol.
@@ -1037,6 +1643,24 @@ int cp_sokaka_gen_prv(sokaka_t k, char *id, int len, bn_t master);
 int cp_sokaka_key(uint8_t *key, unsigned int key_len, char *id1, int len1,
 		sokaka_t k, char *id2, int len2);
 
+/**
+ * Computes a shared key between two entities, reusing the pairing with the
+ * second identity if it is in the cache. The cache is bound to the first
+ * identity and private key of the first call, and calls with others fail.
+ *
+ * @param[out] key			- the shared key.
+ * @param[int] key_len		- the intended shared key length in bytes.
+ * @param[in] id1			- the first identity.
+ * @param[in] len1			- the length of the first identity in bytes.
+ * @param[in] k				- the private key of the first identity.
+ * @param[in] id2			- the second identity.
+ * @param[in] len2			- the length of the second identity in bytes.
+ * @param[in,out] c			- the cache of pairings with second identities.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_sokaka_key_pre(uint8_t *key, unsigned int key_len, char *id1, int len1,
+		sokaka_t k, char *id2, int len2, idc_t c);
+
 /**
  * Generates a key pair for the Boneh-Go-Nissim (BGN) cryptosystem.
  *
@@ -1056,6 +1680,48 @@ int cp_bgn_gen(bgn_t pub, bgn_t prv);
  */
 int cp_bgn_enc1(g1_t out[2], dig_t in, bgn_t pub);
 
+/**
+ * Allocates the randomizers of an empty pool for BGN encryption.
+ *
+ * @param[out] p			- the pool.
+ * @param[in] m				- the capacity in each group.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ * @throw ERR_NO_VALID		- if the capacity is not positive.
+ */
+void cp_bgn_pool_make(bgn_pool_t p, int m);
+
+/**
+ * Frees the randomizers of a pool for BGN encryption.
+ *
+ * @param[out] p			- the pool.
+ */
+void cp_bgn_pool_clean(bgn_pool_t p);
+
+/**
+ * Fills a pool with randomizers for BGN encryption in G_1 and G_2 under the
+ * given public key. The pool can be refilled by one thread while others
+ * encrypt. The first refill binds the pool to the public key until it is
+ * freed, and refills under other keys fail.
+ *
+ * @param[in,out] p			- the pool.
+ * @param[in] pub			- the public key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bgn_pre(bgn_pool_t p, bgn_t pub);
+
+/**
+ * Encrypts in G_1 using the BGN cryptosystem and a randomizer taken from a
+ * pool filled for the same public key. Encryption fails if the pool is bound
+ * to another public key.
+ *
+ * @param[out] out			- the ciphertext.
+ * @param[in] in			- the plaintext as a small integer.
+ * @param[in] pub			- the public key.
+ * @param[in,out] p			- the pool of randomizers.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bgn_enc1_pre(g1_t out[2], dig_t in, bgn_t pub, bgn_pool_t p);
+
 /**
  * Decrypts in G_1 using the BGN cryptosystem.
  *
@@ -1066,6 +1732,30 @@ int cp_bgn_enc1(g1_t out[2], dig_t in, bgn_t pub);
  */
 int cp_bgn_dec1(dig_t *out, g1_t in[2], bgn_t prv);
 
+/**
+ * Fills a baby-step table for decrypting BGN ciphertexts in G_1 with the
+ * given private key. The table size is fixed when the table is allocated.
+ *
+ * @param[out] t			- the baby-step table.
+ * @param[in] prv 			- the private key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bgn_tab1(pc_dlog_t t, bgn_t prv);
+
+/**
+ * Decrypts in G_1 using the BGN cryptosystem and a baby-step table, for
+ * plaintexts smaller than the given bound.
+ *
+ * @param[out] out 			- the decrypted small integer.
+ * @param[in] in 			- the ciphertext.
+ * @param[in] prv 			- the private key.
+ * @param[in] t				- the baby-step table, or NULL.
+ * @param[in] bound			- the bound on the plaintext.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bgn_dec1_tab(dig_t *out, g1_t in[2], bgn_t prv, const pc_dlog_t t,
+		dig_t bound);
+
 /**
  * Encrypts in G_2 using the BGN cryptosystem.
  *
@@ -1076,6 +1766,19 @@ int cp_bgn_dec1(dig_t *out, g1_t in[2], bgn_t prv);
  */
 int cp_bgn_enc2(g2_t out[2], dig_t in, bgn_t pub);
 
+/**
+ * Encrypts in G_2 using the BGN cryptosystem and a randomizer taken from a
+ * pool filled for the same public key. Encryption fails if the pool is bound
+ * to another public key.
+ *
+ * @param[out] out			- the ciphertext.
+ * @param[in] in			- the plaintext as a small integer.
+ * @param[in] pub			- the public key.
+ * @param[in,out] p			- the pool of randomizers.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bgn_enc2_pre(g2_t out[2], dig_t in, bgn_t pub, bgn_pool_t p);
+
 /**
  * Decrypts in G_2 using the BGN cryptosystem.
  *
@@ -1086,6 +1789,30 @@ int cp_bgn_enc2(g2_t out[2], dig_t in, bgn_t pub);
  */
 int cp_bgn_dec2(dig_t *out, g2_t in[2], bgn_t prv);
 
+/**
+ * Fills a baby-step table for decrypting BGN ciphertexts in G_2 with the
+ * given private key. The table size is fixed when the table is allocated.
+ *
+ * @param[out] t			- the baby-step table.
+ * @param[in] prv 			- the private key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bgn_tab2(pc_dlog_t t, bgn_t prv);
+
+/**
+ * Decrypts in G_2 using the BGN cryptosystem and a baby-step table, for
+ * plaintexts smaller than the given bound.
+ *
+ * @param[out] out 			- the decrypted small integer.
+ * @param[in] in 			- the ciphertext.
+ * @param[in] prv 			- the private key.
+ * @param[in] t				- the baby-step table, or NULL.
+ * @param[in] bound			- the bound on the plaintext.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bgn_dec2_tab(dig_t *out, g2_t in[2], bgn_t prv, const pc_dlog_t t,
+		dig_t bound);
+
 /**
  * Adds homomorphically two BGN ciphertexts in G_T.
  *
@@ -1116,6 +1843,30 @@ int cp_bgn_mul(gt_t e[4], g1_t c[2], g2_t d[2]);
  */
 int cp_bgn_dec(dig_t *out, gt_t in[4], bgn_t prv);
 
+/**
+ * Fills a baby-step table for decrypting BGN ciphertexts in G_T with the
+ * given private key. The table size is fixed when the table is allocated.
+ *
+ * @param[out] t			- the baby-step table.
+ * @param[in] prv 			- the private key.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bgn_tab(pc_dlog_t t, bgn_t prv);
+
+/**
+ * Decrypts in G_T using the BGN cryptosystem and a baby-step table, for
+ * plaintexts smaller than the given bound.
+ *
+ * @param[out] out 			- the decrypted small integer.
+ * @param[in] in 			- the ciphertext.
+ * @param[in] prv 			- the private key.
+ * @param[in] t				- the baby-step table, or NULL.
+ * @param[in] bound			- the bound on the plaintext.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_bgn_dec_tab(dig_t *out, gt_t in[4], bgn_t prv, const pc_dlog_t t,
+		dig_t bound);
+
 /**
  * Generates a master key for a Private Key Generator (PKG) in the
  * Boneh-Franklin Identity-Based Encryption (BF-IBE).
@@ -1150,6 +1901,24 @@ int cp_ibe_gen_prv(g2_t prv, char *id, int len, bn_t master);
 int cp_ibe_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len,
 		char *id, int len, g1_t pub);
 
+/**
+ * Encrypts a message using the BF-IBE protocol, reusing the pairing of the
+ * public key with the identity if it is in the cache. The cache is bound to
+ * the public key of the first call, and calls with other keys fail.
+ *
+ * @param[out] out			- the output buffer.
+ * @param[in, out] out_len	- the buffer capacity and number of bytes written.
+ * @param[in] in			- the input buffer.
+ * @param[in] in_len		- the number of bytes to encrypt.
+ * @param[in] id			- the identity.
+ * @param[in] len			- the length of the identity in bytes.
+ * @param[in] pub			- the public key of the PKG.
+ * @param[in,out] c			- the cache of pairings with identities.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_ibe_enc_pre(uint8_t *out, int *out_len, uint8_t *in, int in_len,
+		char *id, int len, g1_t pub, idc_t c);
+
 /**
  * Decrypts a message using the BF-IBE protocol.
  *
@@ -1355,7 +2124,8 @@ int cp_clb_sig(g1_t a, g1_t A[], g1_t b, g1_t B[], g1_t c, uint8_t *msgs[],
 		int lens[], bn_t t, bn_t u, bn_t v[], int l);
 
 /**
- * Verifies a block of messages signed using the CLB protocol.
+ * Verifies a block of messages signed using the CLB protocol. The verification
+ * equations are combined with random weights into a single multi-pairing.
  *
  * @param[out] a			- the first component of the signature.
  * @param[out] A			- the (l - 1) next components of the signature.
@@ -1413,6 +2183,24 @@ int cp_pss_sig(g1_t a, g1_t b, uint8_t *msg, int len, bn_t u, bn_t v);
  */
 int cp_pss_ver(g1_t a, g1_t b, uint8_t *msg, int len, g2_t g, g2_t x, g2_t y);
 
+/**
+ * Verifies a batch of signatures using the PSS protocol under the same public
+ * key, using a random linear combination of the verification equations and a
+ * single multi-pairing.
+ *
+ * @param[in] a				- the first parts of the signatures.
+ * @param[in] b				- the second parts of the signatures.
+ * @param[in] msgs			- the signed messages.
+ * @param[in] lens			- the message lengths in bytes.
+ * @param[in] g				- the first part of the public key.
+ * @param[in] x				- the second part of the public key.
+ * @param[in] y				- the third part of the public key.
+ * @param[in] n				- the number of signatures.
+ * @return a boolean value indicating if all the signatures are valid.
+ */
+int cp_pss_ver_sim(g1_t a[], g1_t b[], uint8_t *msgs[], int lens[], g2_t g,
+		g2_t x, g2_t y, int n);
+
 /**
  * Generates a key pair for the Pointcheval-Sanders block signature (PSB)
  * protocol.
@@ -1457,6 +2245,25 @@ int cp_psb_sig(g1_t a, g1_t b, uint8_t *msgs[], int lens[], bn_t r, bn_t s[],
 int cp_psb_ver(g1_t a, g1_t b, uint8_t *msgs[], int lens[], g2_t g, g2_t x,
 		g2_t y[], int l);
 
+/**
+ * Verifies a batch of signatures on blocks of messages using the PSB protocol
+ * under the same public key, using a random linear combination of the
+ * verification equations and a single multi-pairing of l + 2 pairings.
+ *
+ * @param[in] a				- the first components of the signatures.
+ * @param[in] b				- the second components of the signatures.
+ * @param[in] msgs			- the n blocks of l signed messages.
+ * @param[in] lens			- the n blocks of l message lengths in bytes.
+ * @param[in] g				- the first part of the public key.
+ * @param[in] x				- the second part of the public key.
+ * @param[in] y				- the remaining l parts of the public key.
+ * @param[in] l 			- the number of messages in each block.
+ * @param[in] n				- the number of signatures.
+ * @return a boolean value indicating if all the signatures are valid.
+ */
+int cp_psb_ver_sim(g1_t a[], g1_t b[], uint8_t **msgs[], int *lens[], g2_t g,
+		g2_t x, g2_t y[], int l, int n);
+
 /**
  * Generates a Zhang-Safavi-Naini-Susilo (ZSS) key pair.
  *
@@ -1544,6 +2351,23 @@ int cp_vbnn_sig(ec_t r, bn_t z, bn_t h, uint8_t *id, int id_len, uint8_t *msg,
 int cp_vbnn_ver(ec_t r, bn_t z, bn_t h, uint8_t *id, int id_len, uint8_t *msg,
 		int msg_len, ec_t mpk);
 
+/**
+ * Verifies a signature and message using the vBNN-IBS scheme and a
+ * precomputation table for the master public key, built with ec_mul_pre().
+ *
+ * @param[in] r				- the R value of the signature.
+ * @param[in] z 			- the z value of the signature.
+ * @param[in] h 			- the h value of the signature.
+ * @param[in] id 			- the identity buffer.
+ * @param[in] id_len 		- the size of identity buffer.
+ * @param[in] msg 			- the signed message buffer.
+ * @param[in] msg_len 		- the size of message buffer.
+ * @param[in] t				- the table for the master public key.
+ * @return a boolean value indicating if the signature is valid.
+ */
+int cp_vbnn_ver_pre(ec_t r, bn_t z, bn_t h, uint8_t *id, int id_len,
+		uint8_t *msg, int msg_len, const ec_t *t);
+
 /**
  * Initialize the Context-hiding Multi-key Homomorphic Signature scheme (CMLHS).
  * The scheme due to Schabhuser et al. signs a vector of messages.
@@ -1621,7 +2445,8 @@ int cp_cmlhs_fun(g1_t a, g1_t c, g1_t as[], g1_t cs[], dig_t f[], int len);
 int cp_cmlhs_evl(g1_t r, g2_t s, g1_t rs[], g2_t ss[], dig_t f[], int len);
 
 /**
- * Verifies a CMLHS signature over a set of messages.
+ * Verifies a CMLHS signature over a set of messages. The pairing equations are
+ * combined with random weights into a single multi-pairing.
  *
  * @param[in] r 			- the first component of the homomorphic signature.
  * @param[in] s 			- the second component of the homomorphic signature.
@@ -1679,6 +2504,18 @@ int cp_mklhs_sig(g1_t s, bn_t m, char *label, int len, bn_t sk);
  */
 int cp_mklhs_fun(bn_t mu, bn_t m[], dig_t f[], int len);
 
+/**
+ * Applies a function with full-width coefficients over a set of messages from
+ * the same user.
+ *
+ * @param[out] mu			- the combined message.
+ * @param[in] m				- the vector of individual messages.
+ * @param[in] f 			- the linear coefficients in the function.
+ * @param[in] len			- the number of coefficients.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_mklhs_fun_lot(bn_t mu, bn_t m[], bn_t f[], int len);
+
 /**
  * Evaluates a function over a set of MKLHS signatures.
  *
@@ -1689,6 +2526,18 @@ int cp_mklhs_fun(bn_t mu, bn_t m[], dig_t f[], int len);
  */
 int cp_mklhs_evl(g1_t sig, g1_t s[], dig_t f[], int len);
 
+/**
+ * Evaluates a function with full-width coefficients over a set of MKLHS
+ * signatures using a multi-scalar multiplication.
+ *
+ * @param[out] sig			- the resulting signature
+ * @param[in] s				- the set of signatures.
+ * @param[in] f 			- the linear coefficients in the function.
+ * @param[in] len			- the number of coefficients.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+int cp_mklhs_evl_lot(g1_t sig, g1_t s[], bn_t f[], int len);
+
 /**
  * Verifies a MKLHS signature over a set of messages.
  *
@@ -1706,4 +2555,22 @@ int cp_mklhs_evl(g1_t sig, g1_t s[], dig_t f[], int len);
 int cp_mklhs_ver(g1_t sig, bn_t m, bn_t mu[], char *label[], int llen[],
 		dig_t f[][RLC_TERMS], int flen[], g2_t pk[], int slen);
 
+/**
+ * Verifies a MKLHS signature over a set of messages, for functions with
+ * full-width coefficients and any number of labels.
+ *
+ * @param[in] sig 			- the homomorphic signature to verify.
+ * @param[in] m 			- the signed message.
+ * @param[in] mu			- the vector of signed messages per user.
+ * @param[in] label 		- the vector of labels.
+ * @param[in] llen 			- the vector of label lengths.
+ * @param[in] f 			- the linear coefficients in the function, per user.
+ * @param[in] flen			- the number of coefficients.
+ * @param[in] pk 			- the public keys of the users.
+ * @param[in] slen 			- the number of signatures.
+ * @return a boolean value indicating the verification result.
+ */
+int cp_mklhs_ver_lot(g1_t sig, bn_t m, bn_t mu[], char *label[], int llen[],
+		bn_t *f[], int flen[], g2_t pk[], int slen);
+
 #endif /* !RLC_CP_H */
@@ -771,6 +771,17 @@ void ed_mul_sim_joint(ed_t r, const ed_t p, const bn_t k, const ed_t q,
  */
 void ed_mul_sim_gen(ed_t r, const bn_t k, const ed_t q, const bn_t m);
 
+/**
+ * Multiplies and adds multiple Edwards elliptic curve points simultaneously
+ * using interleaved w-NAF recodings. Computes R = \sum k_iP_i.
+ *
+ * @param[out] r      - the result.
+ * @param[in] p       - the points to multiply.
+ * @param[in] k       - the integer scalars, possibly negative.
+ * @param[in] n       - the number of points to multiply.
+ */
+void ed_mul_sim_lot(ed_t r, const ed_t *p, const bn_t *k, int n);
+
 /**
  * Builds a precomputation table for multiplying a random Edwards elliptic point.
  *
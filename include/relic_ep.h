@@ -201,6 +201,21 @@ enum {
 #define RLC_EP_TABLE_MAX 	RLC_MAX(RLC_EP_TABLE_BASIC, RLC_EP_TABLE_COMBD)
 #endif
 
+/**
+ * Maximum depth of a precomputation table built at runtime.
+ */
+#define RLC_EP_DEPTH_MAX		16
+
+/**
+ * Version of the format of persisted precomputation tables.
+ */
+#define RLC_EP_PRE_VER		1
+
+/**
+ * Number of bytes in the header of a persisted precomputation table.
+ */
+#define RLC_EP_PRE_HDR		64
+
 /*============================================================================*/
 /* Type definitions                                                           */
 /*============================================================================*/
@@ -228,6 +243,24 @@ typedef ep_st ep_t[1];
 typedef ep_st *ep_t;
 #endif
 
+/**
+ * Represents a precomputation table for multiplying a fixed prime elliptic
+ * curve point, with the depth of the comb chosen at runtime.
+ */
+typedef struct {
+	/** The depth of the comb. */
+	int depth;
+	/** The number of precomputed points. */
+	int size;
+	/** The precomputed points. */
+	ep_t *t;
+} ep_pre_st;
+
+/**
+ * Pointer to a precomputation table.
+ */
+typedef ep_pre_st *ep_pre_t;
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -286,6 +319,50 @@ typedef ep_st *ep_t;
 
 #endif
 
+/**
+ * Initializes a precomputation table with a null value.
+ *
+ * @param[out] T			- the table to initialize.
+ */
+#define ep_pre_null(T)		T = NULL;
+
+/**
+ * Allocates a precomputation table for a comb of the given depth.
+ *
+ * @param[out] T			- the new table.
+ * @param[in] D				- the depth of the comb.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ * @throw ERR_NO_VALID		- if the depth is not supported.
+ */
+#define ep_pre_new(T, D)													\
+	T = (ep_pre_t)calloc(1, sizeof(ep_pre_st));								\
+	if (T == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	} else {																\
+		TRY {																\
+			ep_pre_make(T, D);												\
+		} CATCH_ANY {														\
+			ep_pre_free(T);													\
+			THROW(ERR_CAUGHT);												\
+		}																	\
+		/* Without error checking, a failed table is left empty. */			\
+		if (T != NULL && T->t == NULL) {									\
+			ep_pre_free(T);													\
+		}																	\
+	}																		\
+
+/**
+ * Cleans and frees a precomputation table.
+ *
+ * @param[out] T			- the table to free.
+ */
+#define ep_pre_free(T)														\
+	if (T != NULL) {														\
+		ep_pre_clean(T);													\
+		free(T);															\
+		T = NULL;															\
+	}																		\
+
 /**
  * Negates a prime elliptic curve point. Computes R = -P.
  *
@@ -502,6 +579,41 @@ void ep_curve_get_gen(ep_t g);
  */
 const ep_t *ep_curve_get_tab(void);
 
+/**
+ * Returns the number of bytes necessary to persist the precomputation table
+ * for the generator, or zero if tables cannot be persisted in this
+ * configuration.
+ *
+ * @return the number of bytes.
+ */
+int ep_curve_size_pre(void);
+
+/**
+ * Writes the precomputation table for the generator to a versioned and
+ * checksummed byte vector that can be later mapped with ep_curve_map_pre().
+ * The format depends on the library configuration and host architecture.
+ *
+ * @param[out] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ * @throw ERR_NO_CONFIG		- if tables cannot be persisted.
+ */
+void ep_curve_write_pre(uint8_t *bin, int len);
+
+/**
+ * Registers a persisted precomputation table to be used in place, instead of
+ * being recomputed whenever the curve with the same generator is configured.
+ * The byte vector is never written to, so it can be mapped read-only, but it
+ * must remain valid until another table is registered or the library is
+ * finalized. A null pointer unregisters the table. The table can be registered
+ * before the module is set up, and is then used once the curve is configured.
+ *
+ * @param[in] bin			- the byte vector, aligned to a digit.
+ * @param[in] len			- the number of bytes in the vector.
+ * @return RLC_OK if the table was registered, RLC_ERR otherwise.
+ */
+int ep_curve_map_pre(const uint8_t *bin, int len);
+
 /**
  * Returns the order of the group of points in the prime elliptic curve.
  *
@@ -695,6 +807,65 @@ void ep_tab(ep_t *t, const ep_t p, int w);
  */
 void ep_print(const ep_t p);
 
+/**
+ * Allocates the points of a precomputation table for a comb of the given
+ * depth.
+ *
+ * @param[out] t			- the table.
+ * @param[in] d				- the depth of the comb.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ * @throw ERR_NO_VALID		- if the depth is not supported.
+ */
+void ep_pre_make(ep_pre_t t, int d);
+
+/**
+ * Frees the points of a precomputation table.
+ *
+ * @param[out] t			- the table.
+ */
+void ep_pre_clean(ep_pre_t t);
+
+/**
+ * Returns the number of bytes of memory used by a precomputation table.
+ *
+ * @param[in] t				- the table.
+ * @return the number of bytes.
+ */
+int ep_pre_mem(const ep_pre_t t);
+
+/**
+ * Returns the number of bytes necessary to store a precomputation table.
+ *
+ * @param[in] t				- the table.
+ * @param[in] pack			- the flag to indicate point compression.
+ * @return the number of bytes.
+ */
+int ep_pre_size_bin(const ep_pre_t t, int pack);
+
+/**
+ * Reads a precomputation table from a byte vector, resizing the table if the
+ * stored depth differs.
+ *
+ * @param[out] t			- the table.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @throw ERR_NO_VALID		- if the table was built for another curve or has
+ * 							an invalid point.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ */
+void ep_pre_read_bin(ep_pre_t t, const uint8_t *bin, int len);
+
+/**
+ * Writes a precomputation table to a byte vector.
+ *
+ * @param[out] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @param[in] t				- the table to write.
+ * @param[in] pack			- the flag to indicate point compression.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ */
+void ep_pre_write_bin(uint8_t *bin, int len, const ep_pre_t t, int pack);
+
 /**
  * Returns the number of bytes necessary to store a prime elliptic curve point
  * with optional point compression.
@@ -793,6 +964,17 @@ void ep_sub_basic(ep_t r, const ep_t p, const ep_t q);
  */
 void ep_sub_projc(ep_t r, const ep_t p, const ep_t q);
 
+/**
+ * Adds many pairs of prime elliptic curve points represented in affine
+ * coordinates, sharing a single inversion among all the additions.
+ *
+ * @param[out] r			- the results, in affine coordinates.
+ * @param[in] p				- the first points to add.
+ * @param[in] q				- the second points to add.
+ * @param[in] n				- the number of pairs.
+ */
+void ep_add_sim(ep_t *r, const ep_t *p, const ep_t *q, int n);
+
 /**
  * Doubles a prime elliptic curve point represented in affine coordinates.
  *
@@ -997,6 +1179,25 @@ void ep_mul_fix_combd(ep_t r, const ep_t *t, const bn_t k);
  */
 void ep_mul_fix_lwnaf(ep_t r, const ep_t *t, const bn_t k);
 
+/**
+ * Builds a precomputation table for multiplying a fixed prime elliptic point
+ * using the single-table comb method with the depth of the table.
+ *
+ * @param[out] t			- the precomputation table.
+ * @param[in] p				- the point to multiply.
+ */
+void ep_mul_pre_dynam(ep_pre_t t, const ep_t p);
+
+/**
+ * Multiplies a fixed prime elliptic point using a precomputation table built
+ * at runtime and the single-table comb method.
+ *
+ * @param[out] r			- the result.
+ * @param[in] t				- the precomputation table.
+ * @param[in] k				- the integer.
+ */
+void ep_mul_fix_dynam(ep_t r, const ep_pre_t t, const bn_t k);
+
 /**
  * Multiplies and adds two prime elliptic curve points simultaneously using
  * scalar multiplication and point addition.
@@ -1071,6 +1272,18 @@ void ep_mul_sim_gen(ep_t r, const bn_t k, const ep_t q, const bn_t m);
  */
 void ep_mul_sim_dig(ep_t r, const ep_t p[], dig_t k[], int len);
 
+/**
+ * Multiplies and adds multiple prime elliptic curve points simultaneously.
+ * Computes R = \sum k_iP_i with interleaved w-NAF recodings or, for many
+ * points, with the bucket method.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars, possibly negative.
+ * @param[in] n				- the number of points to multiply.
+ */
+void ep_mul_sim_lot(ep_t r, const ep_t *p, const bn_t *k, int n);
+
 /**
  * Converts a point to affine coordinates.
  *
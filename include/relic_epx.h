@@ -116,6 +116,25 @@ typedef ep2_st ep2_t[1];
 typedef ep2_st *ep2_t;
 #endif
 
+/**
+ * Represents a precomputation table for multiplying a fixed point in an
+ * elliptic curve over a quadratic extension, with the depth of the comb
+ * chosen at runtime.
+ */
+typedef struct {
+	/** The depth of the comb. */
+	int depth;
+	/** The number of precomputed points. */
+	int size;
+	/** The precomputed points. */
+	ep2_t *t;
+} ep2_pre_st;
+
+/**
+ * Pointer to a precomputation table.
+ */
+typedef ep2_pre_st *ep2_pre_t;
+
 /**
  * Represents an elliptic curve point over a cubic extension over a prime
  * field.
@@ -207,6 +226,50 @@ typedef ep3_st *ep3_t;
 #define ep2_free(A)				A = NULL;
 #endif
 
+/**
+ * Initializes a precomputation table with a null value.
+ *
+ * @param[out] T			- the table to initialize.
+ */
+#define ep2_pre_null(T)		T = NULL;
+
+/**
+ * Allocates a precomputation table for a comb of the given depth.
+ *
+ * @param[out] T			- the new table.
+ * @param[in] D				- the depth of the comb.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ * @throw ERR_NO_VALID		- if the depth is not supported.
+ */
+#define ep2_pre_new(T, D)													\
+	T = (ep2_pre_t)calloc(1, sizeof(ep2_pre_st));							\
+	if (T == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	} else {																\
+		TRY {																\
+			ep2_pre_make(T, D);												\
+		} CATCH_ANY {														\
+			ep2_pre_free(T);												\
+			THROW(ERR_CAUGHT);												\
+		}																	\
+		/* Without error checking, a failed table is left empty. */			\
+		if (T != NULL && T->t == NULL) {									\
+			ep2_pre_free(T);												\
+		}																	\
+	}																		\
+
+/**
+ * Cleans and frees a precomputation table.
+ *
+ * @param[out] T			- the table to free.
+ */
+#define ep2_pre_free(T)														\
+	if (T != NULL) {														\
+		ep2_pre_clean(T);													\
+		free(T);															\
+		T = NULL;															\
+	}																		\
+
 /**
  * Negates a point in an elliptic curve over a quadratic extension field.
  * Computes R = -P.
@@ -403,6 +466,37 @@ void ep2_curve_get_gen(ep2_t g);
  */
 ep2_t *ep2_curve_get_tab(void);
 
+/**
+ * Returns the number of bytes necessary to persist the precomputation table
+ * for the generator, or zero if tables cannot be persisted in this
+ * configuration.
+ *
+ * @return the number of bytes.
+ */
+int ep2_curve_size_pre(void);
+
+/**
+ * Writes the precomputation table for the generator to a versioned and
+ * checksummed byte vector that can be later mapped with ep2_curve_map_pre().
+ *
+ * @param[out] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ * @throw ERR_NO_CONFIG		- if tables cannot be persisted.
+ */
+void ep2_curve_write_pre(uint8_t *bin, int len);
+
+/**
+ * Registers a persisted precomputation table to be used in place whenever the
+ * curve with the same generator is configured. A null pointer unregisters the
+ * table.
+ *
+ * @param[in] bin			- the byte vector, aligned to a digit.
+ * @param[in] len			- the number of bytes in the vector.
+ * @return RLC_OK if the table was registered, RLC_ERR otherwise.
+ */
+int ep2_curve_map_pre(const uint8_t *bin, int len);
+
 /**
  * Returns the order of the group of points in the elliptic curve.
  *
@@ -506,6 +600,65 @@ void ep2_tab(ep2_t *t, ep2_t p, int w);
  */
 void ep2_print(ep2_t p);
 
+/**
+ * Allocates the points of a precomputation table for a comb of the given
+ * depth.
+ *
+ * @param[out] t			- the table.
+ * @param[in] d				- the depth of the comb.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ * @throw ERR_NO_VALID		- if the depth is not supported.
+ */
+void ep2_pre_make(ep2_pre_t t, int d);
+
+/**
+ * Frees the points of a precomputation table.
+ *
+ * @param[out] t			- the table.
+ */
+void ep2_pre_clean(ep2_pre_t t);
+
+/**
+ * Returns the number of bytes of memory used by a precomputation table.
+ *
+ * @param[in] t				- the table.
+ * @return the number of bytes.
+ */
+int ep2_pre_mem(ep2_pre_t t);
+
+/**
+ * Returns the number of bytes necessary to store a precomputation table.
+ *
+ * @param[in] t				- the table.
+ * @param[in] pack			- the flag to indicate point compression.
+ * @return the number of bytes.
+ */
+int ep2_pre_size_bin(ep2_pre_t t, int pack);
+
+/**
+ * Reads a precomputation table from a byte vector, resizing the table if the
+ * stored depth differs.
+ *
+ * @param[out] t			- the table.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @throw ERR_NO_VALID		- if the table was built for another curve or has
+ * 							an invalid point.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ */
+void ep2_pre_read_bin(ep2_pre_t t, const uint8_t *bin, int len);
+
+/**
+ * Writes a precomputation table to a byte vector.
+ *
+ * @param[out] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @param[in] t				- the table to write.
+ * @param[in] pack			- the flag to indicate point compression.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ */
+void ep2_pre_write_bin(uint8_t *bin, int len, ep2_pre_t t, int pack);
+
 /**
  * Returns the number of bytes necessary to store a prime elliptic curve point
  * over a quadratic extension with optional point compression.
@@ -609,6 +762,18 @@ void ep2_add_projc(ep2_t r, ep2_t p, ep2_t q);
  */
 void ep2_sub_projc(ep2_t r, ep2_t p, ep2_t q);
 
+/**
+ * Adds many pairs of points in an elliptic curve over a quadratic extension
+ * represented in affine coordinates, sharing a single inversion among all the
+ * additions.
+ *
+ * @param[out] r			- the results, in affine coordinates.
+ * @param[in] p				- the first points to add.
+ * @param[in] q				- the second points to add.
+ * @param[in] n				- the number of pairs.
+ */
+void ep2_add_sim(ep2_t *r, ep2_t *p, ep2_t *q, int n);
+
 /**
  * Doubles a points represented in affine coordinates in an elliptic curve over
  * a quadratic extension.
@@ -815,6 +980,26 @@ void ep2_mul_fix_combd(ep2_t r, ep2_t *t, bn_t k);
  */
 void ep2_mul_fix_lwnaf(ep2_t r, ep2_t *t, bn_t k);
 
+/**
+ * Builds a precomputation table for multiplying a fixed prime elliptic point
+ * over a quadratic extension using the single-table comb method with the depth
+ * of the table.
+ *
+ * @param[out] t			- the precomputation table.
+ * @param[in] p				- the point to multiply.
+ */
+void ep2_mul_pre_dynam(ep2_pre_t t, ep2_t p);
+
+/**
+ * Multiplies a fixed prime elliptic point over a quadratic extension using a
+ * precomputation table built at runtime and the single-table comb method.
+ *
+ * @param[out] r			- the result.
+ * @param[in] t				- the precomputation table.
+ * @param[in] k				- the integer.
+ */
+void ep2_mul_fix_dynam(ep2_t r, ep2_pre_t t, bn_t k);
+
 /**
  * Multiplies and adds two prime elliptic curve points simultaneously using
  * scalar multiplication and point addition.
@@ -885,6 +1070,17 @@ void ep2_mul_sim_gen(ep2_t r, bn_t k, ep2_t q, bn_t m);
  */
 void ep2_mul_sim_dig(ep2_t r, ep2_t p[], dig_t k[], int len);
 
+/**
+ * Multiplies and adds multiple prime elliptic curve points simultaneously
+ * using interleaved w-NAF recodings. Computes R = \sum k_iP_i.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars, possibly negative.
+ * @param[in] n				- the number of points to multiply.
+ */
+void ep2_mul_sim_lot(ep2_t r, ep2_t *p, const bn_t *k, int n);
+
 /**
  * Converts a point to affine coordinates.
  *
@@ -169,6 +169,17 @@ typedef dig_t *fb_t;
  */
 typedef rlc_align dig_t fb_st[RLC_FB_DIGS + RLC_PAD(RLC_FB_BYTES) / (RLC_DIG / 8)];
 
+/**
+ * Represents the precomputed tables of a binary field, which are allocated
+ * apart from the library context and can be shared among contexts.
+ */
+typedef struct _fb_pre_st fb_pre_st;
+
+/**
+ * Pointer to the precomputed tables of a binary field.
+ */
+typedef fb_pre_st *fb_pre_t;
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -184,6 +195,34 @@ typedef rlc_align dig_t fb_st[RLC_FB_DIGS + RLC_PAD(RLC_FB_BYTES) / (RLC_DIG / 8
 #define fb_null(A)			A = NULL;
 #endif
 
+/**
+ * Initializes the precomputed tables of a binary field with a null value.
+ *
+ * @param[out] T			- the tables to initialize.
+ */
+#define fb_pre_null(T)		T = NULL;
+
+/**
+ * Allocates the precomputed tables of a binary field.
+ *
+ * @param[out] T			- the new tables.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+#define fb_pre_new(T)														\
+	T = (fb_pre_t)calloc(1, sizeof(fb_pre_st));								\
+	if (T == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+
+/**
+ * Frees the precomputed tables of a binary field.
+ *
+ * @param[out] T			- the tables to free.
+ */
+#define fb_pre_free(T)														\
+	free(T);																\
+	T = NULL;																\
+
 /**
  * Calls a function to allocate a binary field element.
  *
@@ -481,6 +520,31 @@ void fb_poly_get_trc(int *a, int *b, int *c);
  */
 const dig_t *fb_poly_get_slv(void);
 
+/**
+ * Builds the precomputed tables for the configured binary field, used for
+ * half-traces, square roots and repeated squarings.
+ *
+ * @param[out] t			- the tables to build.
+ */
+void fb_poly_pre_build(fb_pre_t t);
+
+/**
+ * Makes the current library context use tables built by fb_poly_pre_build()
+ * instead of its own, so they can be shared. The tables must not be freed
+ * while in use. A null pointer returns to the tables owned by the context.
+ *
+ * @param[in] t				- the tables to use.
+ * @throw ERR_NO_VALID		- if the tables were built for another field.
+ */
+void fb_poly_pre_set(fb_pre_t t);
+
+/**
+ * Returns the precomputed tables used by the current library context.
+ *
+ * @return the tables, or NULL if the binary field is not configured.
+ */
+fb_pre_t fb_poly_pre_get(void);
+
 /**
  * Assigns a standard irreducible polynomial as modulo of the binary field.
  *
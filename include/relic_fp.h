@@ -60,6 +60,12 @@
  */
 #define RLC_FP_BYTES 	((int)RLC_CEIL(RLC_FP_BITS, 8))
 
+/**
+ * Size in 52-bit limbs of a prime field element inside a batch of eight
+ * elements, leaving room for lazy reduction.
+ */
+#define RLC_FP_X8_DIGS	((FP_PRIME + 2) / 52 + 1)
+
 /*
  * Finite field identifiers.
  */
@@ -172,6 +178,15 @@ typedef dig_t *fp_t;
  */
 typedef rlc_align dig_t fp_st[RLC_FP_DIGS + RLC_PAD(RLC_FP_BYTES)/(RLC_DIG / 8)];
 
+/**
+ * Represents a batch of eight prime field elements.
+ *
+ * Elements are stored in radix 2^52 and interleaved, so that the i-th limb of
+ * the k-th element is at position 8 * i + k. This matches the lanes of 512-bit
+ * vector registers.
+ */
+typedef rlc_align uint64_t fp_x8_t[8 * RLC_FP_X8_DIGS];
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -1069,4 +1084,54 @@ void fp_exp_monty(fp_t c, const fp_t a, const bn_t b);
  */
 int fp_srt(fp_t c, const fp_t a);
 
+/**
+ * Returns whether the batched prime field arithmetic uses AVX-512 IFMA
+ * instructions on the running processor.
+ *
+ * @return					- 1 if vector instructions are used, 0 otherwise.
+ */
+int fp_x8_is_vec(void);
+
+/**
+ * Converts eight prime field elements to a batch.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the eight prime field elements to convert.
+ */
+void fp_x8_conv(fp_x8_t c, const fp_t *a);
+
+/**
+ * Converts a batch back to eight prime field elements.
+ *
+ * @param[out] c			- the eight prime field elements.
+ * @param[in] a				- the batch to convert.
+ */
+void fp_x8_back(fp_t *c, const fp_x8_t a);
+
+/**
+ * Adds two batches of prime field elements, element by element.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first batch to add.
+ * @param[in] b				- the second batch to add.
+ */
+void fp_add_x8(fp_x8_t c, const fp_x8_t a, const fp_x8_t b);
+
+/**
+ * Multiplies two batches of prime field elements, element by element.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first batch to multiply.
+ * @param[in] b				- the second batch to multiply.
+ */
+void fp_mul_x8(fp_x8_t c, const fp_x8_t a, const fp_x8_t b);
+
+/**
+ * Squares a batch of prime field elements, element by element.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the batch to square.
+ */
+void fp_sqr_x8(fp_x8_t c, const fp_x8_t a);
+
 #endif /* !RLC_FP_H */
@@ -2300,6 +2300,15 @@ void fp6_sqr_lazyr(fp6_t c, fp6_t a);
  */
 void fp6_inv(fp6_t c, fp6_t a);
 
+/**
+ * Inverts multiple sextic extension field elements simultaneously.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the sextic extension field elements to invert.
+ * @param[in] n				- the number of elements.
+ */
+void fp6_inv_sim(fp6_t *c, fp6_t *a, int n);
+
 /**
  * Computes a power of a sextic extension field element. Computes c = a^b.
  *
@@ -2880,7 +2889,8 @@ void fp12_print(fp12_t a);
 
 /**
  * Returns the number of bytes necessary to store a dodecic extension field
- * element.
+ * element. A compression flag of 1 selects cyclotomic compression and a flag
+ * of 2 selects torus-based compression, when available.
  *
  * @param[in] a				- the extension field element.
  * @param[in] pack			- the flag to indicate compression.
@@ -2890,24 +2900,27 @@ int fp12_size_bin(fp12_t a, int pack);
 
 /**
  * Reads a dodecic extension field element from a byte vector in big-endian
- * format.
+ * format. The compression format is inferred from the buffer length.
  *
  * @param[out] a			- the result.
  * @param[in] bin			- the byte vector.
  * @param[in] len			- the buffer capacity.
  * @throw ERR_NO_BUFFER		- if the buffer capacity is not correct.
+ * @throw ERR_NO_VALID		- if the encoded element cannot be decompressed.
  */
 void fp12_read_bin(fp12_t a, const uint8_t *bin, int len);
 
 /**
  * Writes a dodecic extension field element to a byte vector in big-endian
- * format.
+ * format. When compression is requested, the buffer length selects between
+ * torus-based and cyclotomic compression.
  *
  * @param[out] bin			- the byte vector.
  * @param[in] len			- the buffer capacity.
  * @param[in] a				- the extension field element to write.
  * @param[in] pack			- the flag to indicate compression.
  * @throw ERR_NO_BUFFER		- if the buffer capacity is not correct.
+ * @throw ERR_NO_VALID		- if the element cannot be compressed to the torus.
  */
 void fp12_write_bin(uint8_t *bin, int len, fp12_t a, int pack);
 
@@ -3220,6 +3233,39 @@ void fp12_pck(fp12_t c, fp12_t a);
  */
 int fp12_upk(fp12_t c, fp12_t a);
 
+/**
+ * Compresses a dodecic extension field element using torus-based compression.
+ * Cyclotomic elements are mapped to the torus T6 and represented by two
+ * quadratic extension field elements, falling back to cyclotomic compression
+ * when this is not possible.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the dodecic extension field element to compress.
+ */
+void fp12_pck_max(fp12_t c, fp12_t a);
+
+/**
+ * Decompresses a dodecic extension field element compressed with torus-based
+ * compression.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the dodecic extension field element to decompress.
+ * @return if the decompression was successful
+ */
+int fp12_upk_max(fp12_t c, fp12_t a);
+
+/**
+ * Decompresses multiple dodecic extension field elements compressed with
+ * torus-based compression, sharing a single inversion. Elements that fail to
+ * decompress are set to the identity.
+ *
+ * @param[out] c			- the results.
+ * @param[in] a				- the dodecic extension field elements to decompress.
+ * @param[in] n				- the number of elements.
+ * @return if all the decompressions were successful
+ */
+int fp12_upk_max_sim(fp12_t *c, fp12_t *a, int n);
+
 /**
  * Copies the second argument to the first argument.
  *
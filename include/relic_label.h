@@ -50,14 +50,22 @@
 #define core_ctx	PREFIX(core_ctx)
 
 #undef core_init
+#undef core_init_with
+#undef core_init_mod
 #undef core_clean
 #undef core_get
 #undef core_set
+#undef core_cnt_get
+#undef core_cnt_reset
 
 #define core_init 	PREFIX(core_init)
+#define core_init_with 	PREFIX(core_init_with)
+#define core_init_mod 	PREFIX(core_init_mod)
 #define core_clean 	PREFIX(core_clean)
 #define core_get 	PREFIX(core_get)
 #define core_set 	PREFIX(core_set)
+#define core_cnt_get 	PREFIX(core_cnt_get)
+#define core_cnt_reset 	PREFIX(core_cnt_reset)
 
 #undef arch_init
 #undef arch_clean
@@ -69,21 +77,35 @@
 #define arch_cycles 	PREFIX(arch_cycles)
 #define arch_copy_rom 	PREFIX(arch_copy_rom)
 
+#undef bench_init
+#undef bench_clean
+#undef bench_output
 #undef bench_overhead
 #undef bench_reset
+#undef bench_reset_label
 #undef bench_before
 #undef bench_after
 #undef bench_compute
 #undef bench_print
 #undef bench_total
+#undef bench_stat
+#undef bench_event
+#undef bench_running
 
+#define bench_init 	PREFIX(bench_init)
+#define bench_clean 	PREFIX(bench_clean)
+#define bench_output 	PREFIX(bench_output)
 #define bench_overhead 	PREFIX(bench_overhead)
 #define bench_reset 	PREFIX(bench_reset)
+#define bench_reset_label 	PREFIX(bench_reset_label)
 #define bench_before 	PREFIX(bench_before)
 #define bench_after 	PREFIX(bench_after)
 #define bench_compute 	PREFIX(bench_compute)
 #define bench_print 	PREFIX(bench_print)
 #define bench_total 	PREFIX(bench_total)
+#define bench_stat 	PREFIX(bench_stat)
+#define bench_event 	PREFIX(bench_event)
+#define bench_running 	PREFIX(bench_running)
 
 #undef err_simple_msg
 #undef err_full_msg
@@ -119,6 +141,9 @@
 #undef util_conv_char
 #undef util_bits_dig
 #undef util_cmp_const
+#undef util_hash
+#undef util_hash_put
+#undef util_hash_get
 #undef util_printf
 #undef util_print_dig
 
@@ -128,6 +153,9 @@
 #define util_conv_char 	PREFIX(util_conv_char)
 #define util_bits_dig 	PREFIX(util_bits_dig)
 #define util_cmp_const 	PREFIX(util_cmp_const)
+#define util_hash 	PREFIX(util_hash)
+#define util_hash_put 	PREFIX(util_hash_put)
+#define util_hash_get 	PREFIX(util_hash_get)
 #define util_printf 	PREFIX(util_printf)
 #define util_print_dig 	PREFIX(util_print_dig)
 
@@ -232,6 +260,8 @@
 #undef bn_mxp_slide
 #undef bn_mxp_monty
 #undef bn_mxp_dig
+#undef bn_mxp_sim
+#undef bn_mxp_sim_const
 #undef bn_srt
 #undef bn_gcd_basic
 #undef bn_gcd_lehme
@@ -334,6 +364,8 @@
 #define bn_mxp_slide 	PREFIX(bn_mxp_slide)
 #define bn_mxp_monty 	PREFIX(bn_mxp_monty)
 #define bn_mxp_dig 	PREFIX(bn_mxp_dig)
+#define bn_mxp_sim 	PREFIX(bn_mxp_sim)
+#define bn_mxp_sim_const 	PREFIX(bn_mxp_sim_const)
 #define bn_srt 	PREFIX(bn_srt)
 #define bn_gcd_basic 	PREFIX(bn_gcd_basic)
 #define bn_gcd_lehme 	PREFIX(bn_gcd_lehme)
@@ -498,6 +530,12 @@
 #undef fp_exp_slide
 #undef fp_exp_monty
 #undef fp_srt
+#undef fp_x8_is_vec
+#undef fp_x8_conv
+#undef fp_x8_back
+#undef fp_add_x8
+#undef fp_mul_x8
+#undef fp_sqr_x8
 
 #define fp_prime_init 	PREFIX(fp_prime_init)
 #define fp_prime_clean 	PREFIX(fp_prime_clean)
@@ -580,6 +618,12 @@
 #define fp_exp_slide 	PREFIX(fp_exp_slide)
 #define fp_exp_monty 	PREFIX(fp_exp_monty)
 #define fp_srt 	PREFIX(fp_srt)
+#define fp_x8_is_vec 	PREFIX(fp_x8_is_vec)
+#define fp_x8_conv 	PREFIX(fp_x8_conv)
+#define fp_x8_back 	PREFIX(fp_x8_back)
+#define fp_add_x8 	PREFIX(fp_add_x8)
+#define fp_mul_x8 	PREFIX(fp_mul_x8)
+#define fp_sqr_x8 	PREFIX(fp_sqr_x8)
 
 #undef fp_add1_low
 #undef fp_addn_low
@@ -611,6 +655,8 @@
 #undef fp_rdcs_low
 #undef fp_rdcn_low
 #undef fp_invn_low
+#undef fp_adx_low
+#undef fp_adx_low_set
 
 #define fp_add1_low 	PREFIX(fp_add1_low)
 #define fp_addn_low 	PREFIX(fp_addn_low)
@@ -642,6 +688,11 @@
 #define fp_rdcs_low 	PREFIX(fp_rdcs_low)
 #define fp_rdcn_low 	PREFIX(fp_rdcn_low)
 #define fp_invn_low 	PREFIX(fp_invn_low)
+#define fp_adx_low 	PREFIX(fp_adx_low)
+#define fp_adx_low_set 	PREFIX(fp_adx_low_set)
+
+#undef fp_rdcn_gen
+#define fp_rdcn_gen	PREFIX(fp_rdcn_gen)
 
 #undef fp_st
 #undef fp_t
@@ -661,6 +712,9 @@
 #undef fb_poly_get_rdc
 #undef fb_poly_get_trc
 #undef fb_poly_get_slv
+#undef fb_poly_pre_build
+#undef fb_poly_pre_set
+#undef fb_poly_pre_get
 #undef fb_param_set
 #undef fb_param_set_any
 #undef fb_param_print
@@ -732,6 +786,9 @@
 #define fb_poly_get_rdc 	PREFIX(fb_poly_get_rdc)
 #define fb_poly_get_trc 	PREFIX(fb_poly_get_trc)
 #define fb_poly_get_slv 	PREFIX(fb_poly_get_slv)
+#define fb_poly_pre_build 	PREFIX(fb_poly_pre_build)
+#define fb_poly_pre_set 	PREFIX(fb_poly_pre_set)
+#define fb_poly_pre_get 	PREFIX(fb_poly_pre_get)
 #define fb_param_set 	PREFIX(fb_param_set)
 #define fb_param_set_any 	PREFIX(fb_param_set_any)
 #define fb_param_print 	PREFIX(fb_param_print)
@@ -859,6 +916,9 @@
 #undef ep_curve_is_pairf
 #undef ep_curve_get_gen
 #undef ep_curve_get_tab
+#undef ep_curve_size_pre
+#undef ep_curve_write_pre
+#undef ep_curve_map_pre
 #undef ep_curve_get_ord
 #undef ep_curve_get_cof
 #undef ep_curve_set_plain
@@ -883,6 +943,12 @@
 #undef ep_is_valid
 #undef ep_tab
 #undef ep_print
+#undef ep_pre_make
+#undef ep_pre_clean
+#undef ep_pre_mem
+#undef ep_pre_size_bin
+#undef ep_pre_read_bin
+#undef ep_pre_write_bin
 #undef ep_size_bin
 #undef ep_read_bin
 #undef ep_write_bin
@@ -893,6 +959,7 @@
 #undef ep_add_projc
 #undef ep_sub_basic
 #undef ep_sub_projc
+#undef ep_add_sim
 #undef ep_dbl_basic
 #undef ep_dbl_slp_basic
 #undef ep_dbl_projc
@@ -915,12 +982,15 @@
 #undef ep_mul_fix_combs
 #undef ep_mul_fix_combd
 #undef ep_mul_fix_lwnaf
+#undef ep_mul_pre_dynam
+#undef ep_mul_fix_dynam
 #undef ep_mul_sim_basic
 #undef ep_mul_sim_trick
 #undef ep_mul_sim_inter
 #undef ep_mul_sim_joint
 #undef ep_mul_sim_gen
 #undef ep_mul_sim_dig
+#undef ep_mul_sim_lot
 #undef ep_norm
 #undef ep_norm_sim
 #undef ep_map
@@ -941,6 +1011,9 @@
 #define ep_curve_is_pairf 	PREFIX(ep_curve_is_pairf)
 #define ep_curve_get_gen 	PREFIX(ep_curve_get_gen)
 #define ep_curve_get_tab 	PREFIX(ep_curve_get_tab)
+#define ep_curve_size_pre 	PREFIX(ep_curve_size_pre)
+#define ep_curve_write_pre 	PREFIX(ep_curve_write_pre)
+#define ep_curve_map_pre 	PREFIX(ep_curve_map_pre)
 #define ep_curve_get_ord 	PREFIX(ep_curve_get_ord)
 #define ep_curve_get_cof 	PREFIX(ep_curve_get_cof)
 #define ep_curve_set_plain 	PREFIX(ep_curve_set_plain)
@@ -965,6 +1038,12 @@
 #define ep_is_valid 	PREFIX(ep_is_valid)
 #define ep_tab 	PREFIX(ep_tab)
 #define ep_print 	PREFIX(ep_print)
+#define ep_pre_make 	PREFIX(ep_pre_make)
+#define ep_pre_clean 	PREFIX(ep_pre_clean)
+#define ep_pre_mem 	PREFIX(ep_pre_mem)
+#define ep_pre_size_bin 	PREFIX(ep_pre_size_bin)
+#define ep_pre_read_bin 	PREFIX(ep_pre_read_bin)
+#define ep_pre_write_bin 	PREFIX(ep_pre_write_bin)
 #define ep_size_bin 	PREFIX(ep_size_bin)
 #define ep_read_bin 	PREFIX(ep_read_bin)
 #define ep_write_bin 	PREFIX(ep_write_bin)
@@ -975,6 +1054,7 @@
 #define ep_add_projc 	PREFIX(ep_add_projc)
 #define ep_sub_basic 	PREFIX(ep_sub_basic)
 #define ep_sub_projc 	PREFIX(ep_sub_projc)
+#define ep_add_sim 	PREFIX(ep_add_sim)
 #define ep_dbl_basic 	PREFIX(ep_dbl_basic)
 #define ep_dbl_slp_basic 	PREFIX(ep_dbl_slp_basic)
 #define ep_dbl_projc 	PREFIX(ep_dbl_projc)
@@ -997,12 +1077,15 @@
 #define ep_mul_fix_combs 	PREFIX(ep_mul_fix_combs)
 #define ep_mul_fix_combd 	PREFIX(ep_mul_fix_combd)
 #define ep_mul_fix_lwnaf 	PREFIX(ep_mul_fix_lwnaf)
+#define ep_mul_pre_dynam 	PREFIX(ep_mul_pre_dynam)
+#define ep_mul_fix_dynam 	PREFIX(ep_mul_fix_dynam)
 #define ep_mul_sim_basic 	PREFIX(ep_mul_sim_basic)
 #define ep_mul_sim_trick 	PREFIX(ep_mul_sim_trick)
 #define ep_mul_sim_inter 	PREFIX(ep_mul_sim_inter)
 #define ep_mul_sim_joint 	PREFIX(ep_mul_sim_joint)
 #define ep_mul_sim_gen 	PREFIX(ep_mul_sim_gen)
 #define ep_mul_sim_dig 	PREFIX(ep_mul_sim_dig)
+#define ep_mul_sim_lot 	PREFIX(ep_mul_sim_lot)
 #define ep_norm 	PREFIX(ep_norm)
 #define ep_norm_sim 	PREFIX(ep_norm_sim)
 #define ep_map 	PREFIX(ep_map)
@@ -1066,6 +1149,7 @@
 #undef ed_mul_sim_inter
 #undef ed_mul_sim_joint
 #undef ed_mul_sim_gen
+#undef ed_mul_sim_lot
 #undef ed_tab
 #undef ed_print
 #undef ed_is_valid
@@ -1132,6 +1216,7 @@
 #define ed_mul_sim_inter 	PREFIX(ed_mul_sim_inter)
 #define ed_mul_sim_joint 	PREFIX(ed_mul_sim_joint)
 #define ed_mul_sim_gen 	PREFIX(ed_mul_sim_gen)
+#define ed_mul_sim_lot 	PREFIX(ed_mul_sim_lot)
 #define ed_tab 	PREFIX(ed_tab)
 #define ed_print 	PREFIX(ed_print)
 #define ed_is_valid 	PREFIX(ed_is_valid)
@@ -1309,6 +1394,9 @@
 #undef ep2_curve_is_twist
 #undef ep2_curve_get_gen
 #undef ep2_curve_get_tab
+#undef ep2_curve_size_pre
+#undef ep2_curve_write_pre
+#undef ep2_curve_map_pre
 #undef ep2_curve_get_ord
 #undef ep2_curve_get_cof
 #undef ep2_curve_set
@@ -1322,6 +1410,12 @@
 #undef ep2_is_valid
 #undef ep2_tab
 #undef ep2_print
+#undef ep2_pre_make
+#undef ep2_pre_clean
+#undef ep2_pre_mem
+#undef ep2_pre_size_bin
+#undef ep2_pre_read_bin
+#undef ep2_pre_write_bin
 #undef ep2_size_bin
 #undef ep2_read_bin
 #undef ep2_write_bin
@@ -1332,6 +1426,7 @@
 #undef ep2_sub_basic
 #undef ep2_add_projc
 #undef ep2_sub_projc
+#undef ep2_add_sim
 #undef ep2_dbl_basic
 #undef ep2_dbl_slp_basic
 #undef ep2_dbl_projc
@@ -1354,12 +1449,15 @@
 #undef ep2_mul_fix_combs
 #undef ep2_mul_fix_combd
 #undef ep2_mul_fix_lwnaf
+#undef ep2_mul_pre_dynam
+#undef ep2_mul_fix_dynam
 #undef ep2_mul_sim_basic
 #undef ep2_mul_sim_trick
 #undef ep2_mul_sim_inter
 #undef ep2_mul_sim_joint
 #undef ep2_mul_sim_gen
 #undef ep2_mul_sim_dig
+#undef ep2_mul_sim_lot
 #undef ep2_norm
 #undef ep2_norm_sim
 #undef ep2_map
@@ -1376,6 +1474,9 @@
 #define ep2_curve_is_twist 	PREFIX(ep2_curve_is_twist)
 #define ep2_curve_get_gen 	PREFIX(ep2_curve_get_gen)
 #define ep2_curve_get_tab 	PREFIX(ep2_curve_get_tab)
+#define ep2_curve_size_pre 	PREFIX(ep2_curve_size_pre)
+#define ep2_curve_write_pre 	PREFIX(ep2_curve_write_pre)
+#define ep2_curve_map_pre 	PREFIX(ep2_curve_map_pre)
 #define ep2_curve_get_ord 	PREFIX(ep2_curve_get_ord)
 #define ep2_curve_get_cof 	PREFIX(ep2_curve_get_cof)
 #define ep2_curve_set 	PREFIX(ep2_curve_set)
@@ -1389,6 +1490,12 @@
 #define ep2_is_valid 	PREFIX(ep2_is_valid)
 #define ep2_tab 	PREFIX(ep2_tab)
 #define ep2_print 	PREFIX(ep2_print)
+#define ep2_pre_make 	PREFIX(ep2_pre_make)
+#define ep2_pre_clean 	PREFIX(ep2_pre_clean)
+#define ep2_pre_mem 	PREFIX(ep2_pre_mem)
+#define ep2_pre_size_bin 	PREFIX(ep2_pre_size_bin)
+#define ep2_pre_read_bin 	PREFIX(ep2_pre_read_bin)
+#define ep2_pre_write_bin 	PREFIX(ep2_pre_write_bin)
 #define ep2_size_bin 	PREFIX(ep2_size_bin)
 #define ep2_read_bin 	PREFIX(ep2_read_bin)
 #define ep2_write_bin 	PREFIX(ep2_write_bin)
@@ -1399,6 +1506,7 @@
 #define ep2_sub_basic 	PREFIX(ep2_sub_basic)
 #define ep2_add_projc 	PREFIX(ep2_add_projc)
 #define ep2_sub_projc 	PREFIX(ep2_sub_projc)
+#define ep2_add_sim 	PREFIX(ep2_add_sim)
 #define ep2_dbl_basic 	PREFIX(ep2_dbl_basic)
 #define ep2_dbl_slp_basic 	PREFIX(ep2_dbl_slp_basic)
 #define ep2_dbl_projc 	PREFIX(ep2_dbl_projc)
@@ -1421,12 +1529,15 @@
 #define ep2_mul_fix_combs 	PREFIX(ep2_mul_fix_combs)
 #define ep2_mul_fix_combd 	PREFIX(ep2_mul_fix_combd)
 #define ep2_mul_fix_lwnaf 	PREFIX(ep2_mul_fix_lwnaf)
+#define ep2_mul_pre_dynam 	PREFIX(ep2_mul_pre_dynam)
+#define ep2_mul_fix_dynam 	PREFIX(ep2_mul_fix_dynam)
 #define ep2_mul_sim_basic 	PREFIX(ep2_mul_sim_basic)
 #define ep2_mul_sim_trick 	PREFIX(ep2_mul_sim_trick)
 #define ep2_mul_sim_inter 	PREFIX(ep2_mul_sim_inter)
 #define ep2_mul_sim_joint 	PREFIX(ep2_mul_sim_joint)
 #define ep2_mul_sim_gen 	PREFIX(ep2_mul_sim_gen)
 #define ep2_mul_sim_dig 	PREFIX(ep2_mul_sim_dig)
+#define ep2_mul_sim_lot 	PREFIX(ep2_mul_sim_lot)
 #define ep2_norm 	PREFIX(ep2_norm)
 #define ep2_norm_sim 	PREFIX(ep2_norm_sim)
 #define ep2_map 	PREFIX(ep2_map)
@@ -1568,6 +1679,9 @@
 #define fp2_sqrm_low 	PREFIX(fp2_sqrm_low)
 #define fp2_rdcn_low 	PREFIX(fp2_rdcn_low)
 
+#undef fp2_muln_gen
+#define fp2_muln_gen	PREFIX(fp2_muln_gen)
+
 #undef fp3_field_init
 #undef fp3_copy
 #undef fp3_zero
@@ -1690,6 +1804,7 @@
 #undef fp6_sqr_basic
 #undef fp6_sqr_lazyr
 #undef fp6_inv
+#undef fp6_inv_sim
 #undef fp6_exp
 #undef fp6_frb
 
@@ -1717,6 +1832,7 @@
 #define fp6_sqr_basic 	PREFIX(fp6_sqr_basic)
 #define fp6_sqr_lazyr 	PREFIX(fp6_sqr_lazyr)
 #define fp6_inv 	PREFIX(fp6_inv)
+#define fp6_inv_sim 	PREFIX(fp6_inv_sim)
 #define fp6_exp 	PREFIX(fp6_exp)
 #define fp6_frb 	PREFIX(fp6_frb)
 
@@ -1761,6 +1877,9 @@
 #undef fp12_exp_cyc_sps
 #undef fp12_pck
 #undef fp12_upk
+#undef fp12_pck_max
+#undef fp12_upk_max
+#undef fp12_upk_max_sim
 
 #define fp12_copy 	PREFIX(fp12_copy)
 #define fp12_zero 	PREFIX(fp12_zero)
@@ -1803,6 +1922,9 @@
 #define fp12_exp_cyc_sps 	PREFIX(fp12_exp_cyc_sps)
 #define fp12_pck 	PREFIX(fp12_pck)
 #define fp12_upk 	PREFIX(fp12_upk)
+#define fp12_pck_max 	PREFIX(fp12_pck_max)
+#define fp12_upk_max 	PREFIX(fp12_upk_max)
+#define fp12_upk_max_sim 	PREFIX(fp12_upk_max_sim)
 
 #undef fp18_copy
 #undef fp18_zero
@@ -2003,13 +2125,23 @@
 #undef cp_rabin_enc
 #undef cp_rabin_dec
 #undef cp_bdpe_gen
+#undef cp_bdpe_pre
 #undef cp_bdpe_enc
 #undef cp_bdpe_dec
 #undef cp_phpe_gen
 #undef cp_phpe_enc
 #undef cp_phpe_dec
+#undef cp_phpe_add_vec
+#undef cp_phpe_scal_vec
+#undef cp_phpe_ip
+#undef cp_phpe_pool_make
+#undef cp_phpe_pool_clean
+#undef cp_phpe_pre
+#undef cp_phpe_enc_pre
 #undef cp_ecdh_gen
 #undef cp_ecdh_key
+#undef cp_x25519_gen
+#undef cp_x25519_key
 #undef cp_ecmqv_gen
 #undef cp_ecmqv_key
 #undef cp_ecies_gen
@@ -2018,23 +2150,47 @@
 #undef cp_ecdsa_gen
 #undef cp_ecdsa_sig
 #undef cp_ecdsa_ver
+#undef cp_ecdsa_ver_pre
 #undef cp_ecss_gen
 #undef cp_ecss_sig
 #undef cp_ecss_ver
+#undef cp_ecss_ver_pre
+#undef cp_eddsa_gen
+#undef cp_eddsa_sig
+#undef cp_eddsa_ver
+#undef cp_eddsa_ver_sim
+#undef cp_idc_make
+#undef cp_idc_clean
+#undef cp_idc_bind
+#undef cp_idc_get
+#undef cp_idc_put
 #undef cp_sokaka_gen
 #undef cp_sokaka_gen_prv
 #undef cp_sokaka_key
+#undef cp_sokaka_key_pre
 #undef cp_bgn_gen
 #undef cp_bgn_enc1
+#undef cp_bgn_pool_make
+#undef cp_bgn_pool_clean
+#undef cp_bgn_pre
+#undef cp_bgn_enc1_pre
 #undef cp_bgn_dec1
+#undef cp_bgn_tab1
+#undef cp_bgn_dec1_tab
 #undef cp_bgn_enc2
+#undef cp_bgn_enc2_pre
 #undef cp_bgn_dec2
+#undef cp_bgn_tab2
+#undef cp_bgn_dec2_tab
 #undef cp_bgn_add
 #undef cp_bgn_mul
 #undef cp_bgn_dec
+#undef cp_bgn_tab
+#undef cp_bgn_dec_tab
 #undef cp_ibe_gen
 #undef cp_ibe_gen_prv
 #undef cp_ibe_enc
+#undef cp_ibe_enc_pre
 #undef cp_ibe_dec
 #undef cp_bls_gen
 #undef cp_bls_sig
@@ -2054,9 +2210,11 @@
 #undef cp_pss_gen
 #undef cp_pss_sig
 #undef cp_pss_ver
+#undef cp_pss_ver_sim
 #undef cp_psb_gen
 #undef cp_psb_sig
 #undef cp_psb_ver
+#undef cp_psb_ver_sim
 #undef cp_zss_gen
 #undef cp_zss_sig
 #undef cp_zss_ver
@@ -2064,6 +2222,7 @@
 #undef cp_vbnn_gen_prv
 #undef cp_vbnn_sig
 #undef cp_vbnn_ver
+#undef cp_vbnn_ver_pre
 #undef cp_cmlhs_init
 #undef cp_cmlhs_gen
 #undef cp_cmlhs_sig
@@ -2073,8 +2232,11 @@
 #undef cp_mklhs_gen
 #undef cp_mklhs_sig
 #undef cp_mklhs_fun
+#undef cp_mklhs_fun_lot
 #undef cp_mklhs_evl
+#undef cp_mklhs_evl_lot
 #undef cp_mklhs_ver
+#undef cp_mklhs_ver_lot
 
 #define cp_rsa_gen_basic 	PREFIX(cp_rsa_gen_basic)
 #define cp_rsa_gen_quick 	PREFIX(cp_rsa_gen_quick)
@@ -2088,13 +2250,23 @@
 #define cp_rabin_enc 	PREFIX(cp_rabin_enc)
 #define cp_rabin_dec 	PREFIX(cp_rabin_dec)
 #define cp_bdpe_gen 	PREFIX(cp_bdpe_gen)
+#define cp_bdpe_pre 	PREFIX(cp_bdpe_pre)
 #define cp_bdpe_enc 	PREFIX(cp_bdpe_enc)
 #define cp_bdpe_dec 	PREFIX(cp_bdpe_dec)
 #define cp_phpe_gen 	PREFIX(cp_phpe_gen)
 #define cp_phpe_enc 	PREFIX(cp_phpe_enc)
 #define cp_phpe_dec 	PREFIX(cp_phpe_dec)
+#define cp_phpe_add_vec 	PREFIX(cp_phpe_add_vec)
+#define cp_phpe_scal_vec 	PREFIX(cp_phpe_scal_vec)
+#define cp_phpe_ip 	PREFIX(cp_phpe_ip)
+#define cp_phpe_pool_make 	PREFIX(cp_phpe_pool_make)
+#define cp_phpe_pool_clean 	PREFIX(cp_phpe_pool_clean)
+#define cp_phpe_pre 	PREFIX(cp_phpe_pre)
+#define cp_phpe_enc_pre 	PREFIX(cp_phpe_enc_pre)
 #define cp_ecdh_gen 	PREFIX(cp_ecdh_gen)
 #define cp_ecdh_key 	PREFIX(cp_ecdh_key)
+#define cp_x25519_gen 	PREFIX(cp_x25519_gen)
+#define cp_x25519_key 	PREFIX(cp_x25519_key)
 #define cp_ecmqv_gen 	PREFIX(cp_ecmqv_gen)
 #define cp_ecmqv_key 	PREFIX(cp_ecmqv_key)
 #define cp_ecies_gen 	PREFIX(cp_ecies_gen)
@@ -2103,23 +2275,47 @@
 #define cp_ecdsa_gen 	PREFIX(cp_ecdsa_gen)
 #define cp_ecdsa_sig 	PREFIX(cp_ecdsa_sig)
 #define cp_ecdsa_ver 	PREFIX(cp_ecdsa_ver)
+#define cp_ecdsa_ver_pre 	PREFIX(cp_ecdsa_ver_pre)
 #define cp_ecss_gen 	PREFIX(cp_ecss_gen)
 #define cp_ecss_sig 	PREFIX(cp_ecss_sig)
 #define cp_ecss_ver 	PREFIX(cp_ecss_ver)
+#define cp_ecss_ver_pre 	PREFIX(cp_ecss_ver_pre)
+#define cp_eddsa_gen 	PREFIX(cp_eddsa_gen)
+#define cp_eddsa_sig 	PREFIX(cp_eddsa_sig)
+#define cp_eddsa_ver 	PREFIX(cp_eddsa_ver)
+#define cp_eddsa_ver_sim 	PREFIX(cp_eddsa_ver_sim)
+#define cp_idc_make 	PREFIX(cp_idc_make)
+#define cp_idc_clean 	PREFIX(cp_idc_clean)
+#define cp_idc_bind 	PREFIX(cp_idc_bind)
+#define cp_idc_get 	PREFIX(cp_idc_get)
+#define cp_idc_put 	PREFIX(cp_idc_put)
 #define cp_sokaka_gen 	PREFIX(cp_sokaka_gen)
 #define cp_sokaka_gen_prv 	PREFIX(cp_sokaka_gen_prv)
 #define cp_sokaka_key 	PREFIX(cp_sokaka_key)
+#define cp_sokaka_key_pre 	PREFIX(cp_sokaka_key_pre)
 #define cp_bgn_gen 	PREFIX(cp_bgn_gen)
 #define cp_bgn_enc1 	PREFIX(cp_bgn_enc1)
+#define cp_bgn_pool_make 	PREFIX(cp_bgn_pool_make)
+#define cp_bgn_pool_clean 	PREFIX(cp_bgn_pool_clean)
+#define cp_bgn_pre 	PREFIX(cp_bgn_pre)
+#define cp_bgn_enc1_pre 	PREFIX(cp_bgn_enc1_pre)
 #define cp_bgn_dec1 	PREFIX(cp_bgn_dec1)
+#define cp_bgn_tab1 	PREFIX(cp_bgn_tab1)
+#define cp_bgn_dec1_tab 	PREFIX(cp_bgn_dec1_tab)
 #define cp_bgn_enc2 	PREFIX(cp_bgn_enc2)
+#define cp_bgn_enc2_pre 	PREFIX(cp_bgn_enc2_pre)
 #define cp_bgn_dec2 	PREFIX(cp_bgn_dec2)
+#define cp_bgn_tab2 	PREFIX(cp_bgn_tab2)
+#define cp_bgn_dec2_tab 	PREFIX(cp_bgn_dec2_tab)
 #define cp_bgn_add 	PREFIX(cp_bgn_add)
 #define cp_bgn_mul 	PREFIX(cp_bgn_mul)
 #define cp_bgn_dec 	PREFIX(cp_bgn_dec)
+#define cp_bgn_tab 	PREFIX(cp_bgn_tab)
+#define cp_bgn_dec_tab 	PREFIX(cp_bgn_dec_tab)
 #define cp_ibe_gen 	PREFIX(cp_ibe_gen)
 #define cp_ibe_gen_prv 	PREFIX(cp_ibe_gen_prv)
 #define cp_ibe_enc 	PREFIX(cp_ibe_enc)
+#define cp_ibe_enc_pre 	PREFIX(cp_ibe_enc_pre)
 #define cp_ibe_dec 	PREFIX(cp_ibe_dec)
 #define cp_bls_gen 	PREFIX(cp_bls_gen)
 #define cp_bls_sig 	PREFIX(cp_bls_sig)
@@ -2139,9 +2335,11 @@
 #define cp_pss_gen 	PREFIX(cp_pss_gen)
 #define cp_pss_sig 	PREFIX(cp_pss_sig)
 #define cp_pss_ver 	PREFIX(cp_pss_ver)
+#define cp_pss_ver_sim 	PREFIX(cp_pss_ver_sim)
 #define cp_psb_gen 	PREFIX(cp_psb_gen)
 #define cp_psb_sig 	PREFIX(cp_psb_sig)
 #define cp_psb_ver 	PREFIX(cp_psb_ver)
+#define cp_psb_ver_sim 	PREFIX(cp_psb_ver_sim)
 #define cp_zss_gen 	PREFIX(cp_zss_gen)
 #define cp_zss_sig 	PREFIX(cp_zss_sig)
 #define cp_zss_ver 	PREFIX(cp_zss_ver)
@@ -2149,6 +2347,7 @@
 #define cp_vbnn_gen_prv 	PREFIX(cp_vbnn_gen_prv)
 #define cp_vbnn_sig 	PREFIX(cp_vbnn_sig)
 #define cp_vbnn_ver 	PREFIX(cp_vbnn_ver)
+#define cp_vbnn_ver_pre 	PREFIX(cp_vbnn_ver_pre)
 #define cp_cmlhs_init 	PREFIX(cp_cmlhs_init)
 #define cp_cmlhs_gen 	PREFIX(cp_cmlhs_gen)
 #define cp_cmlhs_sig 	PREFIX(cp_cmlhs_sig)
@@ -2158,8 +2357,11 @@
 #define cp_mklhs_gen 	PREFIX(cp_mklhs_gen)
 #define cp_mklhs_sig 	PREFIX(cp_mklhs_sig)
 #define cp_mklhs_fun 	PREFIX(cp_mklhs_fun)
+#define cp_mklhs_fun_lot 	PREFIX(cp_mklhs_fun_lot)
 #define cp_mklhs_evl 	PREFIX(cp_mklhs_evl)
+#define cp_mklhs_evl_lot 	PREFIX(cp_mklhs_evl_lot)
 #define cp_mklhs_ver 	PREFIX(cp_mklhs_ver)
+#define cp_mklhs_ver_lot 	PREFIX(cp_mklhs_ver_lot)
 
 #endif /* LABEL */
 
@@ -85,6 +85,11 @@
  */
 #define RLC_G2_TABLE			RLC_CAT(RLC_CAT(RLC_, G2_UPPER), _TABLE_MAX)
 
+/**
+ * Number of attempts with different jumps before the kangaroo method fails.
+ */
+#define RLC_DLOG_TRIES			8
+
 /*============================================================================*/
 /* Type definitions                                                           */
 /*============================================================================*/
@@ -109,11 +114,44 @@ typedef RLC_CAT(G2_LOWER, t) g2_t;
  */
 typedef RLC_CAT(G2_LOWER, st) g2_st;
 
+/**
+ * Represents a precomputation table for multiplying a G_1 element.
+ */
+typedef RLC_CAT(G1_LOWER, pre_t) g1_pre_t;
+
+/**
+ * Represents a precomputation table for multiplying a G_2 element.
+ */
+typedef RLC_CAT(G2_LOWER, pre_t) g2_pre_t;
+
 /**
  * Represents a G_T element.
  */
 typedef RLC_CAT(GT_LOWER, t) gt_t;
 
+/**
+ * Represents a baby-step table for computing bounded discrete logarithms in
+ * G_1, G_2 or G_T. Elements are stored as fingerprints of their encodings in
+ * a hash table with linear probing.
+ */
+typedef struct {
+	/** The number of baby steps. */
+	int size;
+	/** The number of slots in the hash table, a power of two. */
+	int slots;
+	/** The fingerprint of the base element. */
+	uint64_t base;
+	/** The fingerprints stored in each slot. */
+	uint64_t *keys;
+	/** The baby step stored in each slot, or -1 if the slot is empty. */
+	int *vals;
+} pc_dlog_st;
+
+/**
+ * Pointer to a baby-step table.
+ */
+typedef pc_dlog_st *pc_dlog_t;
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -414,7 +452,9 @@ typedef RLC_CAT(GT_LOWER, t) gt_t;
 #define g2_size_bin(P, C)	RLC_CAT(G2_LOWER, size_bin)(P, C)
 
 /**
- * Returns the number of bytes necessary to store a G_T element.
+ * Returns the number of bytes necessary to store a G_T element. A compression
+ * flag of 2 selects torus-based compression, which is up to three times more
+ * compact than no compression.
  *
  * @param[in] A				- the element of G_T.
  * @param[in] C 			- the flag to indicate compression.
@@ -596,6 +636,24 @@ typedef RLC_CAT(GT_LOWER, t) gt_t;
  */
 #define g2_norm(R, P)		RLC_CAT(G2_LOWER, norm)(R, P)
 
+/**
+ * Normalizes multiple elements of G_1 simultaneously.
+ *
+ * @param[out] R			- the results.
+ * @param[in] P				- the elements to normalize.
+ * @param[in] N				- the number of elements.
+ */
+#define g1_norm_sim(R, P, N)	RLC_CAT(G1_LOWER, norm_sim)(R, P, N)
+
+/**
+ * Normalizes multiple elements of G_2 simultaneously.
+ *
+ * @param[out] R			- the results.
+ * @param[in] P				- the elements to normalize.
+ * @param[in] N				- the number of elements.
+ */
+#define g2_norm_sim(R, P, N)	RLC_CAT(G2_LOWER, norm_sim)(R, P, N)
+
 /**
  * Multiplies an element from G_1 by an integer. Computes R = kP.
  *
@@ -711,6 +769,196 @@ typedef RLC_CAT(GT_LOWER, t) gt_t;
  */
 #define g2_mul_fix(R, T, K)	RLC_CAT(G2_LOWER, mul_fix)(R, T, K)
 
+/**
+ * Initializes a precomputation table for G_1 with a null value.
+ *
+ * @param[out] T			- the table to initialize.
+ */
+#define g1_pre_null(T)		RLC_CAT(G1_LOWER, pre_null)(T)
+
+/**
+ * Initializes a precomputation table for G_2 with a null value.
+ *
+ * @param[out] T			- the table to initialize.
+ */
+#define g2_pre_null(T)		RLC_CAT(G2_LOWER, pre_null)(T)
+
+/**
+ * Allocates a precomputation table for G_1 with a comb of the given depth.
+ *
+ * @param[out] T			- the new table.
+ * @param[in] D				- the depth of the comb.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+#define g1_pre_new(T, D)	RLC_CAT(G1_LOWER, pre_new)(T, D)
+
+/**
+ * Allocates a precomputation table for G_2 with a comb of the given depth.
+ *
+ * @param[out] T			- the new table.
+ * @param[in] D				- the depth of the comb.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+#define g2_pre_new(T, D)	RLC_CAT(G2_LOWER, pre_new)(T, D)
+
+/**
+ * Cleans and frees a precomputation table for G_1.
+ *
+ * @param[out] T			- the table to free.
+ */
+#define g1_pre_free(T)		RLC_CAT(G1_LOWER, pre_free)(T)
+
+/**
+ * Cleans and frees a precomputation table for G_2.
+ *
+ * @param[out] T			- the table to free.
+ */
+#define g2_pre_free(T)		RLC_CAT(G2_LOWER, pre_free)(T)
+
+/**
+ * Initializes a baby-step table with a null value.
+ *
+ * @param[out] T			- the table to initialize.
+ */
+#define pc_dlog_null(T)		T = NULL;
+
+/**
+ * Allocates a baby-step table with the given number of baby steps.
+ *
+ * @param[out] T			- the new table.
+ * @param[in] M				- the number of baby steps.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ * @throw ERR_NO_VALID		- if the number of baby steps is not supported.
+ */
+#define pc_dlog_new(T, M)													\
+	T = (pc_dlog_t)calloc(1, sizeof(pc_dlog_st));							\
+	if (T == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	pc_dlog_make(T, M);														\
+
+/**
+ * Cleans and frees a baby-step table.
+ *
+ * @param[out] T			- the table to free.
+ */
+#define pc_dlog_free(T)														\
+	if (T != NULL) {														\
+		pc_dlog_clean(T);													\
+		free(T);															\
+		T = NULL;															\
+	}																		\
+
+/**
+ * Returns the number of bytes of memory used by a precomputation table for
+ * G_1.
+ *
+ * @param[in] T				- the table.
+ */
+#define g1_pre_mem(T)		RLC_CAT(G1_LOWER, pre_mem)(T)
+
+/**
+ * Returns the number of bytes of memory used by a precomputation table for
+ * G_2.
+ *
+ * @param[in] T				- the table.
+ */
+#define g2_pre_mem(T)		RLC_CAT(G2_LOWER, pre_mem)(T)
+
+/**
+ * Returns the number of bytes necessary to store a precomputation table for
+ * G_1.
+ *
+ * @param[in] T				- the table.
+ * @param[in] P				- the flag to indicate compression.
+ */
+#define g1_pre_size_bin(T, P)	RLC_CAT(G1_LOWER, pre_size_bin)(T, P)
+
+/**
+ * Returns the number of bytes necessary to store a precomputation table for
+ * G_2.
+ *
+ * @param[in] T				- the table.
+ * @param[in] P				- the flag to indicate compression.
+ */
+#define g2_pre_size_bin(T, P)	RLC_CAT(G2_LOWER, pre_size_bin)(T, P)
+
+/**
+ * Reads a precomputation table for G_1 from a byte vector.
+ *
+ * @param[out] T			- the table.
+ * @param[in] B				- the byte vector.
+ * @param[in] L				- the buffer capacity.
+ */
+#define g1_pre_read_bin(T, B, L)	RLC_CAT(G1_LOWER, pre_read_bin)(T, B, L)
+
+/**
+ * Reads a precomputation table for G_2 from a byte vector.
+ *
+ * @param[out] T			- the table.
+ * @param[in] B				- the byte vector.
+ * @param[in] L				- the buffer capacity.
+ */
+#define g2_pre_read_bin(T, B, L)	RLC_CAT(G2_LOWER, pre_read_bin)(T, B, L)
+
+/**
+ * Writes a precomputation table for G_1 to a byte vector.
+ *
+ * @param[out] B			- the byte vector.
+ * @param[in] L				- the buffer capacity.
+ * @param[in] T				- the table.
+ * @param[in] P				- the flag to indicate compression.
+ */
+#define g1_pre_write_bin(B, L, T, P)	RLC_CAT(G1_LOWER, pre_write_bin)(B, L, T, P)
+
+/**
+ * Writes a precomputation table for G_2 to a byte vector.
+ *
+ * @param[out] B			- the byte vector.
+ * @param[in] L				- the buffer capacity.
+ * @param[in] T				- the table.
+ * @param[in] P				- the flag to indicate compression.
+ */
+#define g2_pre_write_bin(B, L, T, P)	RLC_CAT(G2_LOWER, pre_write_bin)(B, L, T, P)
+
+/**
+ * Builds a precomputation table of runtime depth for multiplying an element
+ * from G_1.
+ *
+ * @param[out] T			- the precomputation table.
+ * @param[in] P				- the element to multiply.
+ */
+#define g1_mul_pre_dynam(T, P)	RLC_CAT(G1_LOWER, mul_pre_dynam)(T, P)
+
+/**
+ * Builds a precomputation table of runtime depth for multiplying an element
+ * from G_2.
+ *
+ * @param[out] T			- the precomputation table.
+ * @param[in] P				- the element to multiply.
+ */
+#define g2_mul_pre_dynam(T, P)	RLC_CAT(G2_LOWER, mul_pre_dynam)(T, P)
+
+/**
+ * Multiplies an element from G_1 using a precomputation table of runtime
+ * depth. Computes R = kP.
+ *
+ * @param[out] R			- the result.
+ * @param[in] T				- the precomputation table.
+ * @param[in] K				- the integer.
+ */
+#define g1_mul_fix_dynam(R, T, K)	RLC_CAT(G1_LOWER, mul_fix_dynam)(R, T, K)
+
+/**
+ * Multiplies an element from G_2 using a precomputation table of runtime
+ * depth. Computes R = kP.
+ *
+ * @param[out] R			- the result.
+ * @param[in] T				- the precomputation table.
+ * @param[in] K				- the integer.
+ */
+#define g2_mul_fix_dynam(R, T, K)	RLC_CAT(G2_LOWER, mul_fix_dynam)(R, T, K)
+
 /**
  * Multiplies simultaneously two elements from G_1. Computes R = kP + lQ.
  *
@@ -732,6 +980,16 @@ typedef RLC_CAT(GT_LOWER, t) gt_t;
  */
 #define g1_mul_sim_dig(R, P, K, L)	RLC_CAT(G1_LOWER, mul_sim_dig)(R, P, K, L)
 
+/**
+ * Multiplies and adds elements from G_1. Computes R = \sum k_iP_i.
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the elements to multiply.
+ * @param[in] K				- the integer scalars.
+ * @param[in] N				- the number of elements to multiply.
+ */
+#define g1_mul_sim_lot(R, P, K, N)	RLC_CAT(G1_LOWER, mul_sim_lot)(R, P, K, N)
+
 /**
  * Multiplies simultaneously two elements from G_2. Computes R = kP + lQ.
  *
@@ -753,6 +1011,16 @@ typedef RLC_CAT(GT_LOWER, t) gt_t;
  */
 #define g2_mul_sim_dig(R, P, K, L)	RLC_CAT(G2_LOWER, mul_sim_dig)(R, P, K, L)
 
+/**
+ * Multiplies and adds elements from G_2. Computes R = \sum k_iP_i.
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the elements to multiply.
+ * @param[in] K				- the integer scalars.
+ * @param[in] N				- the number of elements to multiply.
+ */
+#define g2_mul_sim_lot(R, P, K, N)	RLC_CAT(G2_LOWER, mul_sim_lot)(R, P, K, N)
+
 /**
  * Multiplies simultaneously two elements from G_1, where one of the is the
  * generator. Computes R = kG + lQ.
@@ -845,6 +1113,19 @@ typedef RLC_CAT(GT_LOWER, t) gt_t;
  */
 void gt_rand(gt_t a);
 
+/**
+ * Reads multiple G_T elements stored contiguously in a byte vector, sharing a
+ * single inversion among torus-compressed elements.
+ *
+ * @param[out] a			- the results.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the number of bytes used by each element.
+ * @param[in] n				- the number of elements.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is not correct.
+ * @throw ERR_NO_VALID		- if an encoded element cannot be decompressed.
+ */
+void gt_read_bin_sim(gt_t *a, const uint8_t *bin, int len, int n);
+
  /**
   * Returns the generator for the group G_T.
   *
@@ -873,4 +1154,157 @@ int g2_is_valid(g2_t a);
  */
 int gt_is_valid(gt_t a);
 
+/**
+ * Allocates the slots of a baby-step table for the given number of baby
+ * steps.
+ *
+ * @param[out] t			- the table.
+ * @param[in] m				- the number of baby steps, between 2 and 2^27.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ * @throw ERR_NO_VALID		- if the number of baby steps is not supported.
+ */
+void pc_dlog_make(pc_dlog_t t, int m);
+
+/**
+ * Frees the slots of a baby-step table.
+ *
+ * @param[out] t			- the table.
+ */
+void pc_dlog_clean(pc_dlog_t t);
+
+/**
+ * Returns the number of bytes necessary to store a baby-step table.
+ *
+ * @param[in] t				- the table.
+ * @return the number of bytes.
+ */
+int pc_dlog_size_bin(const pc_dlog_t t);
+
+/**
+ * Reads a baby-step table from a byte vector, resizing the table if the stored
+ * number of baby steps differs.
+ *
+ * @param[out] t			- the table.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ * @throw ERR_NO_VALID		- if the stored table is invalid.
+ */
+void pc_dlog_read_bin(pc_dlog_t t, const uint8_t *bin, int len);
+
+/**
+ * Writes a baby-step table to a byte vector.
+ *
+ * @param[out] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @param[in] t				- the table to write.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is invalid.
+ */
+void pc_dlog_write_bin(uint8_t *bin, int len, const pc_dlog_t t);
+
+/**
+ * Fills a baby-step table with the multiples jG of a G_1 element, for j
+ * smaller than the number of baby steps.
+ *
+ * @param[out] t			- the table.
+ * @param[in] g				- the base element.
+ */
+void g1_dlog_tab(pc_dlog_t t, g1_t g);
+
+/**
+ * Fills a baby-step table with the multiples jG of a G_2 element, for j
+ * smaller than the number of baby steps.
+ *
+ * @param[out] t			- the table.
+ * @param[in] g				- the base element.
+ */
+void g2_dlog_tab(pc_dlog_t t, g2_t g);
+
+/**
+ * Fills a baby-step table with the powers g^j of a G_T element, for j smaller
+ * than the number of baby steps.
+ *
+ * @param[out] t			- the table.
+ * @param[in] g				- the base element.
+ */
+void gt_dlog_tab(pc_dlog_t t, gt_t g);
+
+/**
+ * Computes a bounded discrete logarithm in G_1 with the baby-step giant-step
+ * method, finding 0 <= k < bound such that H = kG. If no table is given, the
+ * number of baby steps is doubled until the bound is covered, so the cost
+ * depends on k instead of the bound.
+ *
+ * @param[out] k			- the discrete logarithm.
+ * @param[in] h				- the element.
+ * @param[in] g				- the base element.
+ * @param[in] t				- the baby-step table for g, or NULL.
+ * @param[in] bound			- the bound on the discrete logarithm.
+ * @return RLC_OK if the logarithm was found, RLC_ERR otherwise.
+ */
+int g1_dlog(dig_t *k, g1_t h, g1_t g, const pc_dlog_t t, dig_t bound);
+
+/**
+ * Computes a bounded discrete logarithm in G_2 with the baby-step giant-step
+ * method, finding 0 <= k < bound such that H = kG.
+ *
+ * @param[out] k			- the discrete logarithm.
+ * @param[in] h				- the element.
+ * @param[in] g				- the base element.
+ * @param[in] t				- the baby-step table for g, or NULL.
+ * @param[in] bound			- the bound on the discrete logarithm.
+ * @return RLC_OK if the logarithm was found, RLC_ERR otherwise.
+ */
+int g2_dlog(dig_t *k, g2_t h, g2_t g, const pc_dlog_t t, dig_t bound);
+
+/**
+ * Computes a bounded discrete logarithm in G_T with the baby-step giant-step
+ * method, finding 0 <= k < bound such that h = g^k.
+ *
+ * @param[out] k			- the discrete logarithm.
+ * @param[in] h				- the element.
+ * @param[in] g				- the base element.
+ * @param[in] t				- the baby-step table for g, or NULL.
+ * @param[in] bound			- the bound on the discrete logarithm.
+ * @return RLC_OK if the logarithm was found, RLC_ERR otherwise.
+ */
+int gt_dlog(dig_t *k, gt_t h, gt_t g, const pc_dlog_t t, dig_t bound);
+
+/**
+ * Computes a bounded discrete logarithm in G_1 with Pollard's kangaroo method,
+ * finding 0 <= k < bound such that H = kG. Takes O(sqrt(bound)) operations and
+ * constant memory, but may fail with small probability.
+ *
+ * @param[out] k			- the discrete logarithm.
+ * @param[in] h				- the element.
+ * @param[in] g				- the base element.
+ * @param[in] bound			- the bound, smaller than 2^(RLC_DIG - 8).
+ * @return RLC_OK if the logarithm was found, RLC_ERR otherwise.
+ */
+int g1_dlog_kgr(dig_t *k, g1_t h, g1_t g, dig_t bound);
+
+/**
+ * Computes a bounded discrete logarithm in G_2 with Pollard's kangaroo method,
+ * finding 0 <= k < bound such that H = kG.
+ *
+ * @param[out] k			- the discrete logarithm.
+ * @param[in] h				- the element.
+ * @param[in] g				- the base element.
+ * @param[in] bound			- the bound, smaller than 2^(RLC_DIG - 8).
+ * @return RLC_OK if the logarithm was found, RLC_ERR otherwise.
+ */
+int g2_dlog_kgr(dig_t *k, g2_t h, g2_t g, dig_t bound);
+
+/**
+ * Computes a bounded discrete logarithm in G_T with Pollard's kangaroo method,
+ * finding 0 <= k < bound such that h = g^k.
+ *
+ * @param[out] k			- the discrete logarithm.
+ * @param[in] h				- the element.
+ * @param[in] g				- the base element.
+ * @param[in] bound			- the bound, smaller than 2^(RLC_DIG - 8).
+ * @return RLC_OK if the logarithm was found, RLC_ERR otherwise.
+ */
+int gt_dlog_kgr(dig_t *k, gt_t h, gt_t g, dig_t bound);
+
 #endif /* !RLC_PC_H */
@@ -227,6 +227,44 @@ int util_bits_dig(dig_t a);
  */
 int util_cmp_const(const void *a, const void *b, int n);
 
+/**
+ * Computes the 64-bit FNV-1a hash of a buffer, used as a fingerprint to index
+ * hash tables. The hash is not cryptographic.
+ *
+ * @param[in] a				- the buffer.
+ * @param[in] n				- the length in bytes of the buffer.
+ * @return the hash.
+ */
+uint64_t util_hash(const void *a, int n);
+
+/**
+ * Inserts a value in a hash table with linear probing. The number of slots
+ * must be a power of two and empty slots must hold negative values.
+ *
+ * @param[in,out] keys		- the fingerprints stored in each slot.
+ * @param[in,out] vals		- the values stored in each slot.
+ * @param[in] slots			- the number of slots.
+ * @param[in] key			- the fingerprint of the value.
+ * @param[in] val			- the non-negative value.
+ */
+void util_hash_put(uint64_t *keys, int *vals, int slots, uint64_t key,
+		int val);
+
+/**
+ * Returns the next value stored with a fingerprint in a hash table with linear
+ * probing. Distinct values may share a fingerprint, so the caller checks each
+ * candidate and calls again with the same slot to continue the search.
+ *
+ * @param[in] keys			- the fingerprints stored in each slot.
+ * @param[in] vals			- the values stored in each slot.
+ * @param[in] slots			- the number of slots.
+ * @param[in] key			- the fingerprint to search.
+ * @param[in,out] slot		- the slot of the last candidate, or -1 to start.
+ * @return the value, or -1 if there are no more candidates.
+ */
+int util_hash_get(const uint64_t *keys, const int *vals, int slots,
+		uint64_t key, int *slot);
+
 /**
  * Formats and prints data following a printf-like syntax.
  *
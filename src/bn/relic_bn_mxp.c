@@ -29,6 +29,9 @@
  * @ingroup bn
  */
 
+#include <limits.h>
+#include <string.h>
+
 #include "relic_core.h"
 
 /*============================================================================*/
@@ -40,6 +43,378 @@
  */
 #define RLC_TABLE_SIZE			64
 
+/**
+ * Allocates a vector of multiple precision integers.
+ *
+ * @param[in] len			- the number of integers.
+ * @return the vector.
+ * @throw ERR_NO_MEMORY		- if there is no available memory.
+ */
+static bn_t *mxp_vec_new(int len) {
+	bn_t *v = (bn_t *)calloc(len, sizeof(bn_t));
+
+	if (v == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return NULL;
+	}
+	for (int i = 0; i < len; i++) {
+#if ALLOC != AUTO
+		v[i] = (bn_t)calloc(1, sizeof(bn_st));
+		if (v[i] == NULL) {
+			THROW(ERR_NO_MEMORY);
+			return v;
+		}
+#endif
+		bn_init(v[i], RLC_BN_SIZE);
+	}
+	return v;
+}
+
+/**
+ * Frees a vector of multiple precision integers.
+ *
+ * @param[out] v			- the vector.
+ * @param[in] len			- the number of integers.
+ */
+static void mxp_vec_free(bn_t *v, int len) {
+	if (v != NULL) {
+		for (int i = 0; i < len; i++) {
+#if ALLOC != AUTO
+			if (v[i] != NULL) {
+				bn_clean(v[i]);
+				free(v[i]);
+			}
+#else
+			bn_clean(v[i]);
+#endif
+		}
+		free(v);
+	}
+}
+
+/**
+ * Recodes an exponent into sliding windows indexed by bit position, so that
+ * several exponents can be processed simultaneously. Each window of at most
+ * w bits is an odd value stored at the position of its least significant bit.
+ *
+ * @param[out] d			- the recoded exponent, one byte per bit position.
+ * @param[in] l				- the number of bit positions.
+ * @param[in] b				- the exponent.
+ * @param[in] w				- the window size.
+ */
+static void mxp_rec_sim(uint8_t *d, int l, const bn_t b, int w) {
+	int i, j, k;
+	uint8_t v;
+
+	memset(d, 0, l);
+	i = bn_bits(b) - 1;
+	while (i >= 0) {
+		if (bn_get_bit(b, i) == 0) {
+			i--;
+			continue;
+		}
+		/* Take the longest window ending in a one. */
+		j = RLC_MAX(i - w + 1, 0);
+		while (bn_get_bit(b, j) == 0) {
+			j++;
+		}
+		v = 0;
+		for (k = i; k >= j; k--) {
+			v = (v << 1) | bn_get_bit(b, k);
+		}
+		d[j] = v;
+		i = j - 1;
+	}
+}
+
+/**
+ * Returns the w-bit window of an exponent starting at a given bit position.
+ *
+ * @param[in] b				- the exponent.
+ * @param[in] j				- the position of the least significant bit.
+ * @param[in] w				- the window size.
+ * @return the window.
+ */
+static int mxp_get_win(const bn_t b, int j, int w) {
+	int k, v = 0;
+
+	for (k = w - 1; k >= 0; k--) {
+		v = (v << 1) | bn_get_bit(b, j + k);
+	}
+	return v;
+}
+
+/**
+ * Estimates the number of modular multiplications of the interleaved sliding
+ * window method and chooses its window size. Squarings are ignored, since
+ * they are the same for every method.
+ *
+ * @param[out] w			- the window size.
+ * @param[in] n				- the number of bases.
+ * @param[in] l				- the maximum number of bits in the exponents.
+ * @return the estimated cost.
+ */
+static int mxp_cost_win(int *w, int n, int l) {
+	int i, cost, best = INT_MAX;
+
+	for (i = 1; i <= 6; i++) {
+		/* Precomputation of odd powers and one product per window. */
+		cost = n * ((1 << (i - 1)) + l / (i + 1));
+		if (cost < best) {
+			best = cost;
+			*w = i;
+		}
+	}
+	return best;
+}
+
+/**
+ * Estimates the number of modular multiplications of the bucket method and
+ * chooses its window size.
+ *
+ * @param[out] w			- the window size.
+ * @param[in] n				- the number of bases.
+ * @param[in] l				- the maximum number of bits in the exponents.
+ * @return the estimated cost.
+ */
+static int mxp_cost_bkt(int *w, int n, int l) {
+	int i, cost, best = INT_MAX;
+
+	for (i = 1; i <= 12; i++) {
+		/* One product per base and two per bucket in each window. */
+		cost = RLC_CEIL(l, i) * (n + (1 << (i + 1)));
+		if (cost < best) {
+			best = cost;
+			*w = i;
+		}
+	}
+	return best;
+}
+
+/**
+ * Reduces the bases of a simultaneous exponentiation and converts them to the
+ * representation used by the modular reduction. Bases with negative exponents
+ * are inverted.
+ *
+ * @param[out] t			- the converted bases.
+ * @param[in] a				- the bases.
+ * @param[in] b				- the exponents.
+ * @param[in] n				- the number of bases.
+ * @param[in] m				- the modulus.
+ * @param[in] u				- the reduction precomputation.
+ * @throw ERR_NO_VALID		- if a negative exponent has a non-invertible basis.
+ */
+static void mxp_sim_pre(bn_t *t, const bn_t a[], const bn_t b[], int n,
+		const bn_t m, const bn_t u) {
+	int i;
+	bn_t g, r;
+
+	bn_null(g);
+	bn_null(r);
+
+	TRY {
+		bn_new(g);
+		bn_new(r);
+
+#if BN_MOD == MONTY
+		/* Compute R^2 mod m once, so bases enter Montgomery form with a
+		 * single reduction each. */
+		bn_set_dig(r, 1);
+		bn_mod_monty_conv(r, r, m);
+		bn_mod_monty_conv(r, r, m);
+#endif
+
+		for (i = 0; i < n; i++) {
+			bn_mod(t[i], a[i], m);
+			if (bn_sign(b[i]) == RLC_NEG) {
+				bn_gcd_ext(g, t[i], NULL, t[i], m);
+				if (bn_cmp_dig(g, 1) != RLC_EQ) {
+					THROW(ERR_NO_VALID);
+				}
+				if (bn_sign(t[i]) == RLC_NEG) {
+					bn_add(t[i], t[i], m);
+				}
+			}
+#if BN_MOD == MONTY
+			bn_mul(t[i], t[i], r);
+			bn_mod(t[i], t[i], m, u);
+#endif
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(g);
+		bn_free(r);
+	}
+}
+
+/**
+ * Computes a product of powers with interleaved sliding windows, sharing the
+ * squarings among all bases.
+ *
+ * @param[out] r			- the result, in the reduction representation.
+ * @param[in] t				- the converted bases.
+ * @param[in] b				- the exponents.
+ * @param[in] n				- the number of bases.
+ * @param[in] l				- the maximum number of bits in the exponents.
+ * @param[in] w				- the window size.
+ * @param[in] m				- the modulus.
+ * @param[in] u				- the reduction precomputation.
+ */
+static void mxp_sim_win(bn_t r, bn_t *t, const bn_t b[], int n, int l, int w,
+		const bn_t m, const bn_t u) {
+	int i, j, h = 1 << (w - 1), first = 1;
+	uint8_t *d = NULL;
+	bn_t *tab = NULL;
+
+	TRY {
+		d = (uint8_t *)malloc(n * l);
+		if (d == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		tab = mxp_vec_new(n * h);
+
+		for (i = 0; i < n; i++) {
+			/* Table holds the odd powers a^1, a^3, ..., a^(2h - 1). */
+			bn_copy(tab[i * h], t[i]);
+			bn_sqr(t[i], t[i]);
+			bn_mod(t[i], t[i], m, u);
+			for (j = 1; j < h; j++) {
+				bn_mul(tab[i * h + j], tab[i * h + j - 1], t[i]);
+				bn_mod(tab[i * h + j], tab[i * h + j], m, u);
+			}
+			mxp_rec_sim(d + i * l, l, b[i], w);
+		}
+
+		for (j = l - 1; j >= 0; j--) {
+			if (!first) {
+				bn_sqr(r, r);
+				bn_mod(r, r, m, u);
+			}
+			for (i = 0; i < n; i++) {
+				if (d[i * l + j] != 0) {
+					if (first) {
+						bn_copy(r, tab[i * h + (d[i * l + j] >> 1)]);
+						first = 0;
+					} else {
+						bn_mul(r, r, tab[i * h + (d[i * l + j] >> 1)]);
+						bn_mod(r, r, m, u);
+					}
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		mxp_vec_free(tab, n * h);
+		free(d);
+	}
+}
+
+/**
+ * Computes a product of powers with the bucket method. In each window, the
+ * bases are accumulated in the bucket indexed by their exponent digit and the
+ * buckets are then combined with running products.
+ *
+ * @param[out] r			- the result, in the reduction representation.
+ * @param[in] t				- the converted bases.
+ * @param[in] b				- the exponents.
+ * @param[in] n				- the number of bases.
+ * @param[in] l				- the maximum number of bits in the exponents.
+ * @param[in] w				- the window size.
+ * @param[in] m				- the modulus.
+ * @param[in] u				- the reduction precomputation.
+ */
+static void mxp_sim_bkt(bn_t r, bn_t *t, const bn_t b[], int n, int l, int w,
+		const bn_t m, const bn_t u) {
+	int i, j, k, v, h = (1 << w), first = 1, fs, ft;
+	uint8_t *f = NULL;
+	bn_t *bkt = NULL, s, z;
+
+	bn_null(s);
+	bn_null(z);
+
+	TRY {
+		bn_new(s);
+		bn_new(z);
+		f = (uint8_t *)malloc(h);
+		if (f == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		bkt = mxp_vec_new(h);
+
+		for (k = RLC_CEIL(l, w) - 1; k >= 0; k--) {
+			if (!first) {
+				for (j = 0; j < w; j++) {
+					bn_sqr(r, r);
+					bn_mod(r, r, m, u);
+				}
+			}
+
+			/* Flags mark the non-empty buckets, to avoid products by one. */
+			memset(f, 0, h);
+			for (i = 0; i < n; i++) {
+				v = mxp_get_win(b[i], k * w, w);
+				if (v != 0) {
+					if (f[v]) {
+						bn_mul(bkt[v], bkt[v], t[i]);
+						bn_mod(bkt[v], bkt[v], m, u);
+					} else {
+						bn_copy(bkt[v], t[i]);
+						f[v] = 1;
+					}
+				}
+			}
+
+			/* Compute z = prod_j bkt[j]^j as a product of running products. */
+			fs = ft = 0;
+			for (j = h - 1; j > 0; j--) {
+				if (f[j]) {
+					if (fs) {
+						bn_mul(s, s, bkt[j]);
+						bn_mod(s, s, m, u);
+					} else {
+						bn_copy(s, bkt[j]);
+						fs = 1;
+					}
+				}
+				if (fs) {
+					if (ft) {
+						bn_mul(z, z, s);
+						bn_mod(z, z, m, u);
+					} else {
+						bn_copy(z, s);
+						ft = 1;
+					}
+				}
+			}
+
+			if (ft) {
+				if (first) {
+					bn_copy(r, z);
+					first = 0;
+				} else {
+					bn_mul(r, r, z);
+					bn_mod(r, r, m, u);
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		mxp_vec_free(bkt, h);
+		free(f);
+		bn_free(s);
+		bn_free(z);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -365,3 +740,148 @@ void bn_mxp_dig(bn_t c, const bn_t a, dig_t b, const bn_t m) {
 		bn_free(r);
 	}
 }
+
+void bn_mxp_sim(bn_t c, const bn_t a[], const bn_t b[], int n, const bn_t m) {
+	int i, l = 0, w, v;
+	bn_t *t = NULL, u, r;
+
+	if (n <= 0) {
+		bn_set_dig(c, 1);
+		return;
+	}
+
+	for (i = 0; i < n; i++) {
+		l = RLC_MAX(l, bn_bits(b[i]));
+	}
+	if (l == 0) {
+		bn_set_dig(c, 1);
+		return;
+	}
+
+	bn_null(u);
+	bn_null(r);
+
+	TRY {
+		bn_new(u);
+		bn_new(r);
+		t = mxp_vec_new(n);
+
+		bn_mod_pre(u, m);
+		mxp_sim_pre(t, a, b, n, m, u);
+
+		/* Interleaved windows pay a table per base, buckets pay a table per
+		 * window, so buckets are only chosen for many bases. */
+		if (mxp_cost_bkt(&v, n, l) < mxp_cost_win(&w, n, l)) {
+			mxp_sim_bkt(r, t, b, n, l, v, m, u);
+		} else {
+			mxp_sim_win(r, t, b, n, l, w, m, u);
+		}
+
+		bn_trim(r);
+#if BN_MOD == MONTY
+		bn_mod_monty_back(c, r, m);
+#else
+		bn_copy(c, r);
+#endif
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		mxp_vec_free(t, n);
+		bn_free(u);
+		bn_free(r);
+	}
+}
+
+void bn_mxp_sim_const(bn_t c, const bn_t a[], const bn_t b[], int n,
+		const bn_t m) {
+	int i, j, k, l = 0, w = 1, h, v, cost, best = INT_MAX;
+	dig_t mask;
+	bn_t *t = NULL, *tab = NULL, u, r, s;
+
+	if (n <= 0) {
+		bn_set_dig(c, 1);
+		return;
+	}
+
+	/* Process every digit of the exponents, so that the sequence of
+	 * operations only depends on their lengths in digits. */
+	for (i = 0; i < n; i++) {
+		l = RLC_MAX(l, b[i]->used * RLC_DIG);
+	}
+	for (i = 1; i <= 6; i++) {
+		cost = n * ((1 << i) + l / i);
+		if (cost < best) {
+			best = cost;
+			w = i;
+		}
+	}
+	h = 1 << w;
+
+	bn_null(u);
+	bn_null(r);
+	bn_null(s);
+
+	TRY {
+		bn_new(u);
+		bn_new(r);
+		bn_new(s);
+		t = mxp_vec_new(n);
+		tab = mxp_vec_new(n * h);
+
+		bn_mod_pre(u, m);
+		mxp_sim_pre(t, a, b, n, m, u);
+
+		bn_set_dig(r, 1);
+#if BN_MOD == MONTY
+		bn_mod_monty_conv(r, r, m);
+#endif
+		for (i = 0; i < n; i++) {
+			/* Table holds all the powers a^0, a^1, ..., a^(h - 1). */
+			bn_copy(tab[i * h], r);
+			bn_copy(tab[i * h + 1], t[i]);
+			for (j = 2; j < h; j++) {
+				bn_mul(tab[i * h + j], tab[i * h + j - 1], t[i]);
+				bn_mod(tab[i * h + j], tab[i * h + j], m, u);
+			}
+		}
+
+		for (k = RLC_CEIL(l, w) - 1; k >= 0; k--) {
+			for (j = 0; j < w; j++) {
+				bn_sqr(r, r);
+				bn_mod(r, r, m, u);
+			}
+			for (i = 0; i < n; i++) {
+				v = mxp_get_win(b[i], k * w, w);
+				/* Scan the whole table to hide the window being used. */
+				bn_zero(s);
+				for (j = 0; j < h; j++) {
+					mask = -(dig_t)(j == v);
+					dv_copy_cond(s->dp, tab[i * h + j]->dp, RLC_BN_DIGS,
+							j == v);
+					s->used ^= (s->used ^ tab[i * h + j]->used) & mask;
+				}
+				bn_mul(r, r, s);
+				bn_mod(r, r, m, u);
+			}
+		}
+
+		bn_trim(r);
+#if BN_MOD == MONTY
+		bn_mod_monty_back(c, r, m);
+#else
+		bn_copy(c, r);
+#endif
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		mxp_vec_free(tab, n * h);
+		mxp_vec_free(t, n);
+		bn_free(u);
+		bn_free(r);
+		bn_free(s);
+	}
+}
@@ -39,10 +39,86 @@
 #include "relic_cp.h"
 #include "relic_md.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Largest number of powers stored in the decryption table. Larger block sizes
+ * are handled with baby steps and giant steps.
+ */
+#define BDPE_TABLE		(1 << 12)
+
+/**
+ * Computes the fingerprint of a multiple precision integer from its digits.
+ *
+ * @param[in] a				- the integer.
+ * @return the fingerprint.
+ */
+static uint64_t bdpe_key(bn_t a) {
+	bn_trim(a);
+	return util_hash(a->dp, a->used * (int)sizeof(dig_t));
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
+int cp_bdpe_pre(bdpe_t prv) {
+	int j, result = RLC_OK;
+	bn_t t, u;
+
+	bn_null(t);
+	bn_null(u);
+
+	TRY {
+		bn_new(t);
+		bn_new(u);
+
+		/* Compute x = y^((p-1)(q-1)/block). */
+		bn_sub_dig(t, prv->p, 1);
+		bn_sub_dig(u, prv->q, 1);
+		bn_mul(t, t, u);
+		bn_div_dig(t, t, prv->t);
+		bn_mxp(prv->x, prv->y, t, prv->n);
+
+		free(prv->keys);
+		free(prv->vals);
+		prv->size = (int)RLC_MIN(prv->t, (dig_t)BDPE_TABLE);
+		for (prv->slots = 1; prv->slots < 2 * prv->size; prv->slots <<= 1);
+		prv->keys = (uint64_t *)malloc(prv->slots * sizeof(uint64_t));
+		prv->vals = (int *)malloc(prv->slots * sizeof(int));
+		if (prv->keys == NULL || prv->vals == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		memset(prv->vals, 0xFF, prv->slots * sizeof(int));
+
+		bn_set_dig(u, 1);
+		for (j = 0; j < prv->size; j++) {
+			util_hash_put(prv->keys, prv->vals, prv->slots, bdpe_key(u), j);
+			bn_mul(u, u, prv->x);
+			bn_mod(u, u, prv->n);
+		}
+
+		/* Since x has order t, the giant step is x^(t - size). */
+		bn_mxp_dig(prv->g, prv->x, prv->t - prv->size, prv->n);
+	}
+	CATCH_ANY {
+		free(prv->keys);
+		free(prv->vals);
+		prv->keys = NULL;
+		prv->vals = NULL;
+		prv->size = prv->slots = 0;
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_free(t);
+		bn_free(u);
+	}
+
+	return result;
+}
+
 int cp_bdpe_gen(bdpe_t pub, bdpe_t prv, dig_t block, int bits) {
 	bn_t t, r;
 	int result = RLC_OK;
@@ -103,6 +179,7 @@ int cp_bdpe_gen(bdpe_t pub, bdpe_t prv, dig_t block, int bits) {
 		} while (bn_cmp_dig(r, 1) == RLC_EQ);
 
 		bn_copy(prv->y, pub->y);
+		result = cp_bdpe_pre(prv);
 	}
 	CATCH_ANY {
 		result = RLC_ERR;
@@ -116,11 +193,14 @@ int cp_bdpe_gen(bdpe_t pub, bdpe_t prv, dig_t block, int bits) {
 }
 
 int cp_bdpe_enc(uint8_t *out, int *out_len, dig_t in, bdpe_t pub) {
-	bn_t m, u;
+	bn_t m, a[2], b[2];
 	int size, result = RLC_OK;
 
 	bn_null(m);
-	bn_null(u);
+	bn_null(a[0]);
+	bn_null(a[1]);
+	bn_null(b[0]);
+	bn_null(b[1]);
 
 	size = bn_size_bin(pub->n);
 
@@ -130,15 +210,17 @@ int cp_bdpe_enc(uint8_t *out, int *out_len, dig_t in, bdpe_t pub) {
 
 	TRY {
 		bn_new(m);
-		bn_new(u);
-
-		bn_set_dig(m, in);
-
-		bn_rand_mod(u, pub->n);
-		bn_mxp(m, pub->y, m, pub->n);
-		bn_mxp_dig(u, u, pub->t, pub->n);
-		bn_mul(m, m, u);
-		bn_mod(m, m, pub->n);
+		bn_new(a[0]);
+		bn_new(a[1]);
+		bn_new(b[0]);
+		bn_new(b[1]);
+
+		/* Compute m = y^in * u^t mod n sharing the squarings. */
+		bn_copy(a[0], pub->y);
+		bn_set_dig(b[0], in);
+		bn_rand_mod(a[1], pub->n);
+		bn_set_dig(b[1], pub->t);
+		bn_mxp_sim(m, (const bn_t *)a, (const bn_t *)b, 2, pub->n);
 
 		if (size <= *out_len) {
 			*out_len = size;
@@ -153,31 +235,36 @@ int cp_bdpe_enc(uint8_t *out, int *out_len, dig_t in, bdpe_t pub) {
 	}
 	FINALLY {
 		bn_free(m);
-		bn_free(u);
+		bn_free(a[0]);
+		bn_free(a[1]);
+		bn_free(b[0]);
+		bn_free(b[1]);
 	}
 
 	return result;
 }
 
 int cp_bdpe_dec(dig_t *out, uint8_t *in, int in_len, bdpe_t prv) {
-	bn_t m, t, z;
-	int size, result = RLC_OK;
-	dig_t i;
+	bn_t m, t, u;
+	int j, s, size, result = RLC_ERR;
+	dig_t i, c, n;
+	uint64_t key;
 
 	size = bn_size_bin(prv->n);
 
-	if (in_len < 0 || in_len != size) {
+	/* The table is built in advance, so decryption never modifies the key. */
+	if (in_len < 0 || in_len != size || prv->keys == NULL) {
 		return RLC_ERR;
 	}
 
 	bn_null(m);
 	bn_null(t);
-	bn_null(z);
+	bn_null(u);
 
 	TRY {
 		bn_new(m);
 		bn_new(t);
-		bn_new(z);
+		bn_new(u);
 
 		/* Compute t = (p-1)(q-1)/block. */
 		bn_mul(t, prv->p, prv->q);
@@ -187,18 +274,28 @@ int cp_bdpe_dec(dig_t *out, uint8_t *in, int in_len, bdpe_t prv) {
 		bn_div_dig(t, t, prv->t);
 		bn_read_bin(m, in, in_len);
 		bn_mxp(m, m, t, prv->n);
-		bn_mxp(t, prv->y, t, prv->n);
 
-		for (i = 0; i < prv->t; i++) {
-			bn_mxp_dig(z, t, i, prv->n);
-			if (bn_cmp(z, m) == RLC_EQ) {
-				*out = i;
-				break;
+		/* Find i such that m = x^i with baby steps and giant steps. */
+		n = (prv->t - 1) / prv->size + 1;
+		bn_copy(u, m);
+		for (i = 0; i < n && result == RLC_ERR; i++) {
+			key = bdpe_key(u);
+			s = -1;
+			while ((j = util_hash_get(prv->keys, prv->vals, prv->slots, key,
+					&s)) >= 0) {
+				c = i * prv->size + j;
+				if (c < prv->t) {
+					/* Rule out collisions between fingerprints. */
+					bn_mxp_dig(t, prv->x, c, prv->n);
+					if (bn_cmp(t, m) == RLC_EQ) {
+						*out = c;
+						result = RLC_OK;
+						break;
+					}
+				}
 			}
-		}
-
-		if (i == prv->t) {
-			result = RLC_ERR;
+			bn_mul(u, u, prv->g);
+			bn_mod(u, u, prv->n);
 		}
 	} CATCH_ANY {
 		result = RLC_ERR;
@@ -206,7 +303,7 @@ int cp_bdpe_dec(dig_t *out, uint8_t *in, int in_len, bdpe_t prv) {
 	FINALLY {
 		bn_free(m);
 		bn_free(t);
-		bn_free(z);
+		bn_free(u);
 	}
 
 	return result;
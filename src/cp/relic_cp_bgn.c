@@ -32,6 +32,7 @@
  */
 
 #include <limits.h>
+#include <string.h>
 
 #include "relic_core.h"
 #include "relic_conf.h"
@@ -41,6 +42,174 @@
 #include "relic_cp.h"
 #include "relic_md.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Computes the exponent (xy - z) of the base element used in BGN decryption,
+ * or its square for decryption in G_T.
+ *
+ * @param[out] r			- the exponent.
+ * @param[in] prv			- the private key.
+ * @param[in] sqr			- the flag to square the exponent.
+ */
+static void bgn_exp(bn_t r, bgn_t prv, int sqr) {
+	bn_t n;
+
+	bn_null(n);
+
+	TRY {
+		bn_new(n);
+
+		g1_get_ord(n);
+		bn_mul(r, prv->x, prv->y);
+		bn_sub(r, r, prv->z);
+		bn_mod(r, r, n);
+		if (sqr) {
+			bn_sqr(r, r);
+			bn_mod(r, r, n);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(n);
+	}
+}
+
+/**
+ * Computes a fresh randomizer for BGN encryption in G_1, consisting of the
+ * elements rG and r(xG) for a random r.
+ *
+ * @param[out] u			- the element rG.
+ * @param[out] v			- the element r(xG).
+ * @param[in] pub			- the public key.
+ */
+static void bgn_rand1(g1_t u, g1_t v, bgn_t pub) {
+	bn_t n, r;
+
+	bn_null(n);
+	bn_null(r);
+
+	TRY {
+		bn_new(n);
+		bn_new(r);
+
+		g1_get_ord(n);
+		bn_rand_mod(r, n);
+		g1_mul_gen(u, r);
+		g1_norm(u, u);
+		g1_mul(v, pub->gx, r);
+		g1_norm(v, v);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(n);
+		bn_free(r);
+	}
+}
+
+/**
+ * Computes the digest of the public key elements that the randomizers in a
+ * pool depend on, binding the pool to the key.
+ *
+ * @param[out] h			- the digest.
+ * @param[in] pub			- the public key.
+ */
+static void bgn_print(uint8_t h[RLC_MD_LEN], bgn_t pub) {
+	int l1 = g1_size_bin(pub->gx, 0), l2 = g2_size_bin(pub->hx, 0);
+	uint8_t *bin = RLC_ALLOCA(uint8_t, l1 + l2);
+
+	if (bin == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+	g1_write_bin(bin, l1, pub->gx, 0);
+	g2_write_bin(bin + l1, l2, pub->hx, 0);
+	md_map(h, bin, l1 + l2);
+	RLC_FREE(bin);
+}
+
+/**
+ * Encrypts in G_1 using the BGN cryptosystem with a given randomizer.
+ *
+ * @param[out] out			- the ciphertext.
+ * @param[in] in			- the plaintext as a small integer.
+ * @param[in] pub			- the public key.
+ * @param[in] u				- the element rG.
+ * @param[in] v				- the element r(xG).
+ */
+static void bgn_enc1(g1_t out[2], dig_t in, bgn_t pub, g1_t u, g1_t v) {
+	/* Compute c0 = (ym + r)G. */
+	g1_mul_dig(out[0], pub->gy, in);
+	g1_add(out[0], out[0], u);
+	g1_norm(out[0], out[0]);
+
+	/* Compute c1 = (zm + xr)G. */
+	g1_mul_dig(out[1], pub->gz, in);
+	g1_add(out[1], out[1], v);
+	g1_norm(out[1], out[1]);
+}
+
+/**
+ * Computes a fresh randomizer for BGN encryption in G_2, consisting of the
+ * elements rG and r(xG) for a random r.
+ *
+ * @param[out] u			- the element rG.
+ * @param[out] v			- the element r(xG).
+ * @param[in] pub			- the public key.
+ */
+static void bgn_rand2(g2_t u, g2_t v, bgn_t pub) {
+	bn_t n, r;
+
+	bn_null(n);
+	bn_null(r);
+
+	TRY {
+		bn_new(n);
+		bn_new(r);
+
+		g2_get_ord(n);
+		bn_rand_mod(r, n);
+		g2_mul_gen(u, r);
+		g2_norm(u, u);
+		g2_mul(v, pub->hx, r);
+		g2_norm(v, v);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(n);
+		bn_free(r);
+	}
+}
+
+/**
+ * Encrypts in G_2 using the BGN cryptosystem with a given randomizer.
+ *
+ * @param[out] out			- the ciphertext.
+ * @param[in] in			- the plaintext as a small integer.
+ * @param[in] pub			- the public key.
+ * @param[in] u				- the element rG.
+ * @param[in] v				- the element r(xG).
+ */
+static void bgn_enc2(g2_t out[2], dig_t in, bgn_t pub, g2_t u, g2_t v) {
+	/* Compute c0 = (ym + r)G. */
+	g2_mul_dig(out[0], pub->hy, in);
+	g2_add(out[0], out[0], u);
+	g2_norm(out[0], out[0]);
+
+	/* Compute c1 = (zm + xr)G. */
+	g2_mul_dig(out[1], pub->hz, in);
+	g2_add(out[1], out[1], v);
+	g2_norm(out[1], out[1]);
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -79,99 +248,146 @@ int cp_bgn_gen(bgn_t pub, bgn_t prv) {
 }
 
 int cp_bgn_enc1(g1_t out[2], dig_t in, bgn_t pub) {
-	bn_t r, n;
-	g1_t t;
+	g1_t u, v;
 	int result = RLC_OK;
 
-	bn_null(n);
-	bn_null(r);
-	g1_null(t);
+	g1_null(u);
+	g1_null(v);
 
 	TRY {
-		bn_new(n);
-		bn_new(r);
-		g1_new(t);
+		g1_new(u);
+		g1_new(v);
 
-		g1_get_ord(n);
-		bn_rand_mod(r, n);
+		bgn_rand1(u, v, pub);
+		bgn_enc1(out, in, pub, u, v);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		g1_free(u);
+		g1_free(v);
+	}
+
+	return result;
+}
+
+int cp_bgn_enc1_pre(g1_t out[2], dig_t in, bgn_t pub, bgn_pool_t p) {
+	g1_t u, v;
+	uint8_t h[RLC_MD_LEN];
+	volatile int locked = 0;
+	int hit = 0, result = RLC_OK;
+
+	if (p == NULL) {
+		return RLC_ERR;
+	}
+
+	g1_null(u);
+	g1_null(v);
+
+	TRY {
+		g1_new(u);
+		g1_new(v);
+
+		bgn_print(h, pub);
+		core_lock(p->lock);
+		locked = 1;
+		if (p->bound && memcmp(p->key, h, RLC_MD_LEN) != 0) {
+			result = RLC_ERR;
+		} else if (p->len1 > 0) {
+			p->len1--;
+			g1_copy(u, p->r1[p->len1]);
+			g1_copy(v, p->s1[p->len1]);
+			p->hits++;
+			hit = 1;
+		} else {
+			p->miss++;
+		}
+		locked = 0;
+		core_unlock(p->lock);
 
-		/* Compute c0 = (ym + r)G. */
-		g1_mul_dig(out[0], pub->gy, in);
+		if (result == RLC_OK) {
+			if (!hit) {
+				bgn_rand1(u, v, pub);
+			}
+			bgn_enc1(out, in, pub, u, v);
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		if (locked) {
+			core_unlock(p->lock);
+		}
+		g1_free(u);
+		g1_free(v);
+	}
 
-		g1_mul_gen(t, r);
-		g1_add(out[0], out[0], t);
-		g1_norm(out[0], out[0]);
+	return result;
+}
 
-		/* Compute c1 = (zm + xr)G. */
-		g1_mul_dig(out[1], pub->gz, in);
-		g1_mul(t, pub->gx, r);
-		g1_add(out[1], out[1], t);
-		g1_norm(out[1], out[1]);
+int cp_bgn_tab1(pc_dlog_t t, bgn_t prv) {
+	bn_t r;
+	g1_t s;
+	int result = RLC_OK;
+
+	bn_null(r);
+	g1_null(s);
+
+	TRY {
+		bn_new(r);
+		g1_new(s);
+
+		/* Tabulate multiples of U = (xy - z)G. */
+		bgn_exp(r, prv, 0);
+		g1_mul_gen(s, r);
+		g1_dlog_tab(t, s);
 	}
 	CATCH_ANY {
 		result = RLC_ERR;
 	}
 	FINALLY {
-		bn_free(n);
 		bn_free(r);
-		g1_free(t);
+		g1_free(s);
 	}
 
 	return result;
 }
 
 int cp_bgn_dec1(dig_t *out, g1_t in[2], bgn_t prv) {
-	bn_t r, n;
-	g1_t s, t, u;
-	int i, result = RLC_ERR;
+	return cp_bgn_dec1_tab(out, in, prv, NULL, INT_MAX);
+}
+
+int cp_bgn_dec1_tab(dig_t *out, g1_t in[2], bgn_t prv, const pc_dlog_t t,
+		dig_t bound) {
+	bn_t r;
+	g1_t s, u;
+	int result = RLC_ERR;
 
-	bn_null(n);
 	bn_null(r);
 	g1_null(s);
-	g1_null(t);
 	g1_null(u);
 
 	TRY {
-		bn_new(n);
 		bn_new(r);
 		g1_new(s);
-		g1_new(t);
 		g1_new(u);
 
-		g1_get_ord(n);
-		/* Compute T = x(ym + r)G - (zm + xr)G = m(xy - z)G. */
-		g1_mul(t, in[0], prv->x);
-		g1_sub(t, t, in[1]);
-		g1_norm(t, t);
-		/* Compute U = (xy - z)G and find m. */
-		bn_mul(r, prv->x, prv->y);
-		bn_sub(r, r, prv->z);
-		bn_mod(r, r, n);
+		/* Compute U = x(ym + r)G - (zm + xr)G = m(xy - z)G. */
+		g1_mul(u, in[0], prv->x);
+		g1_sub(u, u, in[1]);
+		g1_norm(u, u);
+		/* Compute S = (xy - z)G and find m. */
+		bgn_exp(r, prv, 0);
 		g1_mul_gen(s, r);
-		g1_copy(u, s);
-
-		if (g1_is_infty(t) == 1){
-			*out = 0;
-			result = RLC_OK;
-		} else {
-			for (i = 0; i < INT_MAX; i++) {
-				if (g1_cmp(t, u) == RLC_EQ) {
-					*out = i + 1;
-					result = RLC_OK;
-					break;
-				}
-				g1_add(u, u, s);
-				g1_norm(u, u);
-			}
-		}
+		result = g1_dlog(out, u, s, t, bound);
 	} CATCH_ANY {
 		result = RLC_ERR;
 	}
 	FINALLY {
-		bn_free(n);
 		bn_free(r);
 		g1_free(s);
-		g1_free(t);
 		g1_free(u);
 	}
 
@@ -179,98 +395,146 @@ int cp_bgn_dec1(dig_t *out, g1_t in[2], bgn_t prv) {
 }
 
 int cp_bgn_enc2(g2_t out[2], dig_t in, bgn_t pub) {
-	bn_t r, n;
-	g2_t t;
+	g2_t u, v;
 	int result = RLC_OK;
 
-	bn_null(n);
-	bn_null(r);
-	g2_null(t);
+	g2_null(u);
+	g2_null(v);
 
 	TRY {
-		bn_new(n);
-		bn_new(r);
-		g2_new(t);
+		g2_new(u);
+		g2_new(v);
 
-		g2_get_ord(n);
-		bn_rand_mod(r, n);
+		bgn_rand2(u, v, pub);
+		bgn_enc2(out, in, pub, u, v);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		g2_free(u);
+		g2_free(v);
+	}
 
-		/* Compute c0 = (ym + r)G. */
-		g2_mul_dig(out[0], pub->hy, in);
-		g2_mul_gen(t, r);
-		g2_add(out[0], out[0], t);
-		g2_norm(out[0], out[0]);
+	return result;
+}
+
+int cp_bgn_enc2_pre(g2_t out[2], dig_t in, bgn_t pub, bgn_pool_t p) {
+	g2_t u, v;
+	uint8_t h[RLC_MD_LEN];
+	volatile int locked = 0;
+	int hit = 0, result = RLC_OK;
 
-		/* Compute c1 = (zm + xr)G. */
-		g2_mul_dig(out[1], pub->hz, in);
-		g2_mul(t, pub->hx, r);
-		g2_add(out[1], out[1], t);
-		g2_norm(out[1], out[1]);
+	if (p == NULL) {
+		return RLC_ERR;
+	}
+
+	g2_null(u);
+	g2_null(v);
+
+	TRY {
+		g2_new(u);
+		g2_new(v);
+
+		bgn_print(h, pub);
+		core_lock(p->lock);
+		locked = 1;
+		if (p->bound && memcmp(p->key, h, RLC_MD_LEN) != 0) {
+			result = RLC_ERR;
+		} else if (p->len2 > 0) {
+			p->len2--;
+			g2_copy(u, p->r2[p->len2]);
+			g2_copy(v, p->s2[p->len2]);
+			p->hits++;
+			hit = 1;
+		} else {
+			p->miss++;
+		}
+		locked = 0;
+		core_unlock(p->lock);
+
+		if (result == RLC_OK) {
+			if (!hit) {
+				bgn_rand2(u, v, pub);
+			}
+			bgn_enc2(out, in, pub, u, v);
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		if (locked) {
+			core_unlock(p->lock);
+		}
+		g2_free(u);
+		g2_free(v);
+	}
+
+	return result;
+}
+
+int cp_bgn_tab2(pc_dlog_t t, bgn_t prv) {
+	bn_t r;
+	g2_t s;
+	int result = RLC_OK;
+
+	bn_null(r);
+	g2_null(s);
+
+	TRY {
+		bn_new(r);
+		g2_new(s);
+
+		/* Tabulate multiples of U = (xy - z)G. */
+		bgn_exp(r, prv, 0);
+		g2_mul_gen(s, r);
+		g2_dlog_tab(t, s);
 	}
 	CATCH_ANY {
 		result = RLC_ERR;
 	}
 	FINALLY {
-		bn_free(n);
 		bn_free(r);
-		g2_free(t);
+		g2_free(s);
 	}
 
 	return result;
 }
 
 int cp_bgn_dec2(dig_t *out, g2_t in[2], bgn_t prv) {
-	bn_t r, n;
-	g2_t s, t, u;
-	int i, result = RLC_ERR;
+	return cp_bgn_dec2_tab(out, in, prv, NULL, INT_MAX);
+}
+
+int cp_bgn_dec2_tab(dig_t *out, g2_t in[2], bgn_t prv, const pc_dlog_t t,
+		dig_t bound) {
+	bn_t r;
+	g2_t s, u;
+	int result = RLC_ERR;
 
-	bn_null(n);
 	bn_null(r);
 	g2_null(s);
-	g2_null(t);
 	g2_null(u);
 
 	TRY {
-		bn_new(n);
 		bn_new(r);
 		g2_new(s);
-		g2_new(t);
 		g2_new(u);
 
-		g2_get_ord(n);
-		/* Compute T = x(ym + r)G - (zm + xr)G = m(xy - z)G. */
-		g2_mul(t, in[0], prv->x);
-		g2_sub(t, t, in[1]);
-		g2_norm(t, t);
-		/* Compute U = (xy - z)G and find m. */
-		bn_mul(r, prv->x, prv->y);
-		bn_sub(r, r, prv->z);
-		bn_mod(r, r, n);
+		/* Compute U = x(ym + r)G - (zm + xr)G = m(xy - z)G. */
+		g2_mul(u, in[0], prv->x);
+		g2_sub(u, u, in[1]);
+		g2_norm(u, u);
+		/* Compute S = (xy - z)G and find m. */
+		bgn_exp(r, prv, 0);
 		g2_mul_gen(s, r);
-		g2_copy(u, s);
-
-		if (g2_is_infty(t) == 1) {
-			*out = 0;
-			result = RLC_OK;
-		} else {
-			for (i = 0; i < INT_MAX; i++) {
-				if (g2_cmp(t, u) == RLC_EQ) {
-					*out = i + 1;
-					result = RLC_OK;
-					break;
-				}
-				g2_add(u, u, s);
-				g2_norm(u, u);
-			}
-		}
+		result = g2_dlog(out, u, s, t, bound);
 	} CATCH_ANY {
 		result = RLC_ERR;
 	}
 	FINALLY {
-		bn_free(n);
 		bn_free(r);
 		g2_free(s);
-		g2_free(t);
 		g2_free(u);
 	}
 
@@ -293,84 +557,257 @@ int cp_bgn_mul(gt_t e[4], g1_t c[2], g2_t d[2]) {
 	return RLC_OK;
 }
 
+int cp_bgn_tab(pc_dlog_t t, bgn_t prv) {
+	bn_t r;
+	g1_t g;
+	g2_t h;
+	gt_t s;
+	int result = RLC_OK;
+
+	bn_null(r);
+	g1_null(g);
+	g2_null(h);
+	gt_null(s);
+
+	TRY {
+		bn_new(r);
+		g1_new(g);
+		g2_new(h);
+		gt_new(s);
+
+		/* Tabulate powers of e(G, H)^((xy - z)^2). */
+		bgn_exp(r, prv, 1);
+		g1_get_gen(g);
+		g2_get_gen(h);
+		pc_map(s, g, h);
+		gt_exp(s, s, r);
+		gt_dlog_tab(t, s);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_free(r);
+		g1_free(g);
+		g2_free(h);
+		gt_free(s);
+	}
+
+	return result;
+}
+
 int cp_bgn_dec(dig_t *out, gt_t in[4], bgn_t prv) {
+	return cp_bgn_dec_tab(out, in, prv, NULL, INT_MAX);
+}
+
+int cp_bgn_dec_tab(dig_t *out, gt_t in[4], bgn_t prv, const pc_dlog_t t,
+		dig_t bound) {
 	int i, result = RLC_ERR;
 	g1_t g;
 	g2_t h;
-	gt_t t[4];
-	bn_t n, r, s;
+	gt_t u[4];
+	bn_t r;
 
-	bn_null(n);
 	bn_null(r);
-	bn_null(s);
 	g1_null(g);
 	g2_null(h);
 
 	TRY {
-		bn_new(n);
 		bn_new(r);
-		bn_new(s);
 		g1_new(g);
 		g2_new(h);
 		for (i = 0; i < 4; i++) {
-			gt_null(t[i]);
-			gt_new(t[i]);
+			gt_null(u[i]);
+			gt_new(u[i]);
 		}
 
-		gt_exp(t[0], in[0], prv->x);
-		gt_exp(t[0], t[0], prv->x);
+		gt_exp(u[0], in[0], prv->x);
+		gt_exp(u[0], u[0], prv->x);
 
-		gt_mul(t[1], in[1], in[2]);
-		gt_exp(t[1], t[1], prv->x);
-		gt_inv(t[1], t[1]);
+		gt_mul(u[1], in[1], in[2]);
+		gt_exp(u[1], u[1], prv->x);
+		gt_inv(u[1], u[1]);
 
-		gt_mul(t[3], in[3], t[1]);
-		gt_mul(t[3], t[3], t[0]);
+		gt_mul(u[3], in[3], u[1]);
+		gt_mul(u[3], u[3], u[0]);
 
-		gt_get_ord(n);
+		/* Compute S = e(G, H)^((xy - z)^2) and find m. */
+		bgn_exp(r, prv, 1);
 		g1_get_gen(g);
 		g2_get_gen(h);
+		pc_map(u[2], g, h);
+		gt_exp(u[2], u[2], r);
+		result = gt_dlog(out, u[3], u[2], t, bound);
+	} CATCH_ANY {
+		result = RLC_ERR;
+	} FINALLY {
+		bn_free(r);
+		g1_free(g);
+		g2_free(h);
+		for (i = 0; i < 4; i++) {
+			gt_free(u[i]);
+		}
+	}
 
-		bn_mul(r, prv->x, prv->y);
-		bn_sqr(r, r);
+	return result;
+}
 
-		bn_mul(s, prv->x, prv->y);
-		bn_mul(s, s, prv->z);
-		bn_sub(r, r, s);
-		bn_sub(r, r, s);
+void cp_bgn_pool_make(bgn_pool_t p, int m) {
+	int i;
 
-		bn_sqr(s, prv->z);
-		bn_add(r, r, s);
-		bn_mod(r, r, n);
-		pc_map(t[1], g, h);
-		gt_exp(t[1], t[1], r);
+	core_lock_init(p->lock);
+	p->size = p->len1 = p->len2 = p->hits = p->miss = p->bound = 0;
+	if (m < 1) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
 
-		gt_copy(t[2], t[1]);
+	p->r1 = (g1_t *)calloc(m, sizeof(g1_t));
+	p->s1 = (g1_t *)calloc(m, sizeof(g1_t));
+	p->r2 = (g2_t *)calloc(m, sizeof(g2_t));
+	p->s2 = (g2_t *)calloc(m, sizeof(g2_t));
+	if (p->r1 == NULL || p->s1 == NULL || p->r2 == NULL || p->s2 == NULL) {
+		free(p->r1);
+		free(p->s1);
+		free(p->r2);
+		free(p->s2);
+		p->r1 = p->s1 = NULL;
+		p->r2 = p->s2 = NULL;
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
 
-		if (gt_is_unity(t[3]) == 1) {
-			*out = 0;
-			result = RLC_OK;
+	TRY {
+		for (i = 0; i < m; i++) {
+			g1_null(p->r1[i]);
+			g1_null(p->s1[i]);
+			g2_null(p->r2[i]);
+			g2_null(p->s2[i]);
+			g1_new(p->r1[i]);
+			g1_new(p->s1[i]);
+			g2_new(p->r2[i]);
+			g2_new(p->s2[i]);
+		}
+		p->size = m;
+	} CATCH_ANY {
+		/* Unwind the elements allocated so far, the others are still null. */
+		for (i = 0; i < m; i++) {
+			g1_free(p->r1[i]);
+			g1_free(p->s1[i]);
+			g2_free(p->r2[i]);
+			g2_free(p->s2[i]);
+		}
+		free(p->r1);
+		free(p->s1);
+		free(p->r2);
+		free(p->s2);
+		p->r1 = p->s1 = NULL;
+		p->r2 = p->s2 = NULL;
+		THROW(ERR_CAUGHT);
+	}
+}
+
+void cp_bgn_pool_clean(bgn_pool_t p) {
+	if (p->r1 != NULL && p->s1 != NULL && p->r2 != NULL && p->s2 != NULL) {
+		for (int i = 0; i < p->size; i++) {
+			g1_free(p->r1[i]);
+			g1_free(p->s1[i]);
+			g2_free(p->r2[i]);
+			g2_free(p->s2[i]);
+		}
+	}
+	free(p->r1);
+	free(p->s1);
+	free(p->r2);
+	free(p->s2);
+	p->r1 = p->s1 = NULL;
+	p->r2 = p->s2 = NULL;
+	p->size = p->len1 = p->len2 = p->hits = p->miss = p->bound = 0;
+	core_lock_clean(p->lock);
+}
+
+int cp_bgn_pre(bgn_pool_t p, bgn_t pub) {
+	g1_t u1, v1;
+	g2_t u2, v2;
+	uint8_t h[RLC_MD_LEN];
+	volatile int locked = 0;
+	int full, result = RLC_OK;
+
+	if (p == NULL || pub == NULL) {
+		return RLC_ERR;
+	}
+
+	g1_null(u1);
+	g1_null(v1);
+	g2_null(u2);
+	g2_null(v2);
+
+	TRY {
+		g1_new(u1);
+		g1_new(v1);
+		g2_new(u2);
+		g2_new(v2);
+
+		bgn_print(h, pub);
+		core_lock(p->lock);
+		locked = 1;
+		if (p->bound && memcmp(p->key, h, RLC_MD_LEN) != 0) {
+			/* Do not mix randomizers computed under different keys. */
+			result = RLC_ERR;
+			full = 1;
 		} else {
-			for (i = 0; i < INT_MAX; i++) {
-				if (gt_cmp(t[2], t[3]) == RLC_EQ) {
-					*out = i + 1;
-					result = RLC_OK;
-					break;
-				}
-				gt_mul(t[2], t[2], t[1]);
+			memcpy(p->key, h, RLC_MD_LEN);
+			p->bound = 1;
+			full = (p->len1 == p->size);
+		}
+		locked = 0;
+		core_unlock(p->lock);
+
+		while (!full) {
+			/* Multiply outside the lock so that encryption can proceed. */
+			bgn_rand1(u1, v1, pub);
+			core_lock(p->lock);
+			locked = 1;
+			if (p->len1 < p->size) {
+				g1_copy(p->r1[p->len1], u1);
+				g1_copy(p->s1[p->len1], v1);
+				p->len1++;
 			}
+			full = (p->len1 == p->size);
+			locked = 0;
+			core_unlock(p->lock);
 		}
-	} CATCH_ANY {
+
+		core_lock(p->lock);
+		full = (result != RLC_OK || p->len2 == p->size);
+		core_unlock(p->lock);
+
+		while (!full) {
+			bgn_rand2(u2, v2, pub);
+			core_lock(p->lock);
+			locked = 1;
+			if (p->len2 < p->size) {
+				g2_copy(p->r2[p->len2], u2);
+				g2_copy(p->s2[p->len2], v2);
+				p->len2++;
+			}
+			full = (p->len2 == p->size);
+			locked = 0;
+			core_unlock(p->lock);
+		}
+	}
+	CATCH_ANY {
 		result = RLC_ERR;
-	} FINALLY {
-		bn_free(n);
-		bn_free(r);
-		bn_free(s);
-		g1_free(g);
-		g2_free(h);
-		for (i = 0; i < 4; i++) {
-			gt_free(t[i]);
+	}
+	FINALLY {
+		/* Release the pool if a copy failed while holding the lock. */
+		if (locked) {
+			core_unlock(p->lock);
 		}
+		g1_free(u1);
+		g1_free(v1);
+		g2_free(u2);
+		g2_free(v2);
 	}
 
 	return result;
@@ -355,43 +355,46 @@ int cp_clb_gen(bn_t t, bn_t u, bn_t v[], g2_t x, g2_t y, g2_t z[], int l) {
 
 int cp_clb_sig(g1_t a, g1_t A[], g1_t b, g1_t B[], g1_t c, uint8_t *msgs[],
 		int lens[], bn_t t, bn_t u, bn_t v[], int l) {
-	bn_t m, n;
+	bn_t m, n, s, w;
 	int i, result = RLC_OK;
 
 	bn_null(m);
 	bn_null(n);
+	bn_null(s);
+	bn_null(w);
 
 	TRY {
 		bn_new(m);
 		bn_new(n);
+		bn_new(s);
+		bn_new(w);
 
 		/* Choose random a in G1. */
 		g1_rand(a);
 		/* Compute A_i = a^z_i, B_i = A_i^y. */
+		g1_get_ord(n);
 		for (i = 1; i < l; i++) {
 			g1_mul(A[i - 1], a, v[i - 1]);
-			g1_mul(B[i - 1], A[i - 1], u);
+			bn_mul(w, v[i - 1], u);
+			bn_mod(w, w, n);
+			g1_mul(B[i - 1], a, w);
 		}
-		/* Compute c = a^(x+xym_0)\prod A_i^(xym_i) = B_i^(xm_i). */
-		g1_get_ord(n);
-		bn_read_bin(m, msgs[0], lens[0]);
-		bn_mod(m, m, n);
-		bn_mul(m, m, t);
-		bn_mod(m, m, n);
-		bn_mul(m, m, u);
-		bn_add(m, m, t);
-		bn_mod(m, m, n);
-		g1_mul(c, a, m);
-		/* This can be made faster with more interleaving. */
+		/* Compute c = a^(x+xym_0)\prod A_i^(xym_i) = a^(x(1+y(m_0+\sum z_im_i)))
+		 * with a single multiplication, since the signer knows the exponents. */
+		bn_read_bin(s, msgs[0], lens[0]);
+		bn_mod(s, s, n);
 		for (i = 1; i < l; i++) {
 			bn_read_bin(m, msgs[i], lens[i]);
 			bn_mod(m, m, n);
-			bn_mul(m, m, t);
-			bn_mod(m, m, n);
-			g1_mul(b, B[i - 1], m);
-			g1_add(c, c, b);
+			bn_mul(m, m, v[i - 1]);
+			bn_add(s, s, m);
+			bn_mod(s, s, n);
 		}
-		g1_norm(c, c);
+		bn_mul(s, s, u);
+		bn_add_dig(s, s, 1);
+		bn_mul(s, s, t);
+		bn_mod(s, s, n);
+		g1_mul(c, a, s);
 		/* Compute b = a^y. */
 		g1_mul(b, a, u);
 	}
@@ -401,34 +404,47 @@ int cp_clb_sig(g1_t a, g1_t A[], g1_t b, g1_t B[], g1_t c, uint8_t *msgs[],
 	FINALLY {
 		bn_free(m);
 		bn_free(n);
+		bn_free(s);
+		bn_free(w);
 	}
 	return result;
 }
 
 int cp_clb_ver(g1_t a, g1_t A[], g1_t b, g1_t B[], g1_t c, uint8_t *msgs[],
 		int lens[], g2_t x, g2_t y, g2_t z[], int l) {
-	g1_t p[2];
-	g2_t q[2];
+	g1_t p[4], *u = RLC_ALLOCA(g1_t, 2 * l - 1);
+	g2_t q[4];
 	gt_t e;
-	bn_t m, n;
+	bn_t n, *k = RLC_ALLOCA(bn_t, 2 * l - 1), *m = RLC_ALLOCA(bn_t, l);
 	int i, result = 1;
 
-	g1_null(p[0]);
-	g1_null(p[1]);
-	g2_null(q[0]);
-	g2_null(q[1]);
+	for (i = 0; i < 4; i++) {
+		g1_null(p[i]);
+		g2_null(q[i]);
+	}
 	gt_null(e);
-	bn_null(m);
 	bn_null(n);
 
 	TRY {
-		g1_new(p[0]);
-		g1_new(p[1]);
-		g2_new(q[0]);
-		g2_new(q[1]);
+		for (i = 0; i < 4; i++) {
+			g1_new(p[i]);
+			g2_new(q[i]);
+		}
 		gt_new(e);
-		bn_new(m);
 		bn_new(n);
+		if (u == NULL || k == NULL || m == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < 2 * l - 1; i++) {
+			g1_null(u[i]);
+			g1_new(u[i]);
+			bn_null(k[i]);
+			bn_new(k[i]);
+		}
+		for (i = 0; i < l; i++) {
+			bn_null(m[i]);
+			bn_new(m[i]);
+		}
 
 		if (g1_is_infty(a) || g1_is_infty(b) || g1_is_infty(c)) {
 			result = 0;
@@ -439,51 +455,51 @@ int cp_clb_ver(g1_t a, g1_t A[], g1_t b, g1_t B[], g1_t c, uint8_t *msgs[],
 			}
 		}
 
-		/* Check that e(a, Z_i) = e(A_i, g) or that e(a, Z_i)e(A_i, -g) = 1. */
-		g1_copy(p[0], a);
-		g2_get_gen(q[1]);
-		g2_neg(q[1], q[1]);
-		for (i = 1; i < l; i++) {
-			g1_copy(p[1], A[i - 1]);
-			g2_copy(q[0], z[i - 1]);
-			pc_map_sim(e, p, q, 2);
-			if (!gt_is_unity(e)) {
-				result = 0;
-			}
+		/* Combine the checks e(a, Z_i) = e(A_i, g), e(a, Y) = e(b, g),
+		 * e(A_i, Y) = e(B_i, g) and e(a, X)e(m_0b, X)\prod e(m_iB_i, X) =
+		 * e(c, g) with random 128-bit weights s_i for the second and third,
+		 * r_i for the first, so that a single multi-pairing is computed. */
+		g1_get_ord(n);
+		for (i = 0; i < l; i++) {
+			bn_rand(k[i], RLC_POS, 128);
+			bn_read_bin(m[i], msgs[i], lens[i]);
+			bn_mod(m[i], m[i], n);
 		}
-
-		/* Check e(a, Y) = e(b, g) and e(A_i, Y) = e(B_i, g) using the trick. */
-		g1_copy(p[1], b);
-		g2_copy(q[0], y);
-		pc_map_sim(e, p, q, 2);
-		if (!gt_is_unity(e)) {
-			result = 0;
+		for (i = l; i < 2 * l - 1; i++) {
+			bn_rand(k[i], RLC_POS, 128);
 		}
+
+		/* Compute s_0a + \sum s_iA_i, paired with Y. */
+		g1_copy(u[0], a);
 		for (i = 1; i < l; i++) {
-			g1_copy(p[0], A[i - 1]);
-			g1_copy(p[1], B[i - 1]);
-			pc_map_sim(e, p, q, 2);
-			if (!gt_is_unity(e)) {
-				result = 0;
-			}
+			g1_copy(u[i], A[i - 1]);
 		}
+		g1_mul_sim_lot(p[1], (const g1_t *)u, (const bn_t *)k, l);
+		g2_copy(q[1], y);
 
-		/* Check that e(a, X)e(m_0b, X)\prod e(m_iB, X) = e(c, g). */
-		g1_get_ord(n);
-		bn_read_bin(m, msgs[0], lens[0]);
-		bn_mod(m, m, n);
-		g1_mul(p[0], b, m);
-		g1_add(p[0], p[0], a);
+		/* Compute s_0b + \sum s_iB_i + \sum r_iA_i + c, paired with -g. */
+		g1_copy(u[0], b);
 		for (i = 1; i < l; i++) {
-			bn_read_bin(m, msgs[i], lens[i]);
-			bn_mod(m, m, n);
-			g1_mul(p[1], B[i - 1], m);
-			g1_add(p[0], p[0], p[1]);
+			g1_copy(u[i], B[i - 1]);
+			g1_copy(u[l + i - 1], A[i - 1]);
 		}
-		g1_norm(p[0], p[0]);
-		g1_copy(p[1], c);
-		g2_copy(q[0], x);
-		pc_map_sim(e, p, q, 2);
+		g1_mul_sim_lot(p[3], (const g1_t *)u, (const bn_t *)k, 2 * l - 1);
+		g1_add(p[3], p[3], c);
+		g1_norm(p[3], p[3]);
+		g2_get_gen(q[3]);
+		g2_neg(q[3], q[3]);
+
+		/* Compute a + m_0b + \sum m_iB_i, paired with X. */
+		g1_mul_sim_lot(p[2], (const g1_t *)u, (const bn_t *)m, l);
+		g1_add(p[2], p[2], a);
+		g1_norm(p[2], p[2]);
+		g2_copy(q[2], x);
+
+		/* Compute \sum r_iZ_i, paired with a. */
+		g1_copy(p[0], a);
+		g2_mul_sim_lot(q[0], z, (const bn_t *)k + l, l - 1);
+
+		pc_map_sim(e, p, q, 4);
 		if (!gt_is_unity(e)) {
 			result = 0;
 		}
@@ -492,13 +508,24 @@ int cp_clb_ver(g1_t a, g1_t A[], g1_t b, g1_t B[], g1_t c, uint8_t *msgs[],
 		THROW(ERR_CAUGHT);
 	}
 	FINALLY {
-		g1_free(p[0]);
-		g1_free(p[1]);
-		g2_free(q[0]);
-		g2_free(q[1]);
+		for (i = 0; i < 4; i++) {
+			g1_free(p[i]);
+			g2_free(q[i]);
+		}
 		gt_free(e);
-		bn_free(m);
 		bn_free(n);
+		if (u != NULL && k != NULL && m != NULL) {
+			for (i = 0; i < 2 * l - 1; i++) {
+				g1_free(u[i]);
+				bn_free(k[i]);
+			}
+			for (i = 0; i < l; i++) {
+				bn_free(m[i]);
+			}
+		}
+		RLC_FREE(u);
+		RLC_FREE(k);
+		RLC_FREE(m);
 	}
 	return result;
 }
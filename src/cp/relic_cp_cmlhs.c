@@ -193,86 +193,114 @@ int cp_cmlhs_ver(g1_t r, g2_t s, g1_t sig[], g2_t z[], g1_t a[], g1_t c[],
 		bn_t msg, char *data, int dlen, int label[], g1_t h,
 		gt_t hs[][RLC_TERMS], dig_t f[][RLC_TERMS], int flen[], g2_t y[],
 		g2_t pk[], int slen) {
-	g1_t g1;
-	g2_t g2;
+	const int len = 1 + 4 * RLC_FP_BYTES + dlen;
+	g1_t *p = RLC_ALLOCA(g1_t, 3 * slen + 2);
+	g1_t *t = RLC_ALLOCA(g1_t, 2 * slen + 2);
+	g2_t *q = RLC_ALLOCA(g2_t, 3 * slen + 2);
+	bn_t n, *k = RLC_ALLOCA(bn_t, 2 * slen + 2);
 	gt_t e, u, v;
-	bn_t k, n;
-	uint8_t *buf = RLC_ALLOCA(uint8_t, 1 + 4 * RLC_FP_BYTES + dlen);
-	int result = 1;
+	uint8_t *buf = RLC_ALLOCA(uint8_t, len);
+	int i, j, result = 0;
 
-	g1_null(g1);
-	g2_null(g2);
+	bn_null(n);
 	gt_null(e);
 	gt_null(u);
 	gt_null(v);
-	bn_null(k);
-	bn_null(n);
 
 	TRY {
-		g1_new(g1);
-		g2_new(g2);
+		bn_new(n);
 		gt_new(e);
 		gt_new(u);
 		gt_new(v);
-		bn_new(k);
-		bn_new(n);
-		if (buf == NULL) {
+		if (p == NULL || t == NULL || q == NULL || k == NULL || buf == NULL) {
 			THROW(ERR_NO_MEMORY);
 		}
+		for (i = 0; i < 3 * slen + 2; i++) {
+			g1_null(p[i]);
+			g1_new(p[i]);
+			g2_null(q[i]);
+			g2_new(q[i]);
+		}
+		for (i = 0; i < 2 * slen + 2; i++) {
+			g1_null(t[i]);
+			g1_new(t[i]);
+			bn_null(k[i]);
+			bn_new(k[i]);
+		}
 
+		/* Batch the homomorphic check, the check on S with weight k_0 and
+		 * the BLS checks with weights k_i, for random 128-bit k_0 and k_i. */
 		g1_get_ord(n);
-		g1_get_gen(g1);
-		g2_get_gen(g2);
-
-		for (int i = 0; i < slen; i++) {
+		for (i = 0; i < slen; i++) {
 			g2_write_bin(buf, 4 * RLC_FP_BYTES + 1, z[i], 0);
 			memcpy(buf + 4 * RLC_FP_BYTES + 1, data, dlen);
-			if (cp_bls_ver(sig[i], buf, 1 + 4 * RLC_FP_BYTES + dlen, pk[i]) == 0) {
-				result = 0;
-			}
+			bn_rand(k[slen + 2 + i], RLC_POS, 128);
+			g1_map(p[2 * slen + i], buf, len);
+			g1_mul(p[2 * slen + i], p[2 * slen + i], k[slen + 2 + i]);
+			g1_neg(p[2 * slen + i], p[2 * slen + i]);
+			g2_copy(q[2 * slen + i], pk[i]);
+			g1_copy(p[i], a[i]);
+			g2_copy(q[i], z[i]);
+			g1_neg(p[slen + i], c[i]);
+			g2_copy(q[slen + i], y[i]);
 		}
 
-		pc_map_sim(e, a, z, slen);
-		pc_map_sim(u, c, y, slen);
-		pc_map(v, r, g2);
-		gt_mul(u, u, v);
-
-		for (int i = 0; i < slen; i++) {
-			for (int j = 0; j < flen[i]; j++) {
+		/* Compute T = -R + k_0(\sum C_i - msg * H) + \sum k_i sig_i. */
+		bn_rand(k[1], RLC_POS, 128);
+		g1_copy(t[0], r);
+		bn_set_dig(k[0], 1);
+		bn_neg(k[0], k[0]);
+		for (i = 0; i < slen; i++) {
+			g1_copy(t[1 + i], c[i]);
+			bn_copy(k[1 + i], k[1]);
+			g1_copy(t[slen + 2 + i], sig[i]);
+		}
+		g1_copy(t[slen + 1], h);
+		bn_mul(k[slen + 1], k[1], msg);
+		bn_mod(k[slen + 1], k[slen + 1], n);
+		bn_neg(k[slen + 1], k[slen + 1]);
+		g1_mul_gen(p[3 * slen], k[1]);
+		g2_copy(q[3 * slen], s);
+		g1_mul_sim_lot(p[3 * slen + 1], (const g1_t *)t, (const bn_t *)k,
+				2 * slen + 2);
+		g2_get_gen(q[3 * slen + 1]);
+		pc_map_sim(e, p, q, 3 * slen + 2);
+
+		gt_set_unity(u);
+		for (i = 0; i < slen; i++) {
+			for (j = 0; j < flen[i]; j++) {
 				gt_exp_dig(v, hs[i][label[j]], f[i][j]);
 				gt_mul(u, u, v);
 			}
 		}
-		if (gt_cmp(e, u) != RLC_EQ) {
-			result = 0;
-		}
-
-		pc_map(e, g1, s);
-		g1_set_infty(g1);
-		for (int i = 0; i < slen; i++) {
-			g1_add(g1, g1, c[i]);
-		}
-		g1_norm(g1, g1);
-		pc_map(u, g1, g2);
-		gt_mul(e, e, u);
-
-		g1_mul(g1, h, msg);
-		pc_map(v, g1, g2);
-		if (gt_cmp(e, v) != RLC_EQ) {
-			result = 0;
+		if (gt_cmp(e, u) == RLC_EQ) {
+			result = 1;
 		}
 	}
 	CATCH_ANY {
 		THROW(ERR_CAUGHT);
 	}
 	FINALLY {
-		g1_free(g1);
-		g2_free(g2);
+		bn_free(n);
 		gt_free(e);
 		gt_free(u);
 		gt_free(v);
-		bn_free(k);
-		bn_free(n);
+		if (p != NULL && q != NULL) {
+			for (i = 0; i < 3 * slen + 2; i++) {
+				g1_free(p[i]);
+				g2_free(q[i]);
+			}
+		}
+		if (t != NULL && k != NULL) {
+			for (i = 0; i < 2 * slen + 2; i++) {
+				g1_free(t[i]);
+				bn_free(k[i]);
+			}
+		}
+		RLC_FREE(p);
+		RLC_FREE(t);
+		RLC_FREE(q);
+		RLC_FREE(k);
 		RLC_FREE(buf);
 	}
 	return result;
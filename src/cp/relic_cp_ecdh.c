@@ -29,10 +29,139 @@
  * @ingroup cp
  */
 
+#include <string.h>
+
 #include "relic.h"
 #include "relic_test.h"
 #include "relic_bench.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Size in bytes of X25519 scalars and u-coordinates.
+ */
+#define X25519_BYTES	32
+
+/**
+ * Multiplies a point on Curve25519 by a scalar using the x-only Montgomery
+ * ladder from RFC 7748. The ladder runs over all 255 bits of the clamped
+ * scalar and uses conditional swaps, so its sequence of operations does not
+ * depend on the scalar.
+ *
+ * @param[out] out			- the resulting u-coordinate.
+ * @param[in] k				- the scalar.
+ * @param[in] u				- the input u-coordinate.
+ */
+static void x25519(uint8_t *out, const uint8_t *k, const uint8_t *u) {
+	fp_t x1, x2, z2, x3, z3, t0, t1, t2, t3;
+	uint8_t buf[X25519_BYTES];
+	bn_t e;
+	dig_t b, swap = 0;
+
+	fp_null(x1);
+	fp_null(x2);
+	fp_null(z2);
+	fp_null(x3);
+	fp_null(z3);
+	fp_null(t0);
+	fp_null(t1);
+	fp_null(t2);
+	fp_null(t3);
+	bn_null(e);
+
+	TRY {
+		fp_new(x1);
+		fp_new(x2);
+		fp_new(z2);
+		fp_new(x3);
+		fp_new(z3);
+		fp_new(t0);
+		fp_new(t1);
+		fp_new(t2);
+		fp_new(t3);
+		bn_new(e);
+
+		/* Decode u as little-endian, masking the most significant bit and
+		 * accepting non-canonical values. */
+		for (int i = 0; i < X25519_BYTES; i++) {
+			buf[i] = u[X25519_BYTES - 1 - i];
+		}
+		buf[0] &= 0x7F;
+		bn_read_bin(e, buf, X25519_BYTES);
+		fp_prime_conv(x1, e);
+
+		/* Clamp the scalar. */
+		memcpy(buf, k, X25519_BYTES);
+		buf[0] &= 0xF8;
+		buf[X25519_BYTES - 1] &= 0x7F;
+		buf[X25519_BYTES - 1] |= 0x40;
+
+		fp_set_dig(x2, 1);
+		fp_zero(z2);
+		fp_copy(x3, x1);
+		fp_set_dig(z3, 1);
+
+		for (int i = 254; i >= 0; i--) {
+			b = (buf[i >> 3] >> (i & 7)) & 1;
+			swap ^= b;
+			dv_swap_cond(x2, x3, RLC_FP_DIGS, swap);
+			dv_swap_cond(z2, z3, RLC_FP_DIGS, swap);
+			swap = b;
+
+			/* Differential addition and doubling, with (A + 2)/4 = 121666. */
+			fp_add(t0, x2, z2);
+			fp_sub(t1, x2, z2);
+			fp_add(t2, x3, z3);
+			fp_sub(t3, x3, z3);
+			fp_mul(t3, t3, t0);
+			fp_mul(t2, t2, t1);
+			fp_sqr(t0, t0);
+			fp_sqr(t1, t1);
+			fp_add(x3, t3, t2);
+			fp_sub(z3, t3, t2);
+			fp_sqr(x3, x3);
+			fp_sqr(z3, z3);
+			fp_mul(z3, z3, x1);
+			fp_mul(x2, t0, t1);
+			fp_sub(t0, t0, t1);
+			fp_mul_dig(z2, t0, 121666);
+			fp_add(z2, z2, t1);
+			fp_mul(z2, z2, t0);
+		}
+		dv_swap_cond(x2, x3, RLC_FP_DIGS, swap);
+		dv_swap_cond(z2, z3, RLC_FP_DIGS, swap);
+
+		/* Compute x2/z2 with the public exponent p - 2, mapping 0 to 0. */
+		bn_read_raw(e, fp_prime_get(), RLC_FP_DIGS);
+		bn_sub_dig(e, e, 2);
+		fp_exp(z2, z2, e);
+		fp_mul(x2, x2, z2);
+
+		fp_prime_back(e, x2);
+		bn_write_bin(buf, X25519_BYTES, e);
+		for (int i = 0; i < X25519_BYTES; i++) {
+			out[i] = buf[X25519_BYTES - 1 - i];
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(x1);
+		fp_free(x2);
+		fp_free(z2);
+		fp_free(x3);
+		fp_free(z3);
+		fp_free(t0);
+		fp_free(t1);
+		fp_free(t2);
+		fp_free(t3);
+		bn_free(e);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -100,3 +229,47 @@ int cp_ecdh_key(uint8_t *key, int key_len, bn_t d, ec_t q) {
 	}
 	return result;
 }
+
+int cp_x25519_gen(uint8_t *k, uint8_t *q) {
+	uint8_t g[X25519_BYTES] = { 9 };
+	int result = RLC_OK;
+
+	if (fp_param_get() != PRIME_25519) {
+		return RLC_ERR;
+	}
+
+	TRY {
+		rand_bytes(k, X25519_BYTES);
+		x25519(q, k, g);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+
+	return result;
+}
+
+int cp_x25519_key(uint8_t *key, uint8_t *k, uint8_t *q) {
+	uint8_t z = 0;
+	int result = RLC_OK;
+
+	if (fp_param_get() != PRIME_25519) {
+		return RLC_ERR;
+	}
+
+	TRY {
+		x25519(key, k, q);
+		/* Reject points of small order, which give an all-zero secret. */
+		for (int i = 0; i < X25519_BYTES; i++) {
+			z |= key[i];
+		}
+		if (z == 0) {
+			result = RLC_ERR;
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+
+	return result;
+}
@@ -32,6 +32,112 @@
 #include "relic.h"
 #include "relic_test.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Verifies an ECDSA signature, multiplying the public key with a precomputed
+ * table if one is given.
+ *
+ * @param[in] r				- the first component of the signature.
+ * @param[in] s				- the second component of the signature.
+ * @param[in] msg			- the signed message.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] hash			- the flag to indicate the message format.
+ * @param[in] q				- the public key.
+ * @param[in] t				- the table for the public key, or NULL.
+ * @return a boolean value indicating if the signature is valid.
+ */
+static int ecdsa_ver(bn_t r, bn_t s, uint8_t *msg, int len, int hash, ec_t q,
+		const ec_t *t) {
+	bn_t n, k, e, v;
+	ec_t p, u;
+	uint8_t h[RLC_MD_LEN];
+	int result = 0;
+
+	bn_null(n);
+	bn_null(k);
+	bn_null(e);
+	bn_null(v);
+	ec_null(p);
+	ec_null(u);
+
+	TRY {
+		bn_new(n);
+		bn_new(e);
+		bn_new(v);
+		bn_new(k);
+		ec_new(p);
+		ec_new(u);
+
+		ec_curve_get_ord(n);
+
+		if (bn_sign(r) == RLC_POS && bn_sign(s) == RLC_POS &&
+				!bn_is_zero(r) && !bn_is_zero(s)) {
+			if (bn_cmp(r, n) == RLC_LT && bn_cmp(s, n) == RLC_LT) {
+				bn_gcd_ext(e, k, NULL, s, n);
+				if (bn_sign(k) == RLC_NEG) {
+					bn_add(k, k, n);
+				}
+
+				if (!hash) {
+					md_map(h, msg, len);
+					msg = h;
+					len = RLC_MD_LEN;
+				}
+				if (8 * len > bn_bits(n)) {
+					len = RLC_CEIL(bn_bits(n), 8);
+					bn_read_bin(e, msg, len);
+					bn_rsh(e, e, 8 * len - bn_bits(n));
+				} else {
+					bn_read_bin(e, msg, len);
+				}
+
+				bn_mul(e, e, k);
+				bn_mod(e, e, n);
+				bn_mul(v, r, k);
+				bn_mod(v, v, n);
+
+				if (t == NULL) {
+					ec_mul_sim_gen(p, e, q, v);
+				} else {
+					ec_mul_gen(p, e);
+					ec_mul_fix(u, t, v);
+					ec_add(p, p, u);
+					ec_norm(p, p);
+				}
+				ec_get_x(v, p);
+
+				bn_mod(v, v, n);
+
+				result = dv_cmp_const(v->dp, r->dp, RLC_MIN(v->used, r->used));
+				result = (result == RLC_NE ? 0 : 1);
+
+				if (v->used != r->used) {
+					result = 0;
+				}
+
+				if (ec_is_infty(p)) {
+					result = 0;
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(n);
+		bn_free(e);
+		bn_free(v);
+		bn_free(k);
+		ec_free(p);
+		ec_free(u);
+	}
+	return result;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -126,79 +232,10 @@ int cp_ecdsa_sig(bn_t r, bn_t s, uint8_t *msg, int len, int hash, bn_t d) {
 }
 
 int cp_ecdsa_ver(bn_t r, bn_t s, uint8_t *msg, int len, int hash, ec_t q) {
-	bn_t n, k, e, v;
-	ec_t p;
-	uint8_t h[RLC_MD_LEN];
-	int result = 0;
-
-	bn_null(n);
-	bn_null(k);
-	bn_null(e);
-	bn_null(v);
-	ec_null(p);
-
-	TRY {
-		bn_new(n);
-		bn_new(e);
-		bn_new(v);
-		bn_new(k);
-		ec_new(p);
-
-		ec_curve_get_ord(n);
-
-		if (bn_sign(r) == RLC_POS && bn_sign(s) == RLC_POS &&
-				!bn_is_zero(r) && !bn_is_zero(s)) {
-			if (bn_cmp(r, n) == RLC_LT && bn_cmp(s, n) == RLC_LT) {
-				bn_gcd_ext(e, k, NULL, s, n);
-				if (bn_sign(k) == RLC_NEG) {
-					bn_add(k, k, n);
-				}
-
-				if (!hash) {
-					md_map(h, msg, len);
-					msg = h;
-					len = RLC_MD_LEN;
-				}
-				if (8 * len > bn_bits(n)) {
-					len = RLC_CEIL(bn_bits(n), 8);
-					bn_read_bin(e, msg, len);
-					bn_rsh(e, e, 8 * len - bn_bits(n));
-				} else {
-					bn_read_bin(e, msg, len);
-				}
-
-				bn_mul(e, e, k);
-				bn_mod(e, e, n);
-				bn_mul(v, r, k);
-				bn_mod(v, v, n);
-
-				ec_mul_sim_gen(p, e, q, v);
-				ec_get_x(v, p);
-
-				bn_mod(v, v, n);
-
-				result = dv_cmp_const(v->dp, r->dp, RLC_MIN(v->used, r->used));
-				result = (result == RLC_NE ? 0 : 1);
-
-				if (v->used != r->used) {
-					result = 0;
-				}
+	return ecdsa_ver(r, s, msg, len, hash, q, NULL);
+}
 
-				if (ec_is_infty(p)) {
-					result = 0;
-				}
-			}
-		}
-	}
-	CATCH_ANY {
-		THROW(ERR_CAUGHT);
-	}
-	FINALLY {
-		bn_free(n);
-		bn_free(e);
-		bn_free(v);
-		bn_free(k);
-		ec_free(p);
-	}
-	return result;
+int cp_ecdsa_ver_pre(bn_t r, bn_t s, uint8_t *msg, int len, int hash,
+		const ec_t *t) {
+	return ecdsa_ver(r, s, msg, len, hash, NULL, t);
 }
@@ -32,6 +32,99 @@
 #include "relic.h"
 #include "relic_test.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Verifies an Elliptic Curve Schnorr Signature, multiplying the public key
+ * with a precomputed table if one is given.
+ *
+ * @param[in] e				- the first component of the signature.
+ * @param[in] s				- the second component of the signature.
+ * @param[in] msg			- the signed message.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] q				- the public key.
+ * @param[in] t				- the table for the public key, or NULL.
+ * @return a boolean value indicating if the signature is valid.
+ */
+static int ecss_ver(bn_t e, bn_t s, uint8_t *msg, int len, ec_t q,
+		const ec_t *t) {
+	bn_t n, ev, rv;
+	ec_t p, u;
+	uint8_t hash[RLC_MD_LEN];
+	uint8_t *m = RLC_ALLOCA(uint8_t, len + RLC_FC_BYTES);
+	int result = 0;
+
+	bn_null(n);
+	bn_null(ev);
+	bn_null(rv);
+	ec_null(p);
+	ec_null(u);
+
+	TRY {
+		bn_new(n);
+		bn_new(ev);
+		bn_new(rv);
+		ec_new(p);
+		ec_new(u);
+		if (m == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+
+		ec_curve_get_ord(n);
+
+		if (bn_sign(e) == RLC_POS && bn_sign(s) == RLC_POS && !bn_is_zero(s)) {
+			if (bn_cmp(e, n) == RLC_LT && bn_cmp(s, n) == RLC_LT) {
+				if (t == NULL) {
+					ec_mul_sim_gen(p, s, q, e);
+				} else {
+					ec_mul_gen(p, s);
+					ec_mul_fix(u, t, e);
+					ec_add(p, p, u);
+					ec_norm(p, p);
+				}
+				ec_get_x(rv, p);
+
+				bn_mod(rv, rv, n);
+
+				memcpy(m, msg, len);
+				bn_write_bin(m + len, RLC_FC_BYTES, rv);
+				md_map(hash, m, len + RLC_FC_BYTES);
+
+				if (8 * RLC_MD_LEN > bn_bits(n)) {
+					len = RLC_CEIL(bn_bits(n), 8);
+					bn_read_bin(ev, hash, len);
+					bn_rsh(ev, ev, 8 * RLC_MD_LEN - bn_bits(n));
+				} else {
+					bn_read_bin(ev, hash, RLC_MD_LEN);
+				}
+
+				bn_mod(ev, ev, n);
+
+				result = dv_cmp_const(ev->dp, e->dp, RLC_MIN(ev->used, e->used));
+				result = (result == RLC_NE ? 0 : 1);
+
+				if (ev->used != e->used) {
+					result = 0;
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(n);
+		bn_free(ev);
+		bn_free(rv);
+		ec_free(p);
+		ec_free(u);
+		RLC_FREE(m);
+	}
+	return result;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -124,67 +217,9 @@ int cp_ecss_sig(bn_t e, bn_t s, uint8_t *msg, int len, bn_t d) {
 }
 
 int cp_ecss_ver(bn_t e, bn_t s, uint8_t *msg, int len, ec_t q) {
-	bn_t n, ev, rv;
-	ec_t p;
-	uint8_t hash[RLC_MD_LEN];
-	uint8_t *m = RLC_ALLOCA(uint8_t, len + RLC_FC_BYTES);
-	int result = 0;
-
-	bn_null(n);
-	bn_null(ev);
-	bn_null(rv);
-	ec_null(p);
-
-	TRY {
-		bn_new(n);
-		bn_new(ev);
-		bn_new(rv);
-		ec_new(p);
-		if (m == NULL) {
-			THROW(ERR_NO_MEMORY);
-		}
-
-		ec_curve_get_ord(n);
-
-		if (bn_sign(e) == RLC_POS && bn_sign(s) == RLC_POS && !bn_is_zero(s)) {
-			if (bn_cmp(e, n) == RLC_LT && bn_cmp(s, n) == RLC_LT) {
-				ec_mul_sim_gen(p, s, q, e);
-				ec_get_x(rv, p);
-
-				bn_mod(rv, rv, n);
-
-				memcpy(m, msg, len);
-				bn_write_bin(m + len, RLC_FC_BYTES, rv);
-				md_map(hash, m, len + RLC_FC_BYTES);
-
-				if (8 * RLC_MD_LEN > bn_bits(n)) {
-					len = RLC_CEIL(bn_bits(n), 8);
-					bn_read_bin(ev, hash, len);
-					bn_rsh(ev, ev, 8 * RLC_MD_LEN - bn_bits(n));
-				} else {
-					bn_read_bin(ev, hash, RLC_MD_LEN);
-				}
-
-				bn_mod(ev, ev, n);
-
-				result = dv_cmp_const(ev->dp, e->dp, RLC_MIN(ev->used, e->used));
-				result = (result == RLC_NE ? 0 : 1);
+	return ecss_ver(e, s, msg, len, q, NULL);
+}
 
-				if (ev->used != e->used) {
-					result = 0;
-				}
-			}
-		}
-	}
-	CATCH_ANY {
-		THROW(ERR_CAUGHT);
-	}
-	FINALLY {
-		bn_free(n);
-		bn_free(ev);
-		bn_free(rv);
-		ec_free(p);
-		RLC_FREE(m);
-	}
-	return result;
+int cp_ecss_ver_pre(bn_t e, bn_t s, uint8_t *msg, int len, const ec_t *t) {
+	return ecss_ver(e, s, msg, len, NULL, t);
 }
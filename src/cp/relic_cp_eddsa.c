@@ -0,0 +1,336 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the EdDSA protocol.
+ *
+ * @ingroup cp
+ */
+
+#include <string.h>
+
+#include "relic.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Encodes an Edwards curve point following RFC 8032, as the little-endian
+ * y-coordinate with the parity of the x-coordinate in the most significant bit.
+ *
+ * @param[out] bin			- the buffer to store the encoding.
+ * @param[in] p				- the point to encode.
+ */
+static void eddsa_write(uint8_t *bin, const ed_t p) {
+	uint8_t x[RLC_FP_BYTES], y[RLC_FP_BYTES];
+	ed_t t;
+
+	ed_null(t);
+
+	TRY {
+		ed_new(t);
+
+		ed_norm(t, p);
+		fp_write_bin(x, RLC_FP_BYTES, t->x);
+		fp_write_bin(y, RLC_FP_BYTES, t->y);
+		for (int i = 0; i < RLC_FP_BYTES; i++) {
+			bin[i] = y[RLC_FP_BYTES - 1 - i];
+		}
+		bin[RLC_FP_BYTES - 1] |= (x[RLC_FP_BYTES - 1] & 1) << 7;
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		ed_free(t);
+	}
+}
+
+/**
+ * Reads a little-endian integer from a byte vector.
+ *
+ * @param[out] a			- the result.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the number of bytes to read.
+ */
+static void eddsa_read(bn_t a, const uint8_t *bin, int len) {
+	uint8_t t[RLC_MD_LEN_SH512];
+
+	for (int i = 0; i < len; i++) {
+		t[i] = bin[len - 1 - i];
+	}
+	bn_read_bin(a, t, len);
+}
+
+/**
+ * Expands the private key into the secret scalar and the nonce prefix.
+ *
+ * @param[out] d			- the secret scalar.
+ * @param[out] h			- the hashed key, with the prefix in the upper half.
+ * @param[in] k				- the private key.
+ */
+static void eddsa_expand(bn_t d, uint8_t *h, const uint8_t *k) {
+	md_map_sh512(h, k, RLC_FP_BYTES);
+	h[0] &= 0xF8;
+	h[RLC_FP_BYTES - 1] &= 0x7F;
+	h[RLC_FP_BYTES - 1] |= 0x40;
+	eddsa_read(d, h, RLC_FP_BYTES);
+}
+
+/**
+ * Computes the challenge H(R || A || M) reduced modulo the group order.
+ *
+ * @param[out] e			- the challenge.
+ * @param[in] r				- the commitment point.
+ * @param[in] q				- the public key.
+ * @param[in] msg			- the message.
+ * @param[in] len			- the message length in bytes.
+ * @param[in] n				- the group order.
+ */
+static void eddsa_hash(bn_t e, const ed_t r, const ed_t q, const uint8_t *msg,
+		int len, bn_t n) {
+	uint8_t h[RLC_MD_LEN_SH512];
+	uint8_t *buf = RLC_ALLOCA(uint8_t, 2 * RLC_FP_BYTES + len);
+
+	TRY {
+		if (buf == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		eddsa_write(buf, r);
+		eddsa_write(buf + RLC_FP_BYTES, q);
+		memcpy(buf + 2 * RLC_FP_BYTES, msg, len);
+		md_map_sh512(h, buf, 2 * RLC_FP_BYTES + len);
+		eddsa_read(e, h, RLC_MD_LEN_SH512);
+		bn_mod(e, e, n);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		RLC_FREE(buf);
+	}
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+int cp_eddsa_gen(uint8_t *k, ed_t q) {
+	uint8_t h[RLC_MD_LEN_SH512];
+	bn_t d, n;
+	int result = RLC_OK;
+
+	bn_null(d);
+	bn_null(n);
+
+	TRY {
+		bn_new(d);
+		bn_new(n);
+
+		ed_curve_get_ord(n);
+		rand_bytes(k, RLC_FP_BYTES);
+		eddsa_expand(d, h, k);
+		bn_mod(d, d, n);
+		ed_mul_gen(q, d);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_free(d);
+		bn_free(n);
+	}
+	return result;
+}
+
+int cp_eddsa_sig(ed_t r, bn_t s, uint8_t *msg, int len, uint8_t *k, ed_t q) {
+	uint8_t h[RLC_MD_LEN_SH512], *buf = RLC_ALLOCA(uint8_t, RLC_FP_BYTES + len);
+	bn_t d, e, n;
+	int result = RLC_OK;
+
+	bn_null(d);
+	bn_null(e);
+	bn_null(n);
+
+	TRY {
+		bn_new(d);
+		bn_new(e);
+		bn_new(n);
+
+		if (buf == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+
+		ed_curve_get_ord(n);
+		eddsa_expand(d, h, k);
+
+		/* The nonce is derived deterministically from the key and message. */
+		memcpy(buf, h + RLC_FP_BYTES, RLC_FP_BYTES);
+		memcpy(buf + RLC_FP_BYTES, msg, len);
+		md_map_sh512(h, buf, RLC_FP_BYTES + len);
+		eddsa_read(s, h, RLC_MD_LEN_SH512);
+		bn_mod(s, s, n);
+		ed_mul_gen(r, s);
+
+		/* s = r + H(R || A || M) * d mod n. */
+		eddsa_hash(e, r, q, msg, len, n);
+		bn_mul(e, e, d);
+		bn_add(s, s, e);
+		bn_mod(s, s, n);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_free(d);
+		bn_free(e);
+		bn_free(n);
+		RLC_FREE(buf);
+	}
+	return result;
+}
+
+int cp_eddsa_ver(ed_t r, bn_t s, uint8_t *msg, int len, ed_t q) {
+	bn_t e, n;
+	ed_t p;
+	int result = 0;
+
+	bn_null(e);
+	bn_null(n);
+	ed_null(p);
+
+	TRY {
+		bn_new(e);
+		bn_new(n);
+		ed_new(p);
+
+		ed_curve_get_ord(n);
+
+		if (bn_sign(s) == RLC_POS && bn_cmp(s, n) == RLC_LT) {
+			/* Check if h(sB - H(R || A || M)A - R) = 0, as in RFC 8032. */
+			eddsa_hash(e, r, q, msg, len, n);
+			bn_sub(e, n, e);
+			ed_mul_sim_gen(p, s, q, e);
+			ed_sub(p, p, r);
+			ed_curve_get_cof(e);
+			ed_mul(p, p, e);
+			result = ed_is_infty(p);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(e);
+		bn_free(n);
+		ed_free(p);
+	}
+	return result;
+}
+
+int cp_eddsa_ver_sim(ed_t *r, bn_t *s, uint8_t *msgs[], int lens[], ed_t *q,
+		int n) {
+	bn_t e, t, z, ord, *k = RLC_ALLOCA(bn_t, 2 * n);
+	ed_t g, p, *u = RLC_ALLOCA(ed_t, 2 * n);
+	int i, result = 1;
+
+	bn_null(e);
+	bn_null(t);
+	bn_null(z);
+	bn_null(ord);
+	ed_null(g);
+	ed_null(p);
+
+	TRY {
+		bn_new(e);
+		bn_new(t);
+		bn_new(z);
+		bn_new(ord);
+		ed_new(g);
+		ed_new(p);
+		if (k == NULL || u == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < 2 * n; i++) {
+			bn_null(k[i]);
+			bn_new(k[i]);
+			ed_null(u[i]);
+			ed_new(u[i]);
+		}
+
+		ed_curve_get_ord(ord);
+
+		/* Check if (sum z_i s_i)B - sum z_i R_i - sum z_i H_i A_i = 0 for
+		 * random 128-bit z_i, multiplied by the cofactor. */
+		bn_zero(t);
+		for (i = 0; i < n && result; i++) {
+			if (bn_sign(s[i]) == RLC_NEG || bn_cmp(s[i], ord) != RLC_LT) {
+				result = 0;
+			} else {
+				eddsa_hash(e, r[i], q[i], msgs[i], lens[i], ord);
+				bn_rand(z, RLC_POS, 128);
+				bn_mul(e, e, z);
+				bn_mod(k[2 * i + 1], e, ord);
+				bn_neg(k[2 * i + 1], k[2 * i + 1]);
+				ed_copy(u[2 * i + 1], q[i]);
+				bn_neg(k[2 * i], z);
+				ed_copy(u[2 * i], r[i]);
+				bn_mul(z, z, s[i]);
+				bn_add(t, t, z);
+				bn_mod(t, t, ord);
+			}
+		}
+
+		if (result) {
+			ed_mul_sim_lot(p, (const ed_t *)u, (const bn_t *)k, 2 * n);
+			ed_mul_gen(g, t);
+			ed_add(p, p, g);
+			ed_curve_get_cof(e);
+			ed_mul(p, p, e);
+			result = ed_is_infty(p);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(e);
+		bn_free(t);
+		bn_free(z);
+		bn_free(ord);
+		ed_free(g);
+		ed_free(p);
+		if (k != NULL && u != NULL) {
+			for (i = 0; i < 2 * n; i++) {
+				bn_free(k[i]);
+				ed_free(u[i]);
+			}
+		}
+		RLC_FREE(k);
+		RLC_FREE(u);
+	}
+	return result;
+}
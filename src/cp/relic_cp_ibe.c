@@ -34,41 +34,25 @@
 #include "relic_bench.h"
 
 /*============================================================================*/
-/* Public definitions                                                         */
+/* Private definitions                                                        */
 /*============================================================================*/
 
-int cp_ibe_gen(bn_t master, g1_t pub) {
-	bn_t n;
-	int result = RLC_OK;
-
-	bn_null(n);
-
-	TRY {
-		bn_new(n);
-
-		g1_get_ord(n);
-		bn_rand_mod(master, n);
-
-		/* K_pub = sG. */
-		g1_mul_gen(pub, master);
-	}
-	CATCH_ANY {
-		result = RLC_ERR;
-	}
-	FINALLY {
-		bn_free(n);
-	}
-	return result;
-}
-
-int cp_ibe_gen_prv(g2_t prv, char *id, int len, bn_t master) {
-	g2_map(prv, (uint8_t *)id, len);
-	g2_mul(prv, prv, master);
-	return RLC_OK;
-}
-
-int cp_ibe_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len,
-		char *id, int len, g1_t pub) {
+/**
+ * Encrypts a message using the BF-IBE protocol, taking the pairing of the
+ * public key with the identity from a cache if one is given.
+ *
+ * @param[out] out			- the output buffer.
+ * @param[in, out] out_len	- the buffer capacity and number of bytes written.
+ * @param[in] in			- the input buffer.
+ * @param[in] in_len		- the number of bytes to encrypt.
+ * @param[in] id			- the identity.
+ * @param[in] len			- the length of the identity in bytes.
+ * @param[in] pub			- the public key of the PKG.
+ * @param[in,out] c			- the cache of pairings, or NULL.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+static int ibe_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len,
+		char *id, int len, g1_t pub, idc_t c) {
 	int l, result = RLC_OK;
 	uint8_t *buf = NULL, h[RLC_MD_LEN];
 	bn_t n;
@@ -108,11 +92,24 @@ int cp_ibe_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len,
 
 		g1_get_ord(n);
 
-		/* q = H_1(ID). */
-		g2_map(q, (uint8_t *)id, len);
+		if (c != NULL) {
+			/* Pairings cached under another public key must not be used. */
+			g1_write_bin(buf, g1_size_bin(pub, 0), pub, 0);
+			if (cp_idc_bind(c, buf, g1_size_bin(pub, 0)) != RLC_OK) {
+				THROW(ERR_NO_VALID);
+			}
+		}
+
+		if (c == NULL || !cp_idc_get(e, c, (uint8_t *)id, len)) {
+			/* q = H_1(ID). */
+			g2_map(q, (uint8_t *)id, len);
 
-		/* e = e(K_pub, q). */
-		pc_map(e, pub, q);
+			/* e = e(K_pub, q). */
+			pc_map(e, pub, q);
+			if (c != NULL) {
+				cp_idc_put(c, (uint8_t *)id, len, e);
+			}
+		}
 
 		/* h = H_2(e^r). */
 		bn_rand_mod(r, n);
@@ -142,6 +139,53 @@ int cp_ibe_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len,
 	return result;
 }
 
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+int cp_ibe_gen(bn_t master, g1_t pub) {
+	bn_t n;
+	int result = RLC_OK;
+
+	bn_null(n);
+
+	TRY {
+		bn_new(n);
+
+		g1_get_ord(n);
+		bn_rand_mod(master, n);
+
+		/* K_pub = sG. */
+		g1_mul_gen(pub, master);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_free(n);
+	}
+	return result;
+}
+
+int cp_ibe_gen_prv(g2_t prv, char *id, int len, bn_t master) {
+	g2_map(prv, (uint8_t *)id, len);
+	g2_mul(prv, prv, master);
+	return RLC_OK;
+}
+
+int cp_ibe_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len,
+		char *id, int len, g1_t pub) {
+	return ibe_enc(out, out_len, in, in_len, id, len, pub, NULL);
+}
+
+int cp_ibe_enc_pre(uint8_t *out, int *out_len, uint8_t *in, int in_len,
+		char *id, int len, g1_t pub, idc_t c) {
+	if (c == NULL) {
+		return RLC_ERR;
+	}
+	return ibe_enc(out, out_len, in, in_len, id, len, pub, c);
+}
+
 int cp_ibe_dec(uint8_t *out, int *out_len, uint8_t *in, int in_len, g2_t prv) {
 	int l, result = RLC_OK;
 	uint8_t *buf = NULL, h[RLC_MD_LEN];
@@ -0,0 +1,214 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the cache of pairings with identities used by
+ * identity-based protocols.
+ *
+ * @ingroup cp
+ */
+
+#include <string.h>
+
+#include "relic.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Returns the index of an identity in the cache, or -1 if not found. Must be
+ * called with the cache locked.
+ *
+ * @param[in] c				- the cache.
+ * @param[in] key			- the hash of the identity.
+ * @param[in] id			- the identity.
+ * @param[in] len			- the length of the identity in bytes.
+ * @return the index of the entry.
+ */
+static int idc_find(idc_t c, uint64_t key, const uint8_t *id, int len) {
+	for (int i = 0; i < c->len; i++) {
+		if (c->keys[i] == key && c->lens[i] == len &&
+				memcmp(c->ids[i], id, len) == 0) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void cp_idc_make(idc_t c, int m) {
+	core_lock_init(c->lock);
+	if (m < 1) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+
+	c->len = c->hits = c->miss = c->bound = 0;
+	c->tick = 0;
+	c->ages = (uint64_t *)calloc(m, sizeof(uint64_t));
+	c->keys = (uint64_t *)calloc(m, sizeof(uint64_t));
+	c->lens = (int *)calloc(m, sizeof(int));
+	c->ids = (uint8_t **)calloc(m, sizeof(uint8_t *));
+	c->vals = (uint8_t **)calloc(m, sizeof(uint8_t *));
+	if (c->ages == NULL || c->keys == NULL || c->lens == NULL ||
+			c->ids == NULL || c->vals == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+	c->size = m;
+}
+
+void cp_idc_clean(idc_t c) {
+	if (c->ids != NULL) {
+		for (int i = 0; i < c->size; i++) {
+			free(c->ids[i]);
+		}
+	}
+	if (c->vals != NULL) {
+		for (int i = 0; i < c->size; i++) {
+			free(c->vals[i]);
+		}
+	}
+	free(c->ages);
+	free(c->keys);
+	free(c->lens);
+	free(c->ids);
+	free(c->vals);
+	c->ages = c->keys = NULL;
+	c->lens = NULL;
+	c->ids = c->vals = NULL;
+	c->size = c->len = c->hits = c->miss = c->bound = 0;
+	c->tick = 0;
+	core_lock_clean(c->lock);
+}
+
+int cp_idc_bind(idc_t c, const uint8_t *key, int len) {
+	uint8_t h[RLC_MD_LEN];
+	int result = RLC_OK;
+
+	md_map(h, key, len);
+	core_lock(c->lock);
+	if (!c->bound) {
+		memcpy(c->key, h, RLC_MD_LEN);
+		c->bound = 1;
+	} else if (memcmp(c->key, h, RLC_MD_LEN) != 0) {
+		result = RLC_ERR;
+	}
+	core_unlock(c->lock);
+
+	return result;
+}
+
+int cp_idc_get(gt_t e, idc_t c, const uint8_t *id, int len) {
+	uint64_t key = util_hash(id, len);
+	int i, size = gt_size_bin(e, 0), result = 0;
+	uint8_t *bin = RLC_ALLOCA(uint8_t, size);
+
+	if (bin == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return 0;
+	}
+
+	core_lock(c->lock);
+	i = idc_find(c, key, id, len);
+	if (i >= 0) {
+		memcpy(bin, c->vals[i], size);
+		c->ages[i] = ++c->tick;
+		c->hits++;
+		result = 1;
+	} else {
+		c->miss++;
+	}
+	core_unlock(c->lock);
+
+	/* Decode outside the lock, since decoding may throw. */
+	if (result) {
+		gt_read_bin(e, bin, size);
+	}
+	RLC_FREE(bin);
+	return result;
+}
+
+void cp_idc_put(idc_t c, const uint8_t *id, int len, gt_t e) {
+	uint64_t key = util_hash(id, len);
+	int i, size = gt_size_bin(e, 0);
+	uint8_t *t, *bin = RLC_ALLOCA(uint8_t, size);
+
+	if (bin == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+	/* Encode outside the lock, since encoding may throw. */
+	gt_write_bin(bin, size, e, 0);
+
+	core_lock(c->lock);
+	i = idc_find(c, key, id, len);
+	if (i < 0) {
+		if (c->len < c->size) {
+			/* Only claim the slot once its value buffer exists. */
+			t = (uint8_t *)malloc(size);
+			if (t == NULL) {
+				core_unlock(c->lock);
+				RLC_FREE(bin);
+				THROW(ERR_NO_MEMORY);
+				return;
+			}
+			i = c->len++;
+			c->vals[i] = t;
+		} else {
+			/* Replace the least recently used entry. */
+			i = 0;
+			for (int j = 1; j < c->len; j++) {
+				if (c->ages[j] < c->ages[i]) {
+					i = j;
+				}
+			}
+		}
+		t = (uint8_t *)realloc(c->ids[i], RLC_MAX(len, 1));
+		if (t == NULL) {
+			/* Drop the entry so that lookups never see a partial one. */
+			if (t != NULL) {
+				c->ids[i] = t;
+			}
+			c->lens[i] = -1;
+			core_unlock(c->lock);
+			RLC_FREE(bin);
+			THROW(ERR_NO_MEMORY);
+			return;
+		}
+		c->ids[i] = t;
+		memcpy(c->ids[i], id, len);
+		c->lens[i] = len;
+		c->keys[i] = key;
+	}
+	memcpy(c->vals[i], bin, size);
+	c->ages[i] = ++c->tick;
+	core_unlock(c->lock);
+	RLC_FREE(bin);
+}
@@ -31,6 +31,120 @@
 
 #include "relic.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Verifies a MKLHS signature with either small or full-width coefficients.
+ * The labels are hashed once for all users and the signature is checked with
+ * a single multi-pairing.
+ *
+ * @param[in] sig 			- the homomorphic signature to verify.
+ * @param[in] m 			- the signed message.
+ * @param[in] mu			- the vector of signed messages per user.
+ * @param[in] label 		- the vector of labels.
+ * @param[in] llen 			- the vector of label lengths.
+ * @param[in] d 			- the small coefficients, or NULL.
+ * @param[in] b 			- the full-width coefficients, or NULL.
+ * @param[in] flen			- the number of coefficients.
+ * @param[in] pk 			- the public keys of the users.
+ * @param[in] slen 			- the number of signatures.
+ * @return a boolean value indicating the verification result.
+ */
+static int mklhs_ver(g1_t sig, bn_t m, bn_t mu[], char *label[], int llen[],
+		dig_t d[][RLC_TERMS], bn_t *b[], int flen[], g2_t pk[], int slen) {
+	bn_t t, n;
+	g1_t *g = RLC_ALLOCA(g1_t, slen + 1), *h = NULL;
+	g2_t *q = RLC_ALLOCA(g2_t, slen + 1);
+	gt_t e;
+	int fmax = 0, result = 0;
+
+	for (int i = 0; i < slen; i++) {
+		fmax = RLC_MAX(fmax, flen[i]);
+	}
+
+	bn_null(t);
+	bn_null(n);
+	gt_null(e);
+
+	TRY {
+		bn_new(t);
+		bn_new(n);
+		gt_new(e);
+		/* Labels are kept in the heap, since there may be many of them. */
+		h = (g1_t *)calloc(RLC_MAX(fmax, 1), sizeof(g1_t));
+		if (g == NULL || q == NULL || h == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (int j = 0; j <= slen; j++) {
+			g1_null(g[j]);
+			g2_null(q[j]);
+			g1_new(g[j]);
+			g2_new(q[j]);
+		}
+		for (int j = 0; j < fmax; j++) {
+			g1_null(h[j]);
+			g1_new(h[j]);
+		}
+
+		bn_zero(t);
+		g1_get_ord(n);
+		for (int j = 0; j < slen; j++) {
+			bn_add(t, t, mu[j]);
+			bn_mod(t, t, n);
+		}
+
+		if (bn_cmp(m, t) == RLC_EQ) {
+			for (int j = 0; j < fmax; j++) {
+				g1_map(h[j], (uint8_t *)label[j], llen[j]);
+			}
+			for (int i = 0; i < slen; i++) {
+				if (d != NULL) {
+					g1_mul_sim_dig(g[i], h, d[i], flen[i]);
+				} else {
+					g1_mul_sim_lot(g[i], (const g1_t *)h, (const bn_t *)b[i],
+							flen[i]);
+				}
+				g1_mul_gen(g[slen], mu[i]);
+				g1_add(g[i], g[i], g[slen]);
+				g1_norm(g[i], g[i]);
+				g2_copy(q[i], pk[i]);
+			}
+			/* Check that e(sig, g2) = \prod e(g_i, pk_i) at once. */
+			g1_neg(g[slen], sig);
+			g2_get_gen(q[slen]);
+			pc_map_sim(e, g, q, slen + 1);
+			if (gt_is_unity(e)) {
+				result = 1;
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(t);
+		bn_free(n);
+		gt_free(e);
+		if (g != NULL && q != NULL) {
+			for (int j = 0; j <= slen; j++) {
+				g1_free(g[j]);
+				g2_free(q[j]);
+			}
+		}
+		if (h != NULL) {
+			for (int j = 0; j < fmax; j++) {
+				g1_free(h[j]);
+			}
+		}
+		RLC_FREE(g);
+		RLC_FREE(q);
+		free(h);
+	}
+	return result;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -124,88 +238,53 @@ int cp_mklhs_evl(g1_t sig, g1_t s[], dig_t f[], int len) {
 	return result;
 }
 
-int cp_mklhs_ver(g1_t sig, bn_t m, bn_t mu[], char *label[], int llen[],
-		dig_t f[][RLC_TERMS], int flen[], g2_t pk[], int slen) {
-	bn_t t, n;
-	g1_t *g = RLC_ALLOCA(g1_t, slen);
-	g2_t g2;
-	gt_t c, e;
-	int fmax, ver1 = 0, ver2 = 0;
-
-	fmax = 0;
-	for (int i = 0; i < slen; i++) {
-		fmax = RLC_MAX(fmax, flen[i]);
-	}
-	g1_t *h = RLC_ALLOCA(g1_t, fmax);
+int cp_mklhs_fun_lot(bn_t mu, bn_t m[], bn_t f[], int len) {
+	bn_t n, t;
+	int result = RLC_OK;
 
-	bn_null(t);
 	bn_null(n);
-	g2_null(g2);
-	gt_null(c);
-	gt_null(e);
+	bn_null(t);
 
 	TRY {
-		bn_new(t);
 		bn_new(n);
-		g2_new(g2);
-		gt_new(c);
-		gt_new(e);
-		if (g == NULL || h == NULL) {
-			RLC_FREE(g);
-			RLC_FREE(h);
-			THROW(ERR_NO_MEMORY);
-		}
+		bn_new(t);
 
-		bn_zero(t);
 		g1_get_ord(n);
-		for (int j = 0; j < slen; j++) {
-			g1_null(g[j]);
-			g1_new(g[j]);
-			bn_add(t, t, mu[j]);
-			bn_mod(t, t, n);
-		}
-		for (int j = 0; j < fmax; j++) {
-			g1_null(h[j]);
-			g1_new(h[j]);
-		}
-
-		if (bn_cmp(m, t) == RLC_EQ) {
-			ver1 = 1;
-		}
-
-		for (int i = 0; i < slen; i++) {
-			for (int j = 0; j < flen[i]; j++) {
-				g1_map(h[j], (uint8_t *)label[j], llen[j]);
-			}
-			g1_mul_sim_dig(g[i], h, f[i], flen[i]);
-			g1_mul_gen(h[0], mu[i]);
-			g1_add(g[i], g[i], h[0]);
-		}
-
-		g2_get_gen(g2);
-		pc_map(e, sig, g2);
-		pc_map_sim(c, g, pk, slen);
-		if (gt_cmp(c, e) == RLC_EQ) {
-			ver2 = 1;
+		bn_zero(mu);
+		for (int i = 0; i < len; i++) {
+			bn_mul(t, m[i], f[i]);
+			bn_add(mu, mu, t);
+			bn_mod(mu, mu, n);
 		}
 	}
 	CATCH_ANY {
-		THROW(ERR_CAUGHT);
+		result = RLC_ERR;
 	}
 	FINALLY {
-		bn_new(t);
-		bn_new(n);
-		g2_free(g2);
-		gt_free(c);
-		gt_free(e);
-		for (int j = 0; j < slen; j++) {
-			g1_free(g[j]);
-		}
-		for (int j = 0; j < fmax; j++) {
-			g1_free(h[j]);
-		}
-		RLC_FREE(g);
-		RLC_FREE(h);
+		bn_free(n);
+		bn_free(t);
+	}
+	return result;
+}
+
+int cp_mklhs_evl_lot(g1_t sig, g1_t s[], bn_t f[], int len) {
+	int result = RLC_OK;
+
+	TRY {
+		g1_mul_sim_lot(sig, (const g1_t *)s, (const bn_t *)f, len);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
 	}
-	return (ver1 && ver2);
+	return result;
+}
+
+int cp_mklhs_ver(g1_t sig, bn_t m, bn_t mu[], char *label[], int llen[],
+		dig_t f[][RLC_TERMS], int flen[], g2_t pk[], int slen) {
+	return mklhs_ver(sig, m, mu, label, llen, f, NULL, flen, pk, slen);
+}
+
+int cp_mklhs_ver_lot(g1_t sig, bn_t m, bn_t mu[], char *label[], int llen[],
+		bn_t *f[], int flen[], g2_t pk[], int slen) {
+	return mklhs_ver(sig, m, mu, label, llen, NULL, f, flen, pk, slen);
 }
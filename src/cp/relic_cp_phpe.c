@@ -40,130 +40,340 @@
 #include "relic_md.h"
 
 /*============================================================================*/
-/* Public definitions                                                         */
+/* Private definitions                                                        */
 /*============================================================================*/
 
-int cp_phpe_gen(bn_t n, bn_t l, int bits) {
-	bn_t p, q;
-	int result = RLC_OK;
+/**
+ * Encrypts using the Paillier cryptosystem with a given randomizer.
+ *
+ * @param[out] out			- the output buffer.
+ * @param[in, out] out_len	- the buffer capacity and number of bytes written.
+ * @param[in] in			- the input buffer.
+ * @param[in] in_len		- the number of bytes to encrypt.
+ * @param[in] pub			- the public key.
+ * @param[in] r				- the randomizer r^n mod n^2.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+static int phpe_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len,
+		phpe_t pub, bn_t r) {
+	bn_t m, s;
+	int size, result = RLC_OK;
+
+	size = bn_size_bin(pub->n);
 
-	bn_null(p);
-	bn_null(q);
+	bn_null(m);
+	bn_null(s);
 
 	TRY {
-		bn_new(p);
-		bn_new(q);
+		bn_new(m);
+		bn_new(s);
 
-		/* Generate primes p and q of equivalent length. */
-		do {
-			bn_gen_prime(p, bits / 2);
-			bn_gen_prime(q, bits / 2);
-		} while (bn_cmp(p, q) == RLC_EQ);
+		/* Represent m as a padded element of Z_n. */
+		bn_read_bin(m, in, in_len);
 
-		/* Compute n = pq and l = \phi(n). */
-		bn_mul(n, p, q);
-		bn_sub_dig(p, p, 1);
-		bn_sub_dig(q, q, 1);
-		bn_mul(l, p, q);
+		/* Compute c = (g^m)(r^n) mod n^2, with g^m = 1 + mn for g = 1 + n. */
+		bn_sqr(s, pub->n);
+		bn_mul(m, m, pub->n);
+		bn_add_dig(m, m, 1);
+		bn_mul(m, m, r);
+		bn_mod(m, m, s);
+		if (2 * size <= *out_len) {
+			*out_len = 2 * size;
+			memset(out, 0, *out_len);
+			bn_write_bin(out, *out_len, m);
+		} else {
+			result = RLC_ERR;
+		}
 	}
 	CATCH_ANY {
 		result = RLC_ERR;
 	}
 	FINALLY {
-		bn_free(p);
-		bn_free(q);
+		bn_free(m);
+		bn_free(s);
 	}
 
 	return result;
 }
 
-int cp_phpe_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len, bn_t n) {
-	bn_t g, m, r, s;
-	int size, result = RLC_OK;
+/**
+ * Computes a fresh randomizer r^n mod n^2 for Paillier's encryption.
+ *
+ * @param[out] r			- the randomizer.
+ * @param[in] pub			- the public key.
+ */
+static void phpe_rand(bn_t r, phpe_t pub) {
+	bn_t s;
 
-	bn_null(g);
-	bn_null(m);
-	bn_null(r);
 	bn_null(s);
 
-	size = bn_size_bin(n);
+	TRY {
+		bn_new(s);
+
+		/* Generate r in Z_n^* and compute r^n mod n^2. */
+		bn_sqr(s, pub->n);
+		bn_rand_mod(r, pub->n);
+		bn_mxp(r, r, pub->n, s);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(s);
+	}
+}
+
+/**
+ * Computes the digest of a public key that binds a pool of randomizers to it.
+ *
+ * @param[out] h			- the digest.
+ * @param[in] pub			- the public key.
+ */
+static void phpe_print(uint8_t h[RLC_MD_LEN], phpe_t pub) {
+	int len = bn_size_bin(pub->n);
+	uint8_t *bin = RLC_ALLOCA(uint8_t, len);
+
+	if (bin == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+	bn_write_bin(bin, len, pub->n);
+	md_map(h, bin, len);
+	RLC_FREE(bin);
+}
+
+/**
+ * Computes the reduction context modulo n^2 shared by the vector operations.
+ *
+ * @param[out] s			- the modulus n^2.
+ * @param[out] u			- the reduction precomputation.
+ * @param[out] o			- the unity in the reduction representation.
+ * @param[out] r2			- the constant that converts into the representation.
+ * @param[in] pub			- the public key.
+ */
+static void phpe_ctx(bn_t s, bn_t u, bn_t o, bn_t r2, phpe_t pub) {
+	bn_sqr(s, pub->n);
+	bn_mod_pre(u, s);
+	bn_set_dig(o, 1);
+#if BN_MOD == MONTY
+	bn_mod_monty_conv(o, o, s);
+	bn_sqr(r2, o);
+	bn_mod(r2, r2, s);
+#else
+	bn_set_dig(r2, 1);
+#endif
+}
+
+/**
+ * Exponentiates with sliding windows modulo n^2, using a reduction context
+ * computed once for a whole vector. Both the base and the result are in the
+ * reduction representation.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the base.
+ * @param[in] k				- the non-negative exponent.
+ * @param[in] s				- the modulus n^2.
+ * @param[in] u				- the reduction precomputation.
+ * @param[in] o				- the unity in the reduction representation.
+ */
+static void phpe_mxp(bn_t c, const bn_t a, const bn_t k, const bn_t s,
+		const bn_t u, const bn_t o) {
+	bn_t tab[16], t;
+	uint8_t win[RLC_BN_BITS + 1];
+	int i, j, l, h, w;
+
+	bn_null(t);
+	for (i = 0; i < 16; i++) {
+		bn_null(tab[i]);
+	}
 
-	if (n == NULL || in_len <= 0 || in_len > size) {
+	TRY {
+		bn_new(t);
+		/* Use the window size of bn_mxp_slide, capped for the table. */
+		i = bn_bits(k);
+		w = (i <= 21 ? 2 : (i <= 32 ? 3 : (i <= 128 ? 4 : 5)));
+		h = 1 << (w - 1);
+		for (i = 0; i < h; i++) {
+			bn_new(tab[i]);
+		}
+
+		/* Table holds the odd powers a^1, a^3, ..., a^(2h - 1). */
+		bn_copy(tab[0], a);
+		bn_sqr(t, a);
+		bn_mod(t, t, s, u);
+		for (i = 1; i < h; i++) {
+			bn_mul(tab[i], tab[i - 1], t);
+			bn_mod(tab[i], tab[i], s, u);
+		}
+
+		bn_copy(t, o);
+		l = RLC_BN_BITS + 1;
+		bn_rec_slw(win, &l, k, w);
+		for (i = 0; i < l; i++) {
+			if (win[i] == 0) {
+				bn_sqr(t, t);
+				bn_mod(t, t, s, u);
+			} else {
+				for (j = 0; j < util_bits_dig(win[i]); j++) {
+					bn_sqr(t, t);
+					bn_mod(t, t, s, u);
+				}
+				bn_mul(t, t, tab[win[i] >> 1]);
+				bn_mod(t, t, s, u);
+			}
+		}
+		bn_copy(c, t);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(t);
+		for (i = 0; i < 16; i++) {
+			bn_free(tab[i]);
+		}
+	}
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+int cp_phpe_gen(phpe_t pub, phpe_t prv, int bits) {
+	bn_t t;
+	int result = RLC_OK;
+
+	if (pub == NULL || prv == NULL || bits == 0) {
 		return RLC_ERR;
 	}
 
+	bn_null(t);
+
 	TRY {
-		bn_new(g);
-		bn_new(m);
-		bn_new(r);
-		bn_new(s);
+		bn_new(t);
 
-		/* Represent m as a padded element of Z_n. */
-		bn_read_bin(m, in, in_len);
+		/* Generate primes p and q of equivalent length. */
+		do {
+			bn_gen_prime(prv->p, bits / 2);
+			bn_gen_prime(prv->q, bits / 2);
+		} while (bn_cmp(prv->p, prv->q) == RLC_EQ);
 
-		/* Generate r in Z_n^*. */
-		bn_rand_mod(r, n);
+		/* Compute n = pq. */
+		bn_mul(prv->n, prv->p, prv->q);
+		bn_copy(pub->n, prv->n);
 
-		/* Compute c = (g^m)(r^n) mod n^2. */
-		bn_add_dig(g, n, 1);
-		bn_sqr(s, n);
-		bn_mxp(m, g, m, s);
-		bn_mxp(r, r, n, s);
-		bn_mul(m, m, r);
-		bn_mod(m, m, s);
-		if (2 * size <= *out_len) {
-			*out_len = 2 * size;
-			memset(out, 0, *out_len);
-			bn_write_bin(out, *out_len, m);
-		} else {
+		/* Compute qInv = q^(-1) mod p and pInv = p^(-1) mod q. */
+		bn_gcd_ext(t, prv->qi, prv->dq, prv->q, prv->p);
+		if (bn_cmp_dig(t, 1) != RLC_EQ) {
 			result = RLC_ERR;
 		}
+		if (bn_sign(prv->qi) == RLC_NEG) {
+			bn_add(prv->qi, prv->qi, prv->p);
+		}
+		if (bn_sign(prv->dq) == RLC_NEG) {
+			bn_add(prv->dq, prv->dq, prv->q);
+		}
+
+		/* Since (1 + n)^(p - 1) = 1 + (p - 1)n mod p^2, the function
+		 * L_p(x) = (x - 1)/p maps it to -q mod p, so hp = -qInv mod p.
+		 * Likewise, hq = -pInv mod q. */
+		bn_sub(prv->dp, prv->p, prv->qi);
+		bn_sub(prv->dq, prv->q, prv->dq);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_free(t);
+	}
+
+	return result;
+}
+
+int cp_phpe_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len,
+		phpe_t pub) {
+	bn_t r;
+	int result = RLC_OK;
+
+	if (pub == NULL || in_len <= 0 || in_len > bn_size_bin(pub->n)) {
+		return RLC_ERR;
+	}
+
+	bn_null(r);
+
+	TRY {
+		bn_new(r);
+
+		phpe_rand(r, pub);
+		result = phpe_enc(out, out_len, in, in_len, pub, r);
 	}
 	CATCH_ANY {
 		result = RLC_ERR;
 	}
 	FINALLY {
-		bn_free(g);
-		bn_free(m);
 		bn_free(r);
-		bn_free(s);
 	}
 
 	return result;
 }
 
-int cp_phpe_dec(uint8_t *out, int out_len, uint8_t *in, int in_len, bn_t n,
-	bn_t l) {
-	bn_t c, u, s;
+int cp_phpe_dec(uint8_t *out, int out_len, uint8_t *in, int in_len,
+		phpe_t prv) {
+	bn_t c, m, s, t;
 	int size, result = RLC_OK;
 
-	size = bn_size_bin(n);
+	if (prv == NULL) {
+		return RLC_ERR;
+	}
+
+	size = bn_size_bin(prv->n);
 
 	if (in_len < 0 || in_len != 2 * size) {
 		return RLC_ERR;
 	}
 
 	bn_null(c);
-	bn_null(u);
+	bn_null(m);
 	bn_null(s);
+	bn_null(t);
 
 	TRY {
 		bn_new(c);
-		bn_new(u);
+		bn_new(m);
 		bn_new(s);
+		bn_new(t);
 
-		/* Compute (c^l mod n^2) * u mod n. */
-		bn_sqr(s, n);
 		bn_read_bin(c, in, in_len);
-		bn_mxp(c, c, l, s);
+
+		/* Compute mp = L_p(c^(p - 1) mod p^2) * hp mod p. */
+		bn_sqr(s, prv->p);
+		bn_mod(t, c, s);
+		bn_sub_dig(m, prv->p, 1);
+		bn_mxp(t, t, m, s);
+		bn_sub_dig(t, t, 1);
+		bn_div(t, t, prv->p);
+		bn_mul(t, t, prv->dp);
+		bn_mod(t, t, prv->p);
+
+		/* Compute mq = L_q(c^(q - 1) mod q^2) * hq mod q. */
+		bn_sqr(s, prv->q);
+		bn_mod(c, c, s);
+		bn_sub_dig(m, prv->q, 1);
+		bn_mxp(c, c, m, s);
 		bn_sub_dig(c, c, 1);
-		bn_div(c, c, n);
-		bn_gcd_ext(s, u, NULL, l, n);
-		if (bn_sign(u) == RLC_NEG) {
-			bn_add(u, u, n);
+		bn_div(c, c, prv->q);
+		bn_mul(c, c, prv->dq);
+		bn_mod(c, c, prv->q);
+
+		/* m = mq + q * (qInv * (mp - mq) mod p). */
+		bn_sub(t, t, c);
+		while (bn_sign(t) == RLC_NEG) {
+			bn_add(t, t, prv->p);
 		}
-		bn_mul(c, c, u);
-		bn_mod(c, c, n);
+		bn_mul(t, t, prv->qi);
+		bn_mod(t, t, prv->p);
+		bn_mul(t, t, prv->q);
+		bn_add(c, c, t);
 
 		size = bn_size_bin(c);
 		if (size <= out_len) {
@@ -177,9 +387,312 @@ int cp_phpe_dec(uint8_t *out, int out_len, uint8_t *in, int in_len, bn_t n,
 	}
 	FINALLY {
 		bn_free(c);
+		bn_free(m);
+		bn_free(s);
+		bn_free(t);
+	}
+
+	return result;
+}
+
+int cp_phpe_add_vec(bn_t c, bn_t a[], int len, phpe_t pub) {
+	bn_t r, s, t, u;
+	int i, result = RLC_OK;
+
+	if (pub == NULL || len <= 0) {
+		return RLC_ERR;
+	}
+
+	bn_null(r);
+	bn_null(s);
+	bn_null(t);
+	bn_null(u);
+
+	TRY {
+		bn_new(r);
+		bn_new(s);
+		bn_new(t);
+		bn_new(u);
+
+		/* Multiply all ciphertexts with the same reduction context. */
+		bn_sqr(s, pub->n);
+		bn_mod_pre(u, s);
+		bn_copy(t, a[0]);
+		for (i = 1; i < len; i++) {
+			bn_mul(t, t, a[i]);
+			bn_mod(t, t, s, u);
+		}
+#if BN_MOD == MONTY
+		/* Each reduction divided by R, so multiply by R^len and reduce once
+		 * more to leave Montgomery form without converting each input. */
+		bn_set_dig(r, 1);
+		bn_mod_monty_conv(r, r, s);
+		bn_mxp_dig(r, r, len, s);
+		bn_mul(t, t, r);
+		bn_mod(t, t, s, u);
+#endif
+		bn_mod(c, t, s);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_free(r);
+		bn_free(s);
+		bn_free(t);
+		bn_free(u);
+	}
+
+	return result;
+}
+
+int cp_phpe_scal_vec(bn_t c[], bn_t a[], bn_t k[], int len, phpe_t pub) {
+	bn_t s, t, u, o, r2;
+	int i, result = RLC_OK;
+
+	if (pub == NULL || len < 0) {
+		return RLC_ERR;
+	}
+
+	bn_null(s);
+	bn_null(t);
+	bn_null(u);
+	bn_null(o);
+	bn_null(r2);
+
+	TRY {
+		bn_new(s);
+		bn_new(t);
+		bn_new(u);
+		bn_new(o);
+		bn_new(r2);
+
+		/* Set up the reduction modulo n^2 once for the whole vector. */
+		phpe_ctx(s, u, o, r2, pub);
+		for (i = 0; i < len; i++) {
+			if (bn_sign(k[i]) == RLC_NEG) {
+				bn_mxp(c[i], a[i], k[i], s);
+				continue;
+			}
+			bn_mod(t, a[i], s);
+			bn_mul(t, t, r2);
+			bn_mod(t, t, s, u);
+			phpe_mxp(t, t, k[i], s, u, o);
+#if BN_MOD == MONTY
+			bn_mod_monty_back(c[i], t, s);
+#else
+			bn_copy(c[i], t);
+#endif
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_free(s);
+		bn_free(t);
 		bn_free(u);
+		bn_free(o);
+		bn_free(r2);
+	}
+
+	return result;
+}
+
+int cp_phpe_ip(bn_t c, bn_t a[], bn_t k[], int len, phpe_t pub) {
+	bn_t s;
+	int result = RLC_OK;
+
+	if (pub == NULL || len < 0) {
+		return RLC_ERR;
+	}
+
+	bn_null(s);
+
+	TRY {
+		bn_new(s);
+
+		/* Compute prod a_i^k_i mod n^2 with shared squarings. */
+		bn_sqr(s, pub->n);
+		bn_mxp_sim(c, (const bn_t *)a, (const bn_t *)k, len, s);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
 		bn_free(s);
 	}
 
 	return result;
 }
+
+void cp_phpe_pool_make(phpe_pool_t p, int m) {
+	int i;
+
+	core_lock_init(p->lock);
+	p->size = p->len = p->hits = p->miss = p->bound = 0;
+	if (m < 1) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+
+	p->r = (bn_t *)calloc(m, sizeof(bn_t));
+	if (p->r == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	TRY {
+		for (i = 0; i < m; i++) {
+#if ALLOC != AUTO
+			p->r[i] = (bn_t)calloc(1, sizeof(bn_st));
+			if (p->r[i] == NULL) {
+				THROW(ERR_NO_MEMORY);
+			}
+#endif
+			bn_init(p->r[i], RLC_BN_SIZE);
+		}
+		p->size = m;
+	} CATCH_ANY {
+		/* Unwind the randomizers allocated so far, the others are zeroed. */
+		for (i = 0; i < m; i++) {
+#if ALLOC != AUTO
+			if (p->r[i] != NULL) {
+				bn_clean(p->r[i]);
+				free(p->r[i]);
+			}
+#else
+			bn_clean(p->r[i]);
+#endif
+		}
+		free(p->r);
+		p->r = NULL;
+		THROW(ERR_CAUGHT);
+	}
+}
+
+void cp_phpe_pool_clean(phpe_pool_t p) {
+	if (p->r != NULL) {
+		for (int i = 0; i < p->size; i++) {
+			bn_clean(p->r[i]);
+#if ALLOC != AUTO
+			free(p->r[i]);
+#endif
+		}
+		free(p->r);
+		p->r = NULL;
+	}
+	p->size = p->len = p->hits = p->miss = p->bound = 0;
+	core_lock_clean(p->lock);
+}
+
+int cp_phpe_pre(phpe_pool_t p, phpe_t pub) {
+	bn_t r;
+	uint8_t h[RLC_MD_LEN];
+	volatile int locked = 0;
+	int full, result = RLC_OK;
+
+	if (p == NULL || pub == NULL) {
+		return RLC_ERR;
+	}
+
+	bn_null(r);
+
+	TRY {
+		bn_new(r);
+
+		phpe_print(h, pub);
+		core_lock(p->lock);
+		locked = 1;
+		if (p->bound && memcmp(p->key, h, RLC_MD_LEN) != 0) {
+			/* Do not mix randomizers computed under different keys. */
+			result = RLC_ERR;
+			full = 1;
+		} else {
+			memcpy(p->key, h, RLC_MD_LEN);
+			p->bound = 1;
+			full = (p->len == p->size);
+		}
+		locked = 0;
+		core_unlock(p->lock);
+
+		while (!full) {
+			/* Exponentiate outside the lock so that encryption can proceed. */
+			phpe_rand(r, pub);
+			core_lock(p->lock);
+			locked = 1;
+			if (p->len < p->size) {
+				bn_copy(p->r[p->len], r);
+				p->len++;
+			}
+			full = (p->len == p->size);
+			locked = 0;
+			core_unlock(p->lock);
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		/* Release the pool if a copy failed while holding the lock. */
+		if (locked) {
+			core_unlock(p->lock);
+		}
+		bn_free(r);
+	}
+
+	return result;
+}
+
+int cp_phpe_enc_pre(uint8_t *out, int *out_len, uint8_t *in, int in_len,
+		phpe_t pub, phpe_pool_t p) {
+	bn_t r;
+	uint8_t h[RLC_MD_LEN];
+	volatile int locked = 0;
+	int hit = 0, result = RLC_OK;
+
+	if (pub == NULL || p == NULL || in_len <= 0 ||
+			in_len > bn_size_bin(pub->n)) {
+		return RLC_ERR;
+	}
+
+	bn_null(r);
+
+	TRY {
+		bn_new(r);
+
+		phpe_print(h, pub);
+		core_lock(p->lock);
+		locked = 1;
+		if (p->bound && memcmp(p->key, h, RLC_MD_LEN) != 0) {
+			result = RLC_ERR;
+		} else if (p->len > 0) {
+			p->len--;
+			bn_copy(r, p->r[p->len]);
+			p->hits++;
+			hit = 1;
+		} else {
+			p->miss++;
+		}
+		locked = 0;
+		core_unlock(p->lock);
+
+		if (result == RLC_OK) {
+			if (!hit) {
+				phpe_rand(r, pub);
+			}
+			result = phpe_enc(out, out_len, in, in_len, pub, r);
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		if (locked) {
+			core_unlock(p->lock);
+		}
+		bn_free(r);
+	}
+
+	return result;
+}
@@ -149,6 +149,86 @@ int cp_pss_ver(g1_t a, g1_t b, uint8_t *msg, int len, g2_t g, g2_t x, g2_t y) {
 	return result;
 }
 
+int cp_pss_ver_sim(g1_t a[], g1_t b[], uint8_t *msgs[], int lens[], g2_t g,
+		g2_t x, g2_t y, int n) {
+	g1_t p[3];
+	g2_t q[3];
+	gt_t e;
+	bn_t o, *r = RLC_ALLOCA(bn_t, n), *k = RLC_ALLOCA(bn_t, n);
+	int i, result = 1;
+
+	for (i = 0; i < 3; i++) {
+		g1_null(p[i]);
+		g2_null(q[i]);
+	}
+	gt_null(e);
+	bn_null(o);
+
+	TRY {
+		for (i = 0; i < 3; i++) {
+			g1_new(p[i]);
+			g2_new(q[i]);
+		}
+		gt_new(e);
+		bn_new(o);
+		if (r == NULL || k == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			bn_null(r[i]);
+			bn_new(r[i]);
+			bn_null(k[i]);
+			bn_new(k[i]);
+		}
+
+		/* Check that e(\sum r_ia_i, x)e(\sum r_im_ia_i, y) = e(\sum r_ib_i, g)
+		 * for random 128-bit r_i. */
+		g1_get_ord(o);
+		for (i = 0; i < n; i++) {
+			if (g1_is_infty(a[i])) {
+				result = 0;
+			}
+			bn_rand(r[i], RLC_POS, 128);
+			bn_read_bin(k[i], msgs[i], lens[i]);
+			bn_mul(k[i], k[i], r[i]);
+			bn_mod(k[i], k[i], o);
+		}
+
+		if (result) {
+			g1_mul_sim_lot(p[0], (const g1_t *)a, (const bn_t *)r, n);
+			g1_mul_sim_lot(p[1], (const g1_t *)a, (const bn_t *)k, n);
+			g1_mul_sim_lot(p[2], (const g1_t *)b, (const bn_t *)r, n);
+			g2_copy(q[0], x);
+			g2_copy(q[1], y);
+			g2_neg(q[2], g);
+			pc_map_sim(e, p, q, 3);
+			if (!gt_is_unity(e)) {
+				result = 0;
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (i = 0; i < 3; i++) {
+			g1_free(p[i]);
+			g2_free(q[i]);
+		}
+		gt_free(e);
+		bn_free(o);
+		if (r != NULL && k != NULL) {
+			for (i = 0; i < n; i++) {
+				bn_free(r[i]);
+				bn_free(k[i]);
+			}
+		}
+		RLC_FREE(r);
+		RLC_FREE(k);
+	}
+	return result;
+}
+
 int cp_psb_gen(bn_t r, bn_t s[], g2_t g, g2_t x, g2_t y[], int l) {
 	bn_t n;
 	int i, result = RLC_OK;
@@ -221,7 +301,7 @@ int cp_psb_ver(g1_t a, g1_t b, uint8_t *msgs[], int lens[], g2_t g, g2_t x,
 	g1_t p[2];
 	g2_t q[2];
 	gt_t e;
-	bn_t m, n;
+	bn_t n, *m = RLC_ALLOCA(bn_t, l);
 	int i, result = 1;
 
 	g1_null(p[0]);
@@ -229,7 +309,6 @@ int cp_psb_ver(g1_t a, g1_t b, uint8_t *msgs[], int lens[], g2_t g, g2_t x,
 	g2_null(q[0]);
 	g2_null(q[1]);
 	gt_null(e);
-	bn_null(m);
 	bn_null(n);
 
 	TRY {
@@ -238,8 +317,14 @@ int cp_psb_ver(g1_t a, g1_t b, uint8_t *msgs[], int lens[], g2_t g, g2_t x,
 		g2_new(q[0]);
 		g2_new(q[1]);
 		gt_new(e);
-		bn_new(m);
 		bn_new(n);
+		if (m == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < l; i++) {
+			bn_null(m[i]);
+			bn_new(m[i]);
+		}
 
 		if (g1_is_infty(a)) {
 			result = 0;
@@ -248,14 +333,13 @@ int cp_psb_ver(g1_t a, g1_t b, uint8_t *msgs[], int lens[], g2_t g, g2_t x,
 		/* Check that e(a, x \prod y_i^m_i) = e(b, g). */
 		g1_copy(p[0], a);
 		g1_copy(p[1], b);
-		g2_copy(q[0], x);
 		g1_get_ord(n);
 		for (i = 0; i < l; i++) {
-			bn_read_bin(m, msgs[i], lens[i]);
-			bn_mod(m, m, n);
-			g2_mul(q[1], y[i], m);
-			g2_add(q[0], q[0], q[1]);
+			bn_read_bin(m[i], msgs[i], lens[i]);
+			bn_mod(m[i], m[i], n);
 		}
+		g2_mul_sim_lot(q[0], y, (const bn_t *)m, l);
+		g2_add(q[0], q[0], x);
 		g2_norm(q[0], q[0]);
 		g2_copy(q[1], g);
 		g2_neg(q[1], q[1]);
@@ -273,8 +357,99 @@ int cp_psb_ver(g1_t a, g1_t b, uint8_t *msgs[], int lens[], g2_t g, g2_t x,
 		g2_free(q[0]);
 		g2_free(q[1]);
 		gt_free(e);
-		bn_free(m);
 		bn_free(n);
+		if (m != NULL) {
+			for (i = 0; i < l; i++) {
+				bn_free(m[i]);
+			}
+		}
+		RLC_FREE(m);
+	}
+	return result;
+}
+
+int cp_psb_ver_sim(g1_t a[], g1_t b[], uint8_t **msgs[], int *lens[], g2_t g,
+		g2_t x, g2_t y[], int l, int n) {
+	g1_t *p = RLC_ALLOCA(g1_t, l + 2);
+	g2_t *q = RLC_ALLOCA(g2_t, l + 2);
+	gt_t e;
+	bn_t o, *r = RLC_ALLOCA(bn_t, n), *k = RLC_ALLOCA(bn_t, n);
+	int i, j, result = 1;
+
+	gt_null(e);
+	bn_null(o);
+
+	TRY {
+		gt_new(e);
+		bn_new(o);
+		if (p == NULL || q == NULL || r == NULL || k == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < l + 2; i++) {
+			g1_null(p[i]);
+			g1_new(p[i]);
+			g2_null(q[i]);
+			g2_new(q[i]);
+		}
+		for (j = 0; j < n; j++) {
+			bn_null(r[j]);
+			bn_new(r[j]);
+			bn_null(k[j]);
+			bn_new(k[j]);
+		}
+
+		/* Check that e(\sum_j r_ja_j, x)\prod_i e(\sum_j r_jm_jia_j, y_i) =
+		 * e(\sum_j r_jb_j, g) for random 128-bit r_j, with l + 2 pairings. */
+		g1_get_ord(o);
+		for (j = 0; j < n; j++) {
+			if (g1_is_infty(a[j])) {
+				result = 0;
+			}
+			bn_rand(r[j], RLC_POS, 128);
+		}
+
+		if (result) {
+			g1_mul_sim_lot(p[0], (const g1_t *)a, (const bn_t *)r, n);
+			g2_copy(q[0], x);
+			for (i = 0; i < l; i++) {
+				for (j = 0; j < n; j++) {
+					bn_read_bin(k[j], msgs[j][i], lens[j][i]);
+					bn_mul(k[j], k[j], r[j]);
+					bn_mod(k[j], k[j], o);
+				}
+				g1_mul_sim_lot(p[i + 1], (const g1_t *)a, (const bn_t *)k, n);
+				g2_copy(q[i + 1], y[i]);
+			}
+			g1_mul_sim_lot(p[l + 1], (const g1_t *)b, (const bn_t *)r, n);
+			g2_neg(q[l + 1], g);
+			pc_map_sim(e, p, q, l + 2);
+			if (!gt_is_unity(e)) {
+				result = 0;
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		gt_free(e);
+		bn_free(o);
+		if (p != NULL && q != NULL) {
+			for (i = 0; i < l + 2; i++) {
+				g1_free(p[i]);
+				g2_free(q[i]);
+			}
+		}
+		if (r != NULL && k != NULL) {
+			for (j = 0; j < n; j++) {
+				bn_free(r[j]);
+				bn_free(k[j]);
+			}
+		}
+		RLC_FREE(p);
+		RLC_FREE(q);
+		RLC_FREE(r);
+		RLC_FREE(k);
 	}
 	return result;
 }
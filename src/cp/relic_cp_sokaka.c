@@ -41,47 +41,27 @@
 #include "relic_bench.h"
 
 /*============================================================================*/
-/* Public definitions                                                         */
+/* Private definitions                                                        */
 /*============================================================================*/
 
-int cp_sokaka_gen(bn_t master) {
-	bn_t n;
-	int result = RLC_OK;
-
-	bn_null(n);
-
-	TRY {
-		bn_new(n);
-
-		g1_get_ord(n);
-		bn_rand_mod(master, n);
-	}
-	CATCH_ANY {
-		result = RLC_ERR;
-	}
-	FINALLY {
-		bn_free(n);
-	}
-	return result;
-}
-
-int cp_sokaka_gen_prv(sokaka_t k, char *id, int len, bn_t master) {
-	if (pc_map_is_type1()) {
-		g1_map(k->s1, (uint8_t *)id, len);
-		g1_mul(k->s1, k->s1, master);
-	} else {
-		g1_map(k->s1, (uint8_t *)id, len);
-		g1_mul(k->s1, k->s1, master);
-		g2_map(k->s2, (uint8_t *)id, len);
-		g2_mul(k->s2, k->s2, master);
-	}
-	return RLC_OK;
-}
-
-int cp_sokaka_key(uint8_t *key, unsigned int key_len, char *id1,
-		int len1, sokaka_t k, char *id2, int len2) {
-	int size, first = 0, result = RLC_OK;
-	uint8_t *buf;
+/**
+ * Computes a shared key between two entities, taking the pairing with the
+ * second identity from a cache if one is given.
+ *
+ * @param[out] key			- the shared key.
+ * @param[int] key_len		- the intended shared key length in bytes.
+ * @param[in] id1			- the first identity.
+ * @param[in] len1			- the length of the first identity in bytes.
+ * @param[in] k				- the private key of the first identity.
+ * @param[in] id2			- the second identity.
+ * @param[in] len2			- the length of the second identity in bytes.
+ * @param[in,out] c			- the cache of pairings, or NULL.
+ * @return RLC_OK if no errors occurred, RLC_ERR otherwise.
+ */
+static int sokaka_key(uint8_t *key, unsigned int key_len, char *id1,
+		int len1, sokaka_t k, char *id2, int len2, idc_t c) {
+	int size, l1, l2, first = 0, result = RLC_OK;
+	uint8_t *buf, *bin = NULL;
 	g1_t p;
 	g2_t q;
 	gt_t e;
@@ -121,16 +101,41 @@ int cp_sokaka_key(uint8_t *key, unsigned int key_len, char *id1,
 			}
 		}
 
-		if (pc_map_is_type1()) {
-			g2_map(q, (uint8_t *)id2, len2);
-			pc_map(e, k->s1, q);
-		} else {
-			if (first == 1) {
+		if (c != NULL) {
+			/* Pairings cached for another identity or private key depend on
+			 * them, so they must not be used. */
+			l1 = g1_size_bin(k->s1, 0);
+			/* Type-1 private keys only have the G1 component. */
+			l2 = (pc_map_is_type1() ? 0 : g2_size_bin(k->s2, 0));
+			bin = RLC_ALLOCA(uint8_t, len1 + l1 + l2);
+			if (bin == NULL) {
+				THROW(ERR_NO_MEMORY);
+			}
+			memcpy(bin, id1, len1);
+			g1_write_bin(bin + len1, l1, k->s1, 0);
+			if (l2 > 0) {
+				g2_write_bin(bin + len1 + l1, l2, k->s2, 0);
+			}
+			if (cp_idc_bind(c, bin, len1 + l1 + l2) != RLC_OK) {
+				THROW(ERR_NO_VALID);
+			}
+		}
+
+		if (c == NULL || !cp_idc_get(e, c, (uint8_t *)id2, len2)) {
+			if (pc_map_is_type1()) {
 				g2_map(q, (uint8_t *)id2, len2);
 				pc_map(e, k->s1, q);
 			} else {
-				g1_map(p, (uint8_t *)id2, len2);
-				pc_map(e, p, k->s2);
+				if (first == 1) {
+					g2_map(q, (uint8_t *)id2, len2);
+					pc_map(e, k->s1, q);
+				} else {
+					g1_map(p, (uint8_t *)id2, len2);
+					pc_map(e, p, k->s2);
+				}
+			}
+			if (c != NULL) {
+				cp_idc_put(c, (uint8_t *)id2, len2, e);
 			}
 		}
 
@@ -146,6 +151,58 @@ int cp_sokaka_key(uint8_t *key, unsigned int key_len, char *id1,
 		g2_free(q);
 		gt_free(e);
 		RLC_FREE(buf);
+		RLC_FREE(bin);
 	}
 	return result;
 }
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+int cp_sokaka_gen(bn_t master) {
+	bn_t n;
+	int result = RLC_OK;
+
+	bn_null(n);
+
+	TRY {
+		bn_new(n);
+
+		g1_get_ord(n);
+		bn_rand_mod(master, n);
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		bn_free(n);
+	}
+	return result;
+}
+
+int cp_sokaka_gen_prv(sokaka_t k, char *id, int len, bn_t master) {
+	if (pc_map_is_type1()) {
+		g1_map(k->s1, (uint8_t *)id, len);
+		g1_mul(k->s1, k->s1, master);
+	} else {
+		g1_map(k->s1, (uint8_t *)id, len);
+		g1_mul(k->s1, k->s1, master);
+		g2_map(k->s2, (uint8_t *)id, len);
+		g2_mul(k->s2, k->s2, master);
+	}
+	return RLC_OK;
+}
+
+int cp_sokaka_key(uint8_t *key, unsigned int key_len, char *id1,
+		int len1, sokaka_t k, char *id2, int len2) {
+	return sokaka_key(key, key_len, id1, len1, k, id2, len2, NULL);
+}
+
+int cp_sokaka_key_pre(uint8_t *key, unsigned int key_len, char *id1,
+		int len1, sokaka_t k, char *id2, int len2, idc_t c) {
+	if (c == NULL) {
+		return RLC_ERR;
+	}
+	return sokaka_key(key, key_len, id1, len1, k, id2, len2, c);
+}
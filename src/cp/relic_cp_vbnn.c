@@ -36,6 +36,123 @@
 #include "relic_test.h"
 #include "relic_bench.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Verifies a vBNN-IBS signature, multiplying the master public key with a
+ * precomputed table if one is given.
+ *
+ * @param[in] r				- the R value of the signature.
+ * @param[in] z 			- the z value of the signature.
+ * @param[in] h 			- the h value of the signature.
+ * @param[in] id 			- the identity buffer.
+ * @param[in] id_len 		- the size of identity buffer.
+ * @param[in] msg 			- the signed message buffer.
+ * @param[in] msg_len 		- the size of message buffer.
+ * @param[in] mpk			- the master public key of the generation center.
+ * @param[in] pre			- the table for the master public key, or NULL.
+ * @return a boolean value indicating if the signature is valid.
+ */
+static int vbnn_ver(ec_t r, bn_t z, bn_t h, uint8_t *id, int id_len,
+		uint8_t *msg, int msg_len, ec_t mpk, const ec_t *pre) {
+	int len, result = 0;
+	uint8_t *buf = NULL, *buf_i, hash[RLC_MD_LEN];
+	bn_t n, c, _h;
+	ec_t Z;
+	ec_t t;
+
+	/* zero variables */
+	bn_null(n);
+	bn_null(c);
+	bn_null(_h);
+	ec_null(Z);
+	ec_null(t);
+
+	TRY {
+		bn_new(n);
+		bn_new(c);
+		bn_new(_h);
+		ec_new(Z);
+		ec_new(t);
+
+		/* calculate c */
+		len = id_len + msg_len + 2 * ec_size_bin(r, 1);
+		buf = RLC_ALLOCA(uint8_t, len);
+		if (buf == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		
+		/* get order of ECC group */
+		ec_curve_get_ord(n);
+
+		buf_i = buf;
+		memcpy(buf_i, id, id_len);
+		buf_i += id_len;
+		ec_write_bin(buf_i, ec_size_bin(r, 1), r, 1);
+
+		len = id_len + ec_size_bin(r, 1);
+		md_map(hash, buf, len);
+		bn_read_bin(c, hash, RLC_MD_LEN);
+		bn_mod(c, c, n);
+
+		/* calculate Z */
+		if (pre == NULL) {
+			ec_mul_gen(Z, z);
+			ec_mul(t, mpk, c);
+			ec_add(t, t, r);
+			ec_norm(t, t);
+			ec_mul(t, t, h);
+		} else {
+			/* Z = zG - hR - (hc)mpk, with the last term from the table. */
+			bn_mod(_h, h, n);
+			bn_sub(_h, n, _h);
+			ec_mul_sim_gen(Z, z, r, _h);
+			bn_mul(c, c, h);
+			bn_mod(c, c, n);
+			ec_mul_fix(t, pre, c);
+		}
+		ec_sub(Z, Z, t);
+		ec_norm(Z, Z);
+
+		/* calculate h_verify */
+		buf_i = buf;
+		memcpy(buf_i, id, id_len);
+		buf_i += id_len;
+		memcpy(buf_i, msg, msg_len);
+		buf_i += msg_len;
+		ec_write_bin(buf_i, ec_size_bin(r, 1), r, 1);
+		buf_i += ec_size_bin(r, 1);
+		ec_write_bin(buf_i, ec_size_bin(Z, 1), Z, 1);
+
+		len = id_len + msg_len + ec_size_bin(r, 1) + ec_size_bin(Z, 1);
+		md_map(hash, buf, len);
+		bn_read_bin(_h, hash, RLC_MD_LEN);
+		bn_mod(_h, _h, n);
+		RLC_FREE(buf);
+
+		if (bn_cmp(h, _h) == RLC_EQ) {
+			result = 1;
+		} else {
+			result = 0;
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		/* free variables */
+		bn_free(n);
+		bn_free(c);
+		bn_free(_h);
+		ec_free(Z);
+		ec_free(t);
+		RLC_FREE(buf);
+	}
+	return result;
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -190,88 +307,10 @@ int cp_vbnn_sig(ec_t r, bn_t z, bn_t h, uint8_t *id, int id_len,
 
 int cp_vbnn_ver(ec_t r, bn_t z, bn_t h, uint8_t *id, int id_len,
 		uint8_t *msg, int msg_len, ec_t mpk) {
-	int len, result = 0;
-	uint8_t *buf = NULL, *buf_i, hash[RLC_MD_LEN];
-	bn_t n, c, _h;
-	ec_t Z;
-	ec_t t;
-
-	/* zero variables */
-	bn_null(n);
-	bn_null(c);
-	bn_null(_h);
-	ec_null(Z);
-	ec_null(t);
-
-	TRY {
-		bn_new(n);
-		bn_new(c);
-		bn_new(_h);
-		ec_new(Z);
-		ec_new(t);
-
-		/* calculate c */
-		len = id_len + msg_len + 2 * ec_size_bin(r, 1);
-		buf = RLC_ALLOCA(uint8_t, len);
-		if (buf == NULL) {
-			THROW(ERR_NO_MEMORY);
-		}
-		
-		/* get order of ECC group */
-		ec_curve_get_ord(n);
-
-		buf_i = buf;
-		memcpy(buf_i, id, id_len);
-		buf_i += id_len;
-		ec_write_bin(buf_i, ec_size_bin(r, 1), r, 1);
-
-		len = id_len + ec_size_bin(r, 1);
-		md_map(hash, buf, len);
-		bn_read_bin(c, hash, RLC_MD_LEN);
-		bn_mod(c, c, n);
-
-		/* calculate Z */
-		ec_mul_gen(Z, z);
-		ec_mul(t, mpk, c);
-		ec_add(t, t, r);
-		ec_norm(t, t);
-		ec_mul(t, t, h);
-		ec_sub(Z, Z, t);
-		ec_norm(Z, Z);
-
-		/* calculate h_verify */
-		buf_i = buf;
-		memcpy(buf_i, id, id_len);
-		buf_i += id_len;
-		memcpy(buf_i, msg, msg_len);
-		buf_i += msg_len;
-		ec_write_bin(buf_i, ec_size_bin(r, 1), r, 1);
-		buf_i += ec_size_bin(r, 1);
-		ec_write_bin(buf_i, ec_size_bin(Z, 1), Z, 1);
-
-		len = id_len + msg_len + ec_size_bin(r, 1) + ec_size_bin(Z, 1);
-		md_map(hash, buf, len);
-		bn_read_bin(_h, hash, RLC_MD_LEN);
-		bn_mod(_h, _h, n);
-		RLC_FREE(buf);
+	return vbnn_ver(r, z, h, id, id_len, msg, msg_len, mpk, NULL);
+}
 
-		if (bn_cmp(h, _h) == RLC_EQ) {
-			result = 1;
-		} else {
-			result = 0;
-		}
-	}
-	CATCH_ANY {
-		THROW(ERR_CAUGHT);
-	}
-	FINALLY {
-		/* free variables */
-		bn_free(n);
-		bn_free(c);
-		bn_free(_h);
-		ec_free(Z);
-		ec_free(t);
-		RLC_FREE(buf);
-	}
-	return result;
+int cp_vbnn_ver_pre(ec_t r, bn_t z, bn_t h, uint8_t *id, int id_len,
+		uint8_t *msg, int msg_len, const ec_t *t) {
+	return vbnn_ver(r, z, h, id, id_len, msg, msg_len, NULL, t);
 }
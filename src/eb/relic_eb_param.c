@@ -263,6 +263,8 @@ void eb_param_set(int param) {
 	bn_null(r);
 	bn_null(h);
 
+	core_init_mod(RLC_CORE_EB);
+
 	TRY {
 		fb_new(a);
 		fb_new(b);
@@ -403,3 +403,65 @@ void ed_mul_sim_gen(ed_t r, const bn_t k, const ed_t q, const bn_t m) {
 		ed_free(g);
 	}
 }
+
+void ed_mul_sim_lot(ed_t r, const ed_t *p, const bn_t *k, int n) {
+	const int s = 1 << (ED_WIDTH - 2), m = RLC_FP_BITS + 1;
+	int i, j, l, *_l = RLC_ALLOCA(int, n);
+	int8_t *naf = RLC_ALLOCA(int8_t, n * m), *_k;
+	ed_t *t = RLC_ALLOCA(ed_t, n * s);
+
+	TRY {
+		if (_l == NULL || naf == NULL || t == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n * s; i++) {
+			ed_null(t[i]);
+			ed_new(t[i]);
+		}
+
+		l = 0;
+		for (i = 0; i < n; i++) {
+			_k = naf + i * m;
+			_l[i] = m;
+			bn_rec_naf(_k, &_l[i], k[i], ED_WIDTH);
+			if (bn_sign(k[i]) == RLC_NEG) {
+				for (j = 0; j < _l[i]; j++) {
+					_k[j] = -_k[j];
+				}
+			}
+			l = RLC_MAX(l, _l[i]);
+			ed_tab(t + i * s, p[i], ED_WIDTH);
+		}
+
+		ed_set_infty(r);
+		for (i = l - 1; i >= 0; i--) {
+			ed_dbl(r, r);
+			for (j = 0; j < n; j++) {
+				if (i < _l[j]) {
+					_k = naf + j * m;
+					if (_k[i] > 0) {
+						ed_add(r, r, t[j * s + _k[i] / 2]);
+					}
+					if (_k[i] < 0) {
+						ed_sub(r, r, t[j * s - _k[i] / 2]);
+					}
+				}
+			}
+		}
+		/* Convert r to affine coordinates. */
+		ed_norm(r, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		if (t != NULL) {
+			for (i = 0; i < n * s; i++) {
+				ed_free(t[i]);
+			}
+		}
+		RLC_FREE(t);
+		RLC_FREE(naf);
+		RLC_FREE(_l);
+	}
+}
@@ -80,6 +80,8 @@ void ed_param_set(int param) {
 	bn_null(r);
 	bn_null(h);
 
+	core_init_mod(RLC_CORE_ED);
+
 	TRY {
 		ed_new(g);
 		bn_new(r);
@@ -42,11 +42,6 @@
 /*============================================================================*/
 
 int ed_is_infty(const ed_t p) {
-	fp_t t;
-	int r = 0;
-
-	fp_null(t);
-
 	if (p->norm) {
 		return (fp_is_zero(p->x) && (fp_cmp_dig(p->y, 1) == RLC_EQ));
 	}
@@ -55,20 +50,8 @@ int ed_is_infty(const ed_t p) {
 		THROW(ERR_NO_VALID);
 	}
 
-	TRY {
-		fp_new(t);
-		fp_inv(t, p->z);
-		fp_mul(t, p->y, t);
-		if (fp_is_zero(p->x) && (fp_cmp_dig(t, 1) == RLC_EQ)) {
-			r = 1;
-		}
-	} CATCH_ANY {
-		THROW(ERR_CAUGHT);
-	} FINALLY {
-		fp_free(t);
-	}
-
-	return r;
+	/* Compare x/z = 0 and y/z = 1 without inverting z. */
+	return (fp_is_zero(p->x) && (fp_cmp(p->y, p->z) == RLC_EQ));
 }
 
 void ed_set_infty(ed_t p) {
@@ -470,3 +470,92 @@ void ep_sub_projc(ep_t r, const ep_t p, const ep_t q) {
 }
 
 #endif
+
+void ep_add_sim(ep_t *r, const ep_t *p, const ep_t *q, int n) {
+	int i;
+	fp_t t0, t1, t2, *d;
+
+	if (n <= 0) {
+		return;
+	}
+
+	d = RLC_ALLOCA(fp_t, n);
+	fp_null(t0);
+	fp_null(t1);
+	fp_null(t2);
+
+	TRY {
+		if (d == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			fp_null(d[i]);
+		}
+		fp_new(t0);
+		fp_new(t1);
+		fp_new(t2);
+		for (i = 0; i < n; i++) {
+			fp_new(d[i]);
+			/* d_i = x2 - x1, or 1 if the pair needs special handling. */
+			if (ep_is_infty(p[i]) || ep_is_infty(q[i])) {
+				fp_set_dig(d[i], 1);
+			} else {
+				fp_sub(d[i], q[i]->x, p[i]->x);
+				if (fp_is_zero(d[i])) {
+					fp_set_dig(d[i], 1);
+				}
+			}
+		}
+
+		/* Montgomery's trick: a single inversion for the whole batch. */
+		fp_inv_sim(d, (const fp_t *)d, n);
+
+		for (i = 0; i < n; i++) {
+			if (ep_is_infty(p[i])) {
+				ep_copy(r[i], q[i]);
+				continue;
+			}
+			if (ep_is_infty(q[i])) {
+				ep_copy(r[i], p[i]);
+				continue;
+			}
+			if (fp_cmp(p[i]->x, q[i]->x) == RLC_EQ) {
+				if (fp_cmp(p[i]->y, q[i]->y) == RLC_EQ) {
+					ep_dbl(r[i], p[i]);
+					ep_norm(r[i], r[i]);
+				} else {
+					ep_set_infty(r[i]);
+				}
+				continue;
+			}
+			/* t2 = lambda = (y2 - y1)/(x2 - x1). */
+			fp_sub(t1, q[i]->y, p[i]->y);
+			fp_mul(t2, t1, d[i]);
+			/* x3 = lambda^2 - x2 - x1. */
+			fp_sqr(t1, t2);
+			fp_sub(t0, t1, p[i]->x);
+			fp_sub(t0, t0, q[i]->x);
+			/* y3 = lambda * (x1 - x3) - y1. */
+			fp_sub(t1, p[i]->x, t0);
+			fp_mul(t1, t2, t1);
+			fp_sub(r[i]->y, t1, p[i]->y);
+			fp_copy(r[i]->x, t0);
+			fp_set_dig(r[i]->z, 1);
+			r[i]->norm = 1;
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(t0);
+		fp_free(t1);
+		fp_free(t2);
+		if (d != NULL) {
+			for (i = 0; i < n; i++) {
+				fp_free(d[i]);
+			}
+		}
+		RLC_FREE(d);
+	}
+}
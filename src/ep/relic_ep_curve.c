@@ -30,6 +30,7 @@
  */
 
 #include "relic_core.h"
+#include "relic_md.h"
 
 /*============================================================================*/
 /* Private definitions                                                        */
@@ -82,6 +83,70 @@ static void detect_opt(int *opt, fp_t a) {
 	}
 }
 
+#if defined(EP_PRECO) && ALLOC == AUTO
+
+/**
+ * Fills the header of a persisted precomputation table.
+ *
+ * @param[out] hdr		- the header.
+ * @param[in] bin		- the serialized generator and table.
+ * @param[in] len		- the number of bytes in the serialization.
+ */
+static void ep_curve_pre_hdr(uint8_t *hdr, const uint8_t *bin, int len) {
+	uint32_t f[] = { RLC_EP_PRE_VER, FP_PRIME, RLC_DIG, EP_FIX, EP_DEPTH,
+			RLC_EP_TABLE, sizeof(ep_st) };
+	uint8_t h[RLC_MD_LEN];
+
+	memset(hdr, 0, RLC_EP_PRE_HDR);
+	memcpy(hdr, "REP1", 4);
+	memcpy(hdr + 4, f, sizeof(f));
+	md_map(h, bin, len);
+	memcpy(hdr + RLC_EP_PRE_HDR / 2, h, RLC_MIN(RLC_MD_LEN, RLC_EP_PRE_HDR / 2));
+}
+
+/**
+ * Points the generator table to the persisted one, if it was built for the
+ * current generator.
+ *
+ * @return 1 if the persisted table is used, 0 otherwise.
+ */
+static int ep_curve_use_map(void) {
+	ctx_t *ctx = core_get();
+	ep_st *m = (ep_st *)ctx->ep_map;
+
+	if (m == NULL || ep_cmp(&(ctx->ep_g), m) != RLC_EQ) {
+		return 0;
+	}
+	for (int i = 0; i < RLC_EP_TABLE; i++) {
+		ctx->ep_ptr[i] = &m[i + 1];
+	}
+	return 1;
+}
+
+#endif
+
+#if defined(EP_PRECO)
+
+/**
+ * Builds the precomputation table for the generator, or reuses the persisted
+ * one if it matches.
+ */
+static void ep_curve_set_tab(void) {
+	ctx_t *ctx = core_get();
+
+	for (int i = 0; i < RLC_EP_TABLE; i++) {
+		ctx->ep_ptr[i] = &(ctx->ep_pre[i]);
+	}
+#if ALLOC == AUTO
+	if (ep_curve_use_map()) {
+		return;
+	}
+#endif
+	ep_mul_pre((ep_t *)ep_curve_get_tab(), &(ctx->ep_g));
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -106,6 +171,9 @@ void ep_curve_init(void) {
 
 void ep_curve_clean(void) {
 	ctx_t *ctx = core_get();
+#ifdef EP_PRECO
+	ctx->ep_map = NULL;
+#endif
 	bn_clean(&ctx->ep_r);
 	bn_clean(&ctx->ep_h);
 #if defined(EP_ENDOM) && (EP_MUL == LWNAF || EP_FIX == LWNAF || !defined(STRIP))
@@ -194,6 +262,72 @@ const ep_t *ep_curve_get_tab(void) {
 #endif
 }
 
+int ep_curve_size_pre(void) {
+#if defined(EP_PRECO) && ALLOC == AUTO
+	return RLC_EP_PRE_HDR + (RLC_EP_TABLE + 1) * sizeof(ep_st);
+#else
+	return 0;
+#endif
+}
+
+void ep_curve_write_pre(uint8_t *bin, int len) {
+#if defined(EP_PRECO) && ALLOC == AUTO
+	ctx_t *ctx = core_get();
+	uint8_t *b = bin + RLC_EP_PRE_HDR;
+
+	if (len != ep_curve_size_pre()) {
+		THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	memcpy(b, &(ctx->ep_g), sizeof(ep_st));
+	memcpy(b + sizeof(ep_st), ep_curve_get_tab(), RLC_EP_TABLE * sizeof(ep_st));
+	ep_curve_pre_hdr(bin, b, len - RLC_EP_PRE_HDR);
+#else
+	(void)bin;
+	(void)len;
+	THROW(ERR_NO_CONFIG);
+#endif
+}
+
+int ep_curve_map_pre(const uint8_t *bin, int len) {
+#if defined(EP_PRECO) && ALLOC == AUTO
+	ctx_t *ctx = core_get();
+	uint8_t hdr[RLC_EP_PRE_HDR];
+	/* Before the module is set up, the table is only recorded. */
+	int used = (ctx->mods & RLC_CORE_EP) &&
+			(ctx->ep_ptr[0] != &(ctx->ep_pre[0]));
+
+	if (bin == NULL) {
+		ctx->ep_map = NULL;
+		if (used) {
+			ep_curve_set_tab();
+		}
+		return RLC_OK;
+	}
+
+	/* The points are used in place, so they must be suitably aligned. */
+	if (len != ep_curve_size_pre() ||
+			((uintptr_t)bin % RLC_MAX(ALIGN, sizeof(dig_t))) != 0) {
+		return RLC_ERR;
+	}
+	ep_curve_pre_hdr(hdr, bin + RLC_EP_PRE_HDR, len - RLC_EP_PRE_HDR);
+	if (memcmp(hdr, bin, RLC_EP_PRE_HDR) != 0) {
+		return RLC_ERR;
+	}
+
+	ctx->ep_map = bin + RLC_EP_PRE_HDR;
+	if (!ep_curve_use_map() && used) {
+		ep_curve_set_tab();
+	}
+	return RLC_OK;
+#else
+	(void)bin;
+	(void)len;
+	return RLC_ERR;
+#endif
+}
+
 #if defined(EP_PLAIN)
 
 void ep_curve_set_plain(const fp_t a, const fp_t b, const ep_t g, const bn_t r,
@@ -213,7 +347,7 @@ void ep_curve_set_plain(const fp_t a, const fp_t b, const ep_t g, const bn_t r,
 	bn_copy(&(ctx->ep_h), h);
 
 #if defined(EP_PRECO)
-	ep_mul_pre((ep_t *)ep_curve_get_tab(), &(ctx->ep_g));
+	ep_curve_set_tab();
 #endif
 }
 
@@ -238,7 +372,7 @@ void ep_curve_set_super(const fp_t a, const fp_t b, const ep_t g, const bn_t r,
 	bn_copy(&(ctx->ep_h), h);
 
 #if defined(EP_PRECO)
-	ep_mul_pre((ep_t *)ep_curve_get_tab(), &(ctx->ep_g));
+	ep_curve_set_tab();
 #endif
 }
 
@@ -299,7 +433,7 @@ void ep_curve_set_endom(const fp_t a, const fp_t b, const ep_t g, const bn_t r,
 	bn_copy(&(ctx->ep_h), h);
 
 #if defined(EP_PRECO)
-	ep_mul_pre((ep_t *)ep_curve_get_tab(), &(ctx->ep_g));
+	ep_curve_set_tab();
 #endif
 }
 
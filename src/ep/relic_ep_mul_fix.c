@@ -85,8 +85,6 @@ static void ep_mul_fix_plain(ep_t r, const ep_t *t, const bn_t k) {
 
 #endif /* EP_FIX == LWNAF */
 
-#if EP_FIX == COMBS || !defined(STRIP)
-
 #if defined(EP_ENDOM)
 
 /**
@@ -96,8 +94,9 @@ static void ep_mul_fix_plain(ep_t r, const ep_t *t, const bn_t k) {
  * @param[out] r 				- the result.
  * @param[in] t					- the precomputed table.
  * @param[in] k					- the integer.
+ * @param[in] d					- the depth of the comb.
  */
-static void ep_mul_combs_endom(ep_t r, const ep_t *t, const bn_t k) {
+static void ep_mul_combs_endom(ep_t r, const ep_t *t, const bn_t k, int d) {
 	int i, j, l, w0, w1, n0, n1, p0, p1, s0, s1;
 	bn_t n, k0, k1, v1[3], v2[3];
 	ep_t u;
@@ -128,8 +127,7 @@ static void ep_mul_combs_endom(ep_t r, const ep_t *t, const bn_t k) {
 		ep_curve_get_v1(v1);
 		ep_curve_get_v2(v2);
 		l = bn_bits(n);
-		l = ((l % (2 * EP_DEPTH)) ==
-				0 ? (l / (2 * EP_DEPTH)) : (l / (2 * EP_DEPTH)) + 1);
+		l = ((l % (2 * d)) == 0 ? (l / (2 * d)) : (l / (2 * d)) + 1);
 
 		bn_rec_glv(k0, k1, k, n, (const bn_t *)v1, (const bn_t *)v2);
 		s0 = bn_sign(k0);
@@ -140,7 +138,7 @@ static void ep_mul_combs_endom(ep_t r, const ep_t *t, const bn_t k) {
 		n0 = bn_bits(k0);
 		n1 = bn_bits(k1);
 
-		p0 = (EP_DEPTH) * l - 1;
+		p0 = d * l - 1;
 
 		ep_set_infty(r);
 
@@ -150,7 +148,7 @@ static void ep_mul_combs_endom(ep_t r, const ep_t *t, const bn_t k) {
 			w0 = 0;
 			w1 = 0;
 			p1 = p0--;
-			for (j = EP_DEPTH - 1; j >= 0; j--, p1 -= l) {
+			for (j = d - 1; j >= 0; j--, p1 -= l) {
 				w0 = w0 << 1;
 				w1 = w1 << 1;
 				if (p1 < n0 && bn_get_bit(k0, p1)) {
@@ -211,8 +209,9 @@ static void ep_mul_combs_endom(ep_t r, const ep_t *t, const bn_t k) {
  * @param[out] r 				- the result.
  * @param[in] t					- the precomputed table.
  * @param[in] k					- the integer.
+ * @param[in] d					- the depth of the comb.
  */
-static void ep_mul_combs_plain(ep_t r, const ep_t *t, const bn_t k) {
+static void ep_mul_combs_plain(ep_t r, const ep_t *t, const bn_t k, int d) {
 	int i, j, l, w, n0, p0, p1;
 	bn_t n;
 
@@ -227,14 +226,14 @@ static void ep_mul_combs_plain(ep_t r, const ep_t *t, const bn_t k) {
 		bn_new(n);
 
 		ep_curve_get_ord(n);
-		l = RLC_CEIL(bn_bits(n), EP_DEPTH);
+		l = RLC_CEIL(bn_bits(n), d);
 
 		n0 = bn_bits(k);
-		p0 = (EP_DEPTH) * l - 1;
+		p0 = d * l - 1;
 
 		w = 0;
 		p1 = p0--;
-		for (j = EP_DEPTH - 1; j >= 0; j--, p1 -= l) {
+		for (j = d - 1; j >= 0; j--, p1 -= l) {
 			w = w << 1;
 			if (p1 < n0 && bn_get_bit(k, p1)) {
 				w = w | 1;
@@ -247,7 +246,7 @@ static void ep_mul_combs_plain(ep_t r, const ep_t *t, const bn_t k) {
 
 			w = 0;
 			p1 = p0--;
-			for (j = EP_DEPTH - 1; j >= 0; j--, p1 -= l) {
+			for (j = d - 1; j >= 0; j--, p1 -= l) {
 				w = w << 1;
 				if (p1 < n0 && bn_get_bit(k, p1)) {
 					w = w | 1;
@@ -272,7 +271,103 @@ static void ep_mul_combs_plain(ep_t r, const ep_t *t, const bn_t k) {
 
 #endif /* EP_PLAIN || EP_SUPER */
 
-#endif /* EP_FIX == LWNAF */
+/**
+ * Fills the first 2^d entries of a comb table in affine coordinates, with
+ * entry i holding the sum of 2^(jl) * p for every bit j set in i.
+ *
+ * @param[out] t				- the precomputed table.
+ * @param[in] p					- the point to multiply.
+ * @param[in] d					- the depth of the comb.
+ * @param[in] l					- the number of doublings between teeth.
+ */
+static void ep_mul_pre_comb_tab(ep_t *t, const ep_t p, int d, int l) {
+	int i, j;
+
+	ep_set_infty(t[0]);
+	ep_norm(t[1], p);
+	if (d == 1) {
+		return;
+	}
+
+	/* Compute the teeth 2^(jl) * p contiguously and share one inversion. */
+	for (j = 1; j < d; j++) {
+		ep_dbl(t[j + 1], t[j]);
+		for (i = 1; i < l; i++) {
+			ep_dbl(t[j + 1], t[j + 1]);
+		}
+	}
+	ep_norm_sim(t + 2, (const ep_t *)t + 2, d - 1);
+	for (j = d - 1; j > 0; j--) {
+		ep_copy(t[1 << j], t[j + 1]);
+	}
+
+	/* Each row is the previous rows plus a new tooth, added in a batch. */
+	for (j = 1; j < d; j++) {
+		for (i = 1; i < (1 << j); i++) {
+			ep_copy(t[(1 << j) + i], t[1 << j]);
+		}
+		ep_add_sim(t + (1 << j) + 1, (const ep_t *)t + 1,
+				(const ep_t *)t + (1 << j) + 1, (1 << j) - 1);
+	}
+}
+
+/**
+ * Precomputes a table for a point multiplication using the COMBS method.
+ *
+ * @param[out] t				- the precomputed table.
+ * @param[in] p					- the point to multiply.
+ * @param[in] d					- the depth of the comb.
+ */
+static void ep_mul_pre_combs_imp(ep_t *t, const ep_t p, int d) {
+	int l;
+	bn_t n;
+
+	bn_null(n);
+
+	TRY {
+		bn_new(n);
+
+		ep_curve_get_ord(n);
+		l = bn_bits(n);
+		l = ((l % d) == 0 ? (l / d) : (l / d) + 1);
+#if defined(EP_ENDOM)
+		if (ep_curve_is_endom()) {
+			l = bn_bits(n);
+			l = ((l % (2 * d)) == 0 ? (l / (2 * d)) : (l / (2 * d)) + 1);
+		}
+#endif
+
+		ep_mul_pre_comb_tab(t, p, d, l);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(n);
+	}
+}
+
+/**
+ * Multiplies a prime elliptic curve point by an integer using the COMBS
+ * method with a given depth.
+ *
+ * @param[out] r 				- the result.
+ * @param[in] t					- the precomputed table.
+ * @param[in] k					- the integer.
+ * @param[in] d					- the depth of the comb.
+ */
+static void ep_mul_fix_combs_imp(ep_t r, const ep_t *t, const bn_t k, int d) {
+#if defined(EP_ENDOM)
+	if (ep_curve_is_endom()) {
+		ep_mul_combs_endom(r, t, k, d);
+		return;
+	}
+#endif
+
+#if defined(EP_PLAIN) || defined(EP_SUPER)
+	ep_mul_combs_plain(r, t, k, d);
+#endif
+}
 
 /*============================================================================*/
 /* Public definitions                                                         */
@@ -329,62 +424,11 @@ void ep_mul_fix_basic(ep_t r, const ep_t *t, const bn_t k) {
 #if EP_FIX == COMBS || !defined(STRIP)
 
 void ep_mul_pre_combs(ep_t *t, const ep_t p) {
-	int i, j, l;
-	bn_t n;
-
-	bn_null(n);
-
-	TRY {
-		bn_new(n);
-
-		ep_curve_get_ord(n);
-		l = bn_bits(n);
-		l = ((l % EP_DEPTH) == 0 ? (l / EP_DEPTH) : (l / EP_DEPTH) + 1);
-#if defined(EP_ENDOM)
-		if (ep_curve_is_endom()) {
-			l = bn_bits(n);
-			l = ((l % (2 * EP_DEPTH)) ==
-					0 ? (l / (2 * EP_DEPTH)) : (l / (2 * EP_DEPTH)) + 1);
-		}
-#endif
-
-		ep_set_infty(t[0]);
-
-		ep_copy(t[1], p);
-		for (j = 1; j < EP_DEPTH; j++) {
-			ep_dbl(t[1 << j], t[1 << (j - 1)]);
-			for (i = 1; i < l; i++) {
-				ep_dbl(t[1 << j], t[1 << j]);
-			}
-#if defined(EP_MIXED)
-			ep_norm(t[1 << j], t[1 << j]);
-#endif
-			for (i = 1; i < (1 << j); i++) {
-				ep_add(t[(1 << j) + i], t[i], t[1 << j]);
-			}
-		}
-
-		ep_norm_sim(t + 2, (const ep_t *)t + 2, RLC_EP_TABLE_COMBS - 2);
-	}
-	CATCH_ANY {
-		THROW(ERR_CAUGHT);
-	}
-	FINALLY {
-		bn_free(n);
-	}
+	ep_mul_pre_combs_imp(t, p, EP_DEPTH);
 }
 
 void ep_mul_fix_combs(ep_t r, const ep_t *t, const bn_t k) {
-#if defined(EP_ENDOM)
-	if (ep_curve_is_endom()) {
-		ep_mul_combs_endom(r, t, k);
-		return;
-	}
-#endif
-
-#if defined(EP_PLAIN) || defined(EP_SUPER)
-	ep_mul_combs_plain(r, t, k);
-#endif
+	ep_mul_fix_combs_imp(r, t, k, EP_DEPTH);
 }
 #endif
 
@@ -403,20 +447,7 @@ void ep_mul_pre_combd(ep_t *t, const ep_t p) {
 		d = RLC_CEIL(bn_bits(n), EP_DEPTH);
 		e = (d % 2 == 0 ? (d / 2) : (d / 2) + 1);
 
-		ep_set_infty(t[0]);
-		ep_copy(t[1], p);
-		for (j = 1; j < EP_DEPTH; j++) {
-			ep_dbl(t[1 << j], t[1 << (j - 1)]);
-			for (i = 1; i < d; i++) {
-				ep_dbl(t[1 << j], t[1 << j]);
-			}
-#if defined(EP_MIXED)
-			ep_norm(t[1 << j], t[1 << j]);
-#endif
-			for (i = 1; i < (1 << j); i++) {
-				ep_add(t[(1 << j) + i], t[i], t[1 << j]);
-			}
-		}
+		ep_mul_pre_comb_tab(t, p, EP_DEPTH, d);
 		ep_set_infty(t[1 << EP_DEPTH]);
 		for (j = 1; j < (1 << EP_DEPTH); j++) {
 			ep_dbl(t[(1 << EP_DEPTH) + j], t[j]);
@@ -425,7 +456,6 @@ void ep_mul_pre_combd(ep_t *t, const ep_t p) {
 			}
 		}
 
-		ep_norm_sim(t + 2, (const ep_t *)t + 2, (1 << EP_DEPTH) - 2);
 		ep_norm_sim(t + (1 << EP_DEPTH) + 1,
 				(const ep_t *)t + (1 << EP_DEPTH) + 1, (1 << EP_DEPTH) - 1);
 	}
@@ -508,3 +538,11 @@ void ep_mul_fix_lwnaf(ep_t r, const ep_t *t, const bn_t k) {
 	ep_mul_fix_plain(r, t, k);
 }
 #endif
+
+void ep_mul_pre_dynam(ep_pre_t t, const ep_t p) {
+	ep_mul_pre_combs_imp(t->t, p, t->depth);
+}
+
+void ep_mul_fix_dynam(ep_t r, const ep_pre_t t, const bn_t k) {
+	ep_mul_fix_combs_imp(r, (const ep_t *)t->t, k, t->depth);
+}
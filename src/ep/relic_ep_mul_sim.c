@@ -36,6 +36,11 @@
 /* Private definitions                                                        */
 /*============================================================================*/
 
+/**
+ * Number of points normalized at once by the bucket method.
+ */
+#define EP_LOT_BLOCK	1024
+
 #if EP_SIM == INTER || !defined(STRIP)
 
 #if defined(EP_ENDOM)
@@ -404,6 +409,236 @@ static void ep_mul_sim_plain(ep_t r, const ep_t p, const bn_t k, const ep_t q,
 
 #endif /* EP_SIM == INTER */
 
+/**
+ * Multiplies and adds multiple prime elliptic curve points simultaneously
+ * using interleaved w-NAF recodings.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars, possibly negative.
+ * @param[in] n				- the number of points to multiply.
+ * @param[in] l				- the maximum number of bits in the scalars.
+ */
+static void ep_mul_lot_inter(ep_t r, const ep_t *p, const bn_t *k, int n,
+		int l) {
+	/* Size the recodings by the scalars, which may be wider than a field
+	 * element if they are not reduced modulo the group order. */
+	const int s = 1 << (EP_WIDTH - 2), m = l + 1;
+	int i, j, *_l;
+	int8_t *naf, *_k;
+	ep_t *t;
+
+	_l = RLC_ALLOCA(int, n);
+	naf = RLC_ALLOCA(int8_t, n * m);
+	t = RLC_ALLOCA(ep_t, n * s);
+
+	TRY {
+		if (_l == NULL || naf == NULL || t == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n * s; i++) {
+			ep_null(t[i]);
+			ep_new(t[i]);
+		}
+
+		l = 0;
+		for (i = 0; i < n; i++) {
+			_k = naf + i * m;
+			_l[i] = 0;
+			if (ep_is_infty(p[i]) || bn_is_zero(k[i])) {
+				continue;
+			}
+			_l[i] = m;
+			bn_rec_naf(_k, &_l[i], k[i], EP_WIDTH);
+			if (bn_sign(k[i]) == RLC_NEG) {
+				for (j = 0; j < _l[i]; j++) {
+					_k[j] = -_k[j];
+				}
+			}
+			l = RLC_MAX(l, _l[i]);
+			ep_tab(t + i * s, p[i], EP_WIDTH);
+		}
+
+		ep_set_infty(r);
+		for (i = l - 1; i >= 0; i--) {
+			ep_dbl(r, r);
+			for (j = 0; j < n; j++) {
+				if (i < _l[j]) {
+					_k = naf + j * m;
+					if (_k[i] > 0) {
+						ep_add(r, r, t[j * s + _k[i] / 2]);
+					}
+					if (_k[i] < 0) {
+						ep_sub(r, r, t[j * s - _k[i] / 2]);
+					}
+				}
+			}
+		}
+		/* Convert r to affine coordinates. */
+		ep_norm(r, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		if (t != NULL) {
+			for (i = 0; i < n * s; i++) {
+				ep_free(t[i]);
+			}
+		}
+		RLC_FREE(t);
+		RLC_FREE(naf);
+		RLC_FREE(_l);
+	}
+}
+
+/**
+ * Estimates the number of point additions of the bucket method and chooses
+ * its window size. Doublings are ignored, since they are the same for every
+ * method.
+ *
+ * @param[out] w			- the window size.
+ * @param[in] n				- the number of points.
+ * @param[in] l				- the maximum number of bits in the scalars.
+ * @return the estimated cost.
+ */
+static int ep_lot_cost_bkt(int *w, int n, int l) {
+	int i, cost, best = 0;
+
+	for (i = 1; i <= 12; i++) {
+		/* One addition per point and two per bucket in each window. */
+		cost = RLC_CEIL(l, i) * (n + (1 << (i + 1)));
+		if (i == 1 || cost < best) {
+			best = cost;
+			*w = i;
+		}
+	}
+	return best;
+}
+
+/**
+ * Returns the unsigned window of a scalar starting at a given bit.
+ *
+ * @param[in] k				- the scalar.
+ * @param[in] j				- the first bit of the window.
+ * @param[in] w				- the window size.
+ * @return the window.
+ */
+static int ep_lot_win(const bn_t k, int j, int w) {
+	int i, v = 0;
+
+	for (i = w - 1; i >= 0; i--) {
+		v = (v << 1) | bn_get_bit(k, j + i);
+	}
+	return v;
+}
+
+/**
+ * Multiplies and adds multiple prime elliptic curve points simultaneously
+ * using the bucket method. In each window, the points are accumulated in the
+ * bucket indexed by their scalar digit and the buckets are then combined with
+ * running sums. Arrays are kept in the heap, since the number of points may be
+ * large.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integer scalars, possibly negative.
+ * @param[in] n				- the number of points to multiply.
+ * @param[in] l				- the maximum number of bits in the scalars.
+ * @param[in] w				- the window size.
+ */
+static void ep_mul_lot_bkt(ep_t r, const ep_t *p, const bn_t *k, int n, int l,
+		int w) {
+	int i, j, c = 0, d, h = (1 << w) - 1, *idx = NULL;
+	ep_t s, u, *q = NULL, *bkt = NULL;
+
+	ep_null(s);
+	ep_null(u);
+
+	TRY {
+		ep_new(s);
+		ep_new(u);
+		idx = (int *)malloc(n * sizeof(int));
+		q = (ep_t *)calloc(n, sizeof(ep_t));
+		bkt = (ep_t *)calloc(h, sizeof(ep_t));
+		if (idx == NULL || q == NULL || bkt == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			ep_null(q[i]);
+			ep_new(q[i]);
+		}
+		for (i = 0; i < h; i++) {
+			ep_null(bkt[i]);
+			ep_new(bkt[i]);
+		}
+
+		/* Keep the nontrivial terms, with the sign moved to the point. */
+		for (i = 0; i < n; i++) {
+			if (!ep_is_infty(p[i]) && !bn_is_zero(k[i])) {
+				if (bn_sign(k[i]) == RLC_NEG) {
+					ep_neg(q[c], p[i]);
+				} else {
+					ep_copy(q[c], p[i]);
+				}
+				idx[c++] = i;
+			}
+		}
+		/* Affine points allow mixed additions into the buckets. Normalize in
+		 * blocks, since simultaneous inversion allocates in the stack. */
+		for (i = 0; i < c; i += EP_LOT_BLOCK) {
+			j = RLC_MIN(c - i, EP_LOT_BLOCK);
+			ep_norm_sim(q + i, (const ep_t *)q + i, j);
+		}
+
+		ep_set_infty(r);
+		for (i = RLC_CEIL(l, w) - 1; i >= 0; i--) {
+			for (j = 0; j < w; j++) {
+				ep_dbl(r, r);
+			}
+			for (j = 0; j < h; j++) {
+				ep_set_infty(bkt[j]);
+			}
+			for (j = 0; j < c; j++) {
+				d = ep_lot_win(k[idx[j]], i * w, w);
+				if (d != 0) {
+					ep_add(bkt[d - 1], bkt[d - 1], q[j]);
+				}
+			}
+			/* Compute the sum of d * bkt[d - 1] with running sums. */
+			ep_set_infty(s);
+			ep_set_infty(u);
+			for (j = h - 1; j >= 0; j--) {
+				ep_add(s, s, bkt[j]);
+				ep_add(u, u, s);
+			}
+			ep_add(r, r, u);
+		}
+		/* Convert r to affine coordinates. */
+		ep_norm(r, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		ep_free(s);
+		ep_free(u);
+		if (q != NULL) {
+			for (i = 0; i < n; i++) {
+				ep_free(q[i]);
+			}
+		}
+		if (bkt != NULL) {
+			for (i = 0; i < h; i++) {
+				ep_free(bkt[i]);
+			}
+		}
+		free(idx);
+		free(q);
+		free(bkt);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -719,3 +954,24 @@ void ep_mul_sim_dig(ep_t r, const ep_t p[], dig_t k[], int len) {
 		ep_free(t);
 	}
 }
+
+void ep_mul_sim_lot(ep_t r, const ep_t *p, const bn_t *k, int n) {
+	const int s = 1 << (EP_WIDTH - 2);
+	int i, l = 0, w;
+
+	if (n <= 0) {
+		ep_set_infty(r);
+		return;
+	}
+
+	for (i = 0; i < n; i++) {
+		l = RLC_MAX(l, bn_bits(k[i]));
+	}
+
+	/* Compare with one table and one addition per w-NAF window per point. */
+	if (ep_lot_cost_bkt(&w, n, l) < n * (s + l / (EP_WIDTH + 1))) {
+		ep_mul_lot_bkt(r, p, k, n, l, w);
+	} else {
+		ep_mul_lot_inter(r, p, k, n, l);
+	}
+}
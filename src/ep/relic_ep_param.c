@@ -620,6 +620,8 @@ void ep_param_set(int param) {
 	bn_null(r);
 	bn_null(h);
 
+	core_init_mod(RLC_CORE_EP);
+
 	TRY {
 		fp_new(a);
 		fp_new(b);
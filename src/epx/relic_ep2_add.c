@@ -458,3 +458,92 @@ void ep2_sub_projc(ep2_t r, ep2_t p, ep2_t q) {
 }
 
 #endif
+
+void ep2_add_sim(ep2_t *r, ep2_t *p, ep2_t *q, int n) {
+	int i;
+	fp2_t t0, t1, t2, *d;
+
+	if (n <= 0) {
+		return;
+	}
+
+	d = RLC_ALLOCA(fp2_t, n);
+	fp2_null(t0);
+	fp2_null(t1);
+	fp2_null(t2);
+
+	TRY {
+		if (d == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			fp2_null(d[i]);
+		}
+		fp2_new(t0);
+		fp2_new(t1);
+		fp2_new(t2);
+		for (i = 0; i < n; i++) {
+			fp2_new(d[i]);
+			/* d_i = x2 - x1, or 1 if the pair needs special handling. */
+			if (ep2_is_infty(p[i]) || ep2_is_infty(q[i])) {
+				fp2_set_dig(d[i], 1);
+			} else {
+				fp2_sub(d[i], q[i]->x, p[i]->x);
+				if (fp2_is_zero(d[i])) {
+					fp2_set_dig(d[i], 1);
+				}
+			}
+		}
+
+		/* Montgomery's trick: a single inversion for the whole batch. */
+		fp2_inv_sim(d, d, n);
+
+		for (i = 0; i < n; i++) {
+			if (ep2_is_infty(p[i])) {
+				ep2_copy(r[i], q[i]);
+				continue;
+			}
+			if (ep2_is_infty(q[i])) {
+				ep2_copy(r[i], p[i]);
+				continue;
+			}
+			if (fp2_cmp(p[i]->x, q[i]->x) == RLC_EQ) {
+				if (fp2_cmp(p[i]->y, q[i]->y) == RLC_EQ) {
+					ep2_dbl(r[i], p[i]);
+					ep2_norm(r[i], r[i]);
+				} else {
+					ep2_set_infty(r[i]);
+				}
+				continue;
+			}
+			/* t2 = lambda = (y2 - y1)/(x2 - x1). */
+			fp2_sub(t1, q[i]->y, p[i]->y);
+			fp2_mul(t2, t1, d[i]);
+			/* x3 = lambda^2 - x2 - x1. */
+			fp2_sqr(t1, t2);
+			fp2_sub(t0, t1, p[i]->x);
+			fp2_sub(t0, t0, q[i]->x);
+			/* y3 = lambda * (x1 - x3) - y1. */
+			fp2_sub(t1, p[i]->x, t0);
+			fp2_mul(t1, t2, t1);
+			fp2_sub(r[i]->y, t1, p[i]->y);
+			fp2_copy(r[i]->x, t0);
+			fp2_set_dig(r[i]->z, 1);
+			r[i]->norm = 1;
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp2_free(t0);
+		fp2_free(t1);
+		fp2_free(t2);
+		if (d != NULL) {
+			for (i = 0; i < n; i++) {
+				fp2_free(d[i]);
+			}
+		}
+		RLC_FREE(d);
+	}
+}
@@ -31,6 +31,7 @@
  */
 
 #include "relic_core.h"
+#include "relic_md.h"
 
 /*============================================================================*/
 /* Private definitions                                                        */
@@ -248,6 +249,70 @@
 	RLC_GET(str, CURVE##_H, sizeof(CURVE##_H));								\
 	bn_read_str(h, str, strlen(str), 16);									\
 
+#if defined(EP_PRECO) && ALLOC == AUTO
+
+/**
+ * Fills the header of a persisted precomputation table.
+ *
+ * @param[out] hdr		- the header.
+ * @param[in] bin		- the serialized generator and table.
+ * @param[in] len		- the number of bytes in the serialization.
+ */
+static void ep2_curve_pre_hdr(uint8_t *hdr, const uint8_t *bin, int len) {
+	uint32_t f[] = { RLC_EP_PRE_VER, FP_PRIME, RLC_DIG, EP_FIX, EP_DEPTH,
+			RLC_EP_TABLE, sizeof(ep2_st) };
+	uint8_t h[RLC_MD_LEN];
+
+	memset(hdr, 0, RLC_EP_PRE_HDR);
+	memcpy(hdr, "REP2", 4);
+	memcpy(hdr + 4, f, sizeof(f));
+	md_map(h, bin, len);
+	memcpy(hdr + RLC_EP_PRE_HDR / 2, h, RLC_MIN(RLC_MD_LEN, RLC_EP_PRE_HDR / 2));
+}
+
+/**
+ * Points the generator table to the persisted one, if it was built for the
+ * current generator.
+ *
+ * @return 1 if the persisted table is used, 0 otherwise.
+ */
+static int ep2_curve_use_map(void) {
+	ctx_t *ctx = core_get();
+	ep2_st *m = (ep2_st *)ctx->ep2_map;
+
+	if (m == NULL || ep2_cmp(&(ctx->ep2_g), m) != RLC_EQ) {
+		return 0;
+	}
+	for (int i = 0; i < RLC_EP_TABLE; i++) {
+		ctx->ep2_ptr[i] = &m[i + 1];
+	}
+	return 1;
+}
+
+#endif
+
+#if defined(EP_PRECO)
+
+/**
+ * Builds the precomputation table for the generator, or reuses the persisted
+ * one if it matches.
+ */
+static void ep2_curve_set_tab(void) {
+	ctx_t *ctx = core_get();
+
+	for (int i = 0; i < RLC_EP_TABLE; i++) {
+		ctx->ep2_ptr[i] = &(ctx->ep2_pre[i]);
+	}
+#if ALLOC == AUTO
+	if (ep2_curve_use_map()) {
+		return;
+	}
+#endif
+	ep2_mul_pre((ep2_t *)ep2_curve_get_tab(), &(ctx->ep2_g));
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -259,6 +324,7 @@ void ep2_curve_init(void) {
 	for (int i = 0; i < RLC_EP_TABLE; i++) {
 		ctx->ep2_ptr[i] = &(ctx->ep2_pre[i]);
 	}
+	ctx->ep2_map = NULL;
 #endif
 
 #if ALLOC == DYNAMIC || ALLOC == STACK
@@ -398,6 +464,70 @@ ep2_t *ep2_curve_get_tab(void) {
 
 #endif
 
+int ep2_curve_size_pre(void) {
+#if defined(EP_PRECO) && ALLOC == AUTO
+	return RLC_EP_PRE_HDR + (RLC_EP_TABLE + 1) * sizeof(ep2_st);
+#else
+	return 0;
+#endif
+}
+
+void ep2_curve_write_pre(uint8_t *bin, int len) {
+#if defined(EP_PRECO) && ALLOC == AUTO
+	ctx_t *ctx = core_get();
+	uint8_t *b = bin + RLC_EP_PRE_HDR;
+
+	if (len != ep2_curve_size_pre()) {
+		THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	memcpy(b, &(ctx->ep2_g), sizeof(ep2_st));
+	memcpy(b + sizeof(ep2_st), ep2_curve_get_tab(), RLC_EP_TABLE * sizeof(ep2_st));
+	ep2_curve_pre_hdr(bin, b, len - RLC_EP_PRE_HDR);
+#else
+	(void)bin;
+	(void)len;
+	THROW(ERR_NO_CONFIG);
+#endif
+}
+
+int ep2_curve_map_pre(const uint8_t *bin, int len) {
+#if defined(EP_PRECO) && ALLOC == AUTO
+	ctx_t *ctx = core_get();
+	uint8_t hdr[RLC_EP_PRE_HDR];
+	int used = (ctx->ep2_ptr[0] != &(ctx->ep2_pre[0]));
+
+	if (bin == NULL) {
+		ctx->ep2_map = NULL;
+		if (used) {
+			ep2_curve_set_tab();
+		}
+		return RLC_OK;
+	}
+
+	/* The points are used in place, so they must be suitably aligned. */
+	if (len != ep2_curve_size_pre() ||
+			((uintptr_t)bin % RLC_MAX(ALIGN, sizeof(dig_t))) != 0) {
+		return RLC_ERR;
+	}
+	ep2_curve_pre_hdr(hdr, bin + RLC_EP_PRE_HDR, len - RLC_EP_PRE_HDR);
+	if (memcmp(hdr, bin, RLC_EP_PRE_HDR) != 0) {
+		return RLC_ERR;
+	}
+
+	ctx->ep2_map = bin + RLC_EP_PRE_HDR;
+	if (!ep2_curve_use_map() && used) {
+		ep2_curve_set_tab();
+	}
+	return RLC_OK;
+#else
+	(void)bin;
+	(void)len;
+	return RLC_ERR;
+#endif
+}
+
 void ep2_curve_set_twist(int type) {
 	char str[4 * RLC_FP_BYTES + 1];
 	ctx_t *ctx = core_get();
@@ -412,6 +542,8 @@ void ep2_curve_set_twist(int type) {
 	bn_null(r);
 	bn_null(h);
 
+	core_init_mod(RLC_CORE_PP);
+
 	ctx->ep2_is_twist = 0;
 	if (type == EP_MTYPE || type == EP_DTYPE) {
 		ctx->ep2_is_twist = type;
@@ -495,7 +627,7 @@ void ep2_curve_set_twist(int type) {
 		fp_prime_calc();
 
 #if defined(EP_PRECO)
-		ep2_mul_pre((ep2_t *)ep2_curve_get_tab(), &(ctx->ep2_g));
+		ep2_curve_set_tab();
 #endif
 	}
 	CATCH_ANY {
@@ -512,6 +644,8 @@ void ep2_curve_set_twist(int type) {
 
 void ep2_curve_set(fp2_t a, fp2_t b, ep2_t g, bn_t r, bn_t h) {
 	ctx_t *ctx = core_get();
+
+	core_init_mod(RLC_CORE_PP);
 	ctx->ep2_is_twist = 0;
 
 	fp_copy(ctx->ep2_a[0], a[0]);
@@ -524,6 +658,6 @@ void ep2_curve_set(fp2_t a, fp2_t b, ep2_t g, bn_t r, bn_t h) {
 	bn_copy(&(ctx->ep2_h), h);
 
 #if defined(EP_PRECO)
-	ep2_mul_pre((ep2_t *)ep2_curve_get_tab(), &(ctx->ep2_g));
+	ep2_curve_set_tab();
 #endif
 }
@@ -161,10 +161,54 @@ void ep2_mul_fix_basic(ep2_t r, ep2_t *t, bn_t k) {
 
 #endif
 
-#if EP_FIX == COMBS || !defined(STRIP)
+/**
+ * Fills the first 2^d entries of a comb table in affine coordinates, with
+ * entry i holding the sum of 2^(jl) * p for every bit j set in i.
+ *
+ * @param[out] t				- the precomputed table.
+ * @param[in] p					- the point to multiply.
+ * @param[in] d					- the depth of the comb.
+ * @param[in] l					- the number of doublings between teeth.
+ */
+static void ep2_mul_pre_comb_tab(ep2_t *t, ep2_t p, int d, int l) {
+	int i, j;
 
-void ep2_mul_pre_combs(ep2_t *t, ep2_t p) {
-	int i, j, l;
+	ep2_set_infty(t[0]);
+	ep2_norm(t[1], p);
+	if (d == 1) {
+		return;
+	}
+
+	/* Compute the teeth 2^(jl) * p contiguously and share one inversion. */
+	for (j = 1; j < d; j++) {
+		ep2_dbl(t[j + 1], t[j]);
+		for (i = 1; i < l; i++) {
+			ep2_dbl(t[j + 1], t[j + 1]);
+		}
+	}
+	ep2_norm_sim(t + 2, t + 2, d - 1);
+	for (j = d - 1; j > 0; j--) {
+		ep2_copy(t[1 << j], t[j + 1]);
+	}
+
+	/* Each row is the previous rows plus a new tooth, added in a batch. */
+	for (j = 1; j < d; j++) {
+		for (i = 1; i < (1 << j); i++) {
+			ep2_copy(t[(1 << j) + i], t[1 << j]);
+		}
+		ep2_add_sim(t + (1 << j) + 1, t + 1, t + (1 << j) + 1, (1 << j) - 1);
+	}
+}
+
+/**
+ * Precomputes a table for a point multiplication using the COMBS method.
+ *
+ * @param[out] t				- the precomputed table.
+ * @param[in] p					- the point to multiply.
+ * @param[in] d					- the depth of the comb.
+ */
+static void ep2_mul_pre_combs_imp(ep2_t *t, ep2_t p, int d) {
+	int l;
 	bn_t n;
 
 	bn_null(n);
@@ -174,28 +218,9 @@ void ep2_mul_pre_combs(ep2_t *t, ep2_t p) {
 
 		ep2_curve_get_ord(n);
 		l = bn_bits(n);
-		l = ((l % EP_DEPTH) == 0 ? (l / EP_DEPTH) : (l / EP_DEPTH) + 1);
-
-		ep2_set_infty(t[0]);
+		l = ((l % d) == 0 ? (l / d) : (l / d) + 1);
 
-		ep2_copy(t[1], p);
-		for (j = 1; j < EP_DEPTH; j++) {
-			ep2_dbl(t[1 << j], t[1 << (j - 1)]);
-			for (i = 1; i < l; i++) {
-				ep2_dbl(t[1 << j], t[1 << j]);
-			}
-#if defined(EP_MIXED)
-			ep2_norm(t[1 << j], t[1 << j]);
-#endif
-			for (i = 1; i < (1 << j); i++) {
-				ep2_add(t[(1 << j) + i], t[i], t[1 << j]);
-			}
-		}
-#if defined(EP_MIXED)
-		for (i = 1; i < RLC_EP_TABLE_COMBS; i++) {
-			ep2_norm(t[i], t[i]);
-		}
-#endif
+		ep2_mul_pre_comb_tab(t, p, d, l);
 	}
 	CATCH_ANY {
 		THROW(ERR_CAUGHT);
@@ -205,7 +230,15 @@ void ep2_mul_pre_combs(ep2_t *t, ep2_t p) {
 	}
 }
 
-void ep2_mul_fix_combs(ep2_t r, ep2_t *t, bn_t k) {
+/**
+ * Multiplies a fixed point using a table precomputed by the COMBS method.
+ *
+ * @param[out] r 				- the result.
+ * @param[in] t					- the precomputed table.
+ * @param[in] k					- the integer.
+ * @param[in] d					- the depth of the comb.
+ */
+static void ep2_mul_fix_combs_imp(ep2_t r, ep2_t *t, bn_t k, int d) {
 	int i, j, l, w, n0, p0, p1;
 	bn_t n;
 
@@ -221,15 +254,15 @@ void ep2_mul_fix_combs(ep2_t r, ep2_t *t, bn_t k) {
 
 		ep2_curve_get_ord(n);
 		l = bn_bits(n);
-		l = ((l % EP_DEPTH) == 0 ? (l / EP_DEPTH) : (l / EP_DEPTH) + 1);
+		l = ((l % d) == 0 ? (l / d) : (l / d) + 1);
 
 		n0 = bn_bits(k);
 
-		p0 = (EP_DEPTH) * l - 1;
+		p0 = d * l - 1;
 
 		w = 0;
 		p1 = p0--;
-		for (j = EP_DEPTH - 1; j >= 0; j--, p1 -= l) {
+		for (j = d - 1; j >= 0; j--, p1 -= l) {
 			w = w << 1;
 			if (p1 < n0 && bn_get_bit(k, p1)) {
 				w = w | 1;
@@ -242,7 +275,7 @@ void ep2_mul_fix_combs(ep2_t r, ep2_t *t, bn_t k) {
 
 			w = 0;
 			p1 = p0--;
-			for (j = EP_DEPTH - 1; j >= 0; j--, p1 -= l) {
+			for (j = d - 1; j >= 0; j--, p1 -= l) {
 				w = w << 1;
 				if (p1 < n0 && bn_get_bit(k, p1)) {
 					w = w | 1;
@@ -265,6 +298,16 @@ void ep2_mul_fix_combs(ep2_t r, ep2_t *t, bn_t k) {
 	}
 }
 
+#if EP_FIX == COMBS || !defined(STRIP)
+
+void ep2_mul_pre_combs(ep2_t *t, ep2_t p) {
+	ep2_mul_pre_combs_imp(t, p, EP_DEPTH);
+}
+
+void ep2_mul_fix_combs(ep2_t r, ep2_t *t, bn_t k) {
+	ep2_mul_fix_combs_imp(r, t, k, EP_DEPTH);
+}
+
 #endif
 
 #if EP_FIX == COMBD || !defined(STRIP)
@@ -283,20 +326,7 @@ void ep2_mul_pre_combd(ep2_t *t, ep2_t p) {
 		d = ((d % EP_DEPTH) == 0 ? (d / EP_DEPTH) : (d / EP_DEPTH) + 1);
 		e = (d % 2 == 0 ? (d / 2) : (d / 2) + 1);
 
-		ep2_set_infty(t[0]);
-		ep2_copy(t[1], p);
-		for (j = 1; j < EP_DEPTH; j++) {
-			ep2_dbl(t[1 << j], t[1 << (j - 1)]);
-			for (i = 1; i < d; i++) {
-				ep2_dbl(t[1 << j], t[1 << j]);
-			}
-#if defined(EP_MIXED)
-			ep2_norm(t[1 << j], t[1 << j]);
-#endif
-			for (i = 1; i < (1 << j); i++) {
-				ep2_add(t[(1 << j) + i], t[i], t[1 << j]);
-			}
-		}
+		ep2_mul_pre_comb_tab(t, p, EP_DEPTH, d);
 		ep2_set_infty(t[1 << EP_DEPTH]);
 		for (j = 1; j < (1 << EP_DEPTH); j++) {
 			ep2_dbl(t[(1 << EP_DEPTH) + j], t[j]);
@@ -304,11 +334,9 @@ void ep2_mul_pre_combd(ep2_t *t, ep2_t p) {
 				ep2_dbl(t[(1 << EP_DEPTH) + j], t[(1 << EP_DEPTH) + j]);
 			}
 		}
-#if defined(EP_MIXED)
-		for (i = 1; i < RLC_EP_TABLE_COMBD; i++) {
-			ep2_norm(t[i], t[i]);
-		}
-#endif
+
+		ep2_norm_sim(t + (1 << EP_DEPTH) + 1, t + (1 << EP_DEPTH) + 1,
+				(1 << EP_DEPTH) - 1);
 	}
 	CATCH_ANY {
 		THROW(ERR_CAUGHT);
@@ -391,3 +419,11 @@ void ep2_mul_fix_lwnaf(ep2_t r, ep2_t *t, bn_t k) {
 }
 
 #endif
+
+void ep2_mul_pre_dynam(ep2_pre_t t, ep2_t p) {
+	ep2_mul_pre_combs_imp(t->t, p, t->depth);
+}
+
+void ep2_mul_fix_dynam(ep2_t r, ep2_pre_t t, bn_t k) {
+	ep2_mul_fix_combs_imp(r, t->t, k, t->depth);
+}
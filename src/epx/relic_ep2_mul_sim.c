@@ -430,3 +430,78 @@ void ep2_mul_sim_dig(ep2_t r, ep2_t p[], dig_t k[], int len) {
 		ep2_free(t);
 	}
 }
+
+void ep2_mul_sim_lot(ep2_t r, ep2_t *p, const bn_t *k, int n) {
+	const int s = 1 << (EP_WIDTH - 2), m = 2 * RLC_FP_BITS + 1;
+	int i, j, l, *_l;
+	int8_t *naf, *_k;
+	ep2_t *t;
+
+	if (n <= 0) {
+		ep2_set_infty(r);
+		return;
+	}
+
+	_l = RLC_ALLOCA(int, n);
+	naf = RLC_ALLOCA(int8_t, n * m);
+	t = RLC_ALLOCA(ep2_t, n * s);
+
+	TRY {
+		if (_l == NULL || naf == NULL || t == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n * s; i++) {
+			ep2_null(t[i]);
+			ep2_new(t[i]);
+		}
+
+		l = 0;
+		for (i = 0; i < n; i++) {
+			_k = naf + i * m;
+			_l[i] = 0;
+			if (ep2_is_infty(p[i]) || bn_is_zero(k[i])) {
+				continue;
+			}
+			_l[i] = m;
+			bn_rec_naf(_k, &_l[i], k[i], EP_WIDTH);
+			if (bn_sign(k[i]) == RLC_NEG) {
+				for (j = 0; j < _l[i]; j++) {
+					_k[j] = -_k[j];
+				}
+			}
+			l = RLC_MAX(l, _l[i]);
+			ep2_tab(t + i * s, p[i], EP_WIDTH);
+		}
+
+		ep2_set_infty(r);
+		for (i = l - 1; i >= 0; i--) {
+			ep2_dbl(r, r);
+			for (j = 0; j < n; j++) {
+				if (i < _l[j]) {
+					_k = naf + j * m;
+					if (_k[i] > 0) {
+						ep2_add(r, r, t[j * s + _k[i] / 2]);
+					}
+					if (_k[i] < 0) {
+						ep2_sub(r, r, t[j * s - _k[i] / 2]);
+					}
+				}
+			}
+		}
+		/* Convert r to affine coordinates. */
+		ep2_norm(r, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		if (t != NULL) {
+			for (i = 0; i < n * s; i++) {
+				ep2_free(t[i]);
+			}
+		}
+		RLC_FREE(t);
+		RLC_FREE(naf);
+		RLC_FREE(_l);
+	}
+}
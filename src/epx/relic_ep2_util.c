@@ -327,3 +327,116 @@ void ep2_write_bin(uint8_t *bin, int len, ep2_t a, int pack) {
 		ep2_free(t);
 	}
 }
+
+void ep2_pre_make(ep2_pre_t t, int d) {
+	int i;
+
+	if (d < 1 || d > RLC_EP_DEPTH_MAX) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+
+	t->depth = t->size = 0;
+	t->t = (ep2_t *)calloc(1 << d, sizeof(ep2_t));
+	if (t->t == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	TRY {
+		for (i = 0; i < (1 << d); i++) {
+			ep2_null(t->t[i]);
+			ep2_new(t->t[i]);
+		}
+		t->depth = d;
+		t->size = 1 << d;
+	} CATCH_ANY {
+		/* Unwind the points allocated so far, entries are still null. */
+		for (i = 0; i < (1 << d); i++) {
+			ep2_free(t->t[i]);
+		}
+		free(t->t);
+		t->t = NULL;
+		THROW(ERR_CAUGHT);
+	}
+}
+
+void ep2_pre_clean(ep2_pre_t t) {
+	if (t->t != NULL) {
+		for (int i = 0; i < t->size; i++) {
+			ep2_free(t->t[i]);
+		}
+		free(t->t);
+		t->t = NULL;
+	}
+	t->depth = t->size = 0;
+}
+
+int ep2_pre_mem(ep2_pre_t t) {
+	int r = sizeof(ep2_pre_st) + t->size * sizeof(ep2_t);
+#if ALLOC != AUTO
+	r += t->size * sizeof(ep2_st);
+#endif
+	return r;
+}
+
+int ep2_pre_size_bin(ep2_pre_t t, int pack) {
+	int l = (pack ? 2 * RLC_FP_BYTES + 1 : 4 * RLC_FP_BYTES + 1);
+	/* The header stores the depth and the curve, the identity is implicit. */
+	return 2 + (t->size - 1) * l;
+}
+
+void ep2_pre_read_bin(ep2_pre_t t, const uint8_t *bin, int len) {
+	int l;
+
+	if (len < 2) {
+		THROW(ERR_NO_BUFFER);
+		return;
+	}
+	if (bin[1] != (uint8_t)ep_param_get()) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+	if (bin[0] != t->depth) {
+		ep2_pre_clean(t);
+		ep2_pre_make(t, bin[0]);
+	}
+	if (t->size < 2 || (len - 2) % (t->size - 1) != 0) {
+		THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	l = (len - 2) / (t->size - 1);
+	ep2_set_infty(t->t[0]);
+	for (int i = 1; i < t->size; i++) {
+		const uint8_t *b = bin + 2 + (i - 1) * l;
+		if (b[0] == 0) {
+			ep2_set_infty(t->t[i]);
+		} else {
+			ep2_read_bin(t->t[i], b, l);
+		}
+		if (!ep2_is_valid(t->t[i])) {
+			THROW(ERR_NO_VALID);
+			return;
+		}
+	}
+}
+
+void ep2_pre_write_bin(uint8_t *bin, int len, ep2_pre_t t, int pack) {
+	int l = (pack ? 2 * RLC_FP_BYTES + 1 : 4 * RLC_FP_BYTES + 1);
+
+	if (len != ep2_pre_size_bin(t, pack)) {
+		THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	bin[0] = t->depth;
+	bin[1] = ep_param_get();
+	for (int i = 1; i < t->size; i++) {
+		if (ep2_is_infty(t->t[i])) {
+			memset(bin + 2 + (i - 1) * l, 0, l);
+		} else {
+			ep2_write_bin(bin + 2 + (i - 1) * l, l, t->t[i], pack);
+		}
+	}
+}
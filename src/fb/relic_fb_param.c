@@ -48,6 +48,8 @@ int fb_param_get(void) {
 }
 
 void fb_param_set(int param) {
+	core_init_mod(RLC_CORE_FB);
+
 	switch (param) {
 		case PENTA_8:
 			fb_poly_set_penta(4, 3, 2);
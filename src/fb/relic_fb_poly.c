@@ -111,12 +111,12 @@ static void find_trace(void) {
 /**
  * Precomputes half-traces for z^i with odd i.
  *
+ * @param[out] t			- the precomputed tables.
  * @throw ERR_NO_MEMORY if there is no available memory.
  */
-static void find_solve(void) {
+static void find_solve(fb_pre_t t) {
 	int i, j, k, l;
 	fb_t t0;
-	ctx_t *ctx = core_get();
 
 	fb_null(t0);
 
@@ -132,14 +132,14 @@ static void find_solve(void) {
 						fb_set_bit(t0, i + 2 * k + 1, 1);
 					}
 				}
-				fb_copy(ctx->fb_half[l][j], t0);
+				fb_copy(t->half[l][j], t0);
 				for (k = 0; k < (RLC_FB_BITS - 1) / 2; k++) {
-					fb_sqr(ctx->fb_half[l][j], ctx->fb_half[l][j]);
-					fb_sqr(ctx->fb_half[l][j], ctx->fb_half[l][j]);
-					fb_add(ctx->fb_half[l][j], ctx->fb_half[l][j], t0);
+					fb_sqr(t->half[l][j], t->half[l][j]);
+					fb_sqr(t->half[l][j], t->half[l][j]);
+					fb_add(t->half[l][j], t->half[l][j], t0);
 				}
 			}
-			fb_rsh(ctx->fb_half[l][j], ctx->fb_half[l][j], 1);
+			fb_rsh(t->half[l][j], t->half[l][j], 1);
 		}
 	}
 	CATCH_ANY {
@@ -165,12 +165,6 @@ static void find_srz(void) {
 	for (int i = 1; i < RLC_FB_BITS; i++) {
 		fb_sqr(ctx->fb_srz, ctx->fb_srz);
 	}
-
-#ifdef FB_PRECO
-	for (int i = 0; i <= 255; i++) {
-		fb_mul_dig(ctx->fb_tab_srz[i], ctx->fb_srz, i);
-	}
-#endif
 }
 
 #endif
@@ -181,7 +175,7 @@ static void find_srz(void) {
  * Finds an addition chain for (RLC_FB_BITS - 1).
  */
 static void find_chain(void) {
-	int i, j, k, l, x, y, u[RLC_TERMS + 1];
+	int i, j, k, l;
 	ctx_t *ctx = core_get();
 
 	ctx->chain_len = -1;
@@ -266,10 +260,20 @@ static void find_chain(void) {
 			}
 			break;
 	}
+}
+
+/**
+ * Precomputes the tables for repeated squarings along the addition chain.
+ *
+ * @param[out] t			- the precomputed tables.
+ */
+static void find_sqr(fb_pre_t t) {
+	int i, j, x, y, u[RLC_TERMS + 1];
+	ctx_t *ctx = core_get();
 
 	for (i = 0; i < RLC_TERMS; i++) {
 		for (j = 0; j < RLC_FB_TABLE; j++) {
-			ctx->fb_tab_ptr[i][j] = &(ctx->fb_tab_sqr[i][j]);
+			t->ptr[i][j] = &(t->sqr[i][j]);
 		}
 	}
 
@@ -286,7 +290,11 @@ static void find_chain(void) {
 	}
 
 	for (i = 0; i <= ctx->chain_len; i++) {
-		fb_itr_pre((fb_t *)fb_poly_tab_sqr(i), u[i]);
+#if ALLOC == AUTO
+		fb_itr_pre((fb_t *)*t->ptr[i], u[i]);
+#else
+		fb_itr_pre((fb_t *)t->ptr[i], u[i]);
+#endif
 	}
 }
 
@@ -298,19 +306,26 @@ static void find_chain(void) {
  * @param[in] f				- the new irreducible polynomial.
  */
 static void fb_poly_set(const fb_t f) {
-	fb_copy(core_get()->fb_poly, f);
+	ctx_t *ctx = core_get();
+
+	fb_copy(ctx->fb_poly, f);
 #if FB_TRC == QUICK || !defined(STRIP)
 	find_trace();
 #endif
-#if FB_SLV == QUICK || !defined(STRIP)
-	find_solve();
-#endif
 #if FB_SRT == QUICK || !defined(STRIP)
 	find_srz();
 #endif
 #if FB_INV == ITOHT || !defined(STRIP)
 	find_chain();
 #endif
+	/* Reuse the tables in use if they were built for the same polynomial. */
+	if (ctx->fb_pre == NULL || fb_cmp(ctx->fb_pre->poly, f) != RLC_EQ) {
+		if (ctx->fb_own == NULL) {
+			fb_pre_new(ctx->fb_own);
+		}
+		ctx->fb_pre = ctx->fb_own;
+		fb_poly_pre_build(ctx->fb_pre);
+	}
 }
 
 /*============================================================================*/
@@ -323,9 +338,14 @@ void fb_poly_init(void) {
 	fb_zero(ctx->fb_poly);
 	ctx->fb_pa = ctx->fb_pb = ctx->fb_pc = 0;
 	ctx->fb_na = ctx->fb_nb = ctx->fb_nc = -1;
+	ctx->fb_pre = ctx->fb_own = NULL;
 }
 
 void fb_poly_clean(void) {
+	ctx_t *ctx = core_get();
+
+	fb_pre_free(ctx->fb_own);
+	ctx->fb_pre = NULL;
 }
 
 dig_t *fb_poly_get(void) {
@@ -438,11 +458,16 @@ dig_t *fb_poly_get_srz(void) {
 
 const fb_t *fb_poly_tab_sqr(int i) {
 #if FB_INV == ITOHT || !defined(STRIP)
+	fb_pre_t t = core_get()->fb_pre;
+
+	if (t == NULL) {
+		return NULL;
+	}
 	/* If ITOHT inversion is used and tables are precomputed, return them. */
 #if ALLOC == AUTO
-	return (const fb_t *)*core_get()->fb_tab_ptr[i];
+	return (const fb_t *)*t->ptr[i];
 #else
-	return (const fb_t *)core_get()->fb_tab_ptr[i];
+	return (const fb_t *)t->ptr[i];
 #endif
 
 #else
@@ -451,14 +476,10 @@ const fb_t *fb_poly_tab_sqr(int i) {
 }
 
 const dig_t *fb_poly_tab_srz(int i) {
-#if FB_SRT == QUICK || !defined(STRIP)
-
-#ifdef FB_PRECO
-	return core_get()->fb_tab_srz[i];
-#else
-	return NULL;
-#endif
+#if (FB_SRT == QUICK || !defined(STRIP)) && defined(FB_PRECO)
+	fb_pre_t t = core_get()->fb_pre;
 
+	return (t == NULL ? NULL : t->srz[i]);
 #else
 	return NULL;
 #endif
@@ -484,12 +505,46 @@ void fb_poly_get_rdc(int *a, int *b, int *c) {
 
 const dig_t *fb_poly_get_slv(void) {
 #if FB_SLV == QUICK || !defined(STRIP)
-	return (dig_t *)&(core_get()->fb_half);
+	fb_pre_t t = core_get()->fb_pre;
+
+	return (t == NULL ? NULL : (dig_t *)&(t->half));
 #else
 	return NULL;
 #endif
 }
 
+void fb_poly_pre_build(fb_pre_t t) {
+	fb_copy(t->poly, fb_poly_get());
+#if FB_SLV == QUICK || !defined(STRIP)
+	find_solve(t);
+#endif
+#if (FB_SRT == QUICK || !defined(STRIP)) && defined(FB_PRECO)
+	for (int i = 0; i <= 255; i++) {
+		fb_mul_dig(t->srz[i], fb_poly_get_srz(), i);
+	}
+#endif
+#if FB_INV == ITOHT || !defined(STRIP)
+	find_sqr(t);
+#endif
+}
+
+void fb_poly_pre_set(fb_pre_t t) {
+	ctx_t *ctx = core_get();
+
+	if (t == NULL) {
+		t = ctx->fb_own;
+	} else if (!fb_is_zero(ctx->fb_poly) &&
+			fb_cmp(t->poly, ctx->fb_poly) != RLC_EQ) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+	ctx->fb_pre = t;
+}
+
+fb_pre_t fb_poly_pre_get(void) {
+	return core_get()->fb_pre;
+}
+
 const int *fb_poly_get_chain(int *len) {
 #if FB_INV == ITOHT || !defined(STRIP)
 	ctx_t *ctx = core_get();
@@ -41,6 +41,8 @@
 void fp_add_basic(fp_t c, const fp_t a, const fp_t b) {
 	dig_t carry;
 
+	RLC_COUNT(RLC_CNT_FP_ADD);
+
 	carry = fp_addn_low(c, a, b);
 	if (carry || (dv_cmp(c, fp_prime_get(), RLC_FP_DIGS) != RLC_LT)) {
 		carry = fp_subn_low(c, c, fp_prime_get());
@@ -52,6 +54,7 @@ void fp_add_basic(fp_t c, const fp_t a, const fp_t b) {
 #if FP_ADD == INTEG || !defined(STRIP)
 
 void fp_add_integ(fp_t c, const fp_t a, const fp_t b) {
+	RLC_COUNT(RLC_CNT_FP_ADD);
 	fp_addm_low(c, a, b);
 }
 
@@ -92,6 +95,8 @@ void fp_add_dig(fp_t c, const fp_t a, dig_t b) {
 void fp_sub_basic(fp_t c, const fp_t a, const fp_t b) {
 	dig_t carry;
 
+	RLC_COUNT(RLC_CNT_FP_ADD);
+
 	carry = fp_subn_low(c, a, b);
 	if (carry) {
 		fp_addn_low(c, c, fp_prime_get());
@@ -103,6 +108,7 @@ void fp_sub_basic(fp_t c, const fp_t a, const fp_t b) {
 #if FP_ADD == INTEG || !defined(STRIP)
 
 void fp_sub_integ(fp_t c, const fp_t a, const fp_t b) {
+	RLC_COUNT(RLC_CNT_FP_ADD);
 	fp_subm_low(c, a, b);
 }
 
@@ -159,6 +165,8 @@ void fp_neg_integ(fp_t c, const fp_t a) {
 void fp_dbl_basic(fp_t c, const fp_t a) {
 	dig_t carry;
 
+	RLC_COUNT(RLC_CNT_FP_ADD);
+
 	carry = fp_lsh1_low(c, a);
 	if (carry || (dv_cmp(c, fp_prime_get(), RLC_FP_DIGS) != RLC_LT)) {
 		carry = fp_subn_low(c, c, fp_prime_get());
@@ -170,6 +178,7 @@ void fp_dbl_basic(fp_t c, const fp_t a) {
 #if FP_ADD == INTEG || !defined(STRIP)
 
 void fp_dbl_integ(fp_t c, const fp_t a) {
+	RLC_COUNT(RLC_CNT_FP_ADD);
 	fp_dblm_low(c, a);
 }
 
@@ -33,6 +33,87 @@
 #include "relic_fp_low.h"
 #include "relic_bn_low.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Minimum number of elements for which simultaneous inversion is computed
+ * over batches of eight elements.
+ */
+#define FP_INV_X8		32
+
+/**
+ * Inverts multiple prime field elements simultaneously, running eight
+ * interleaved chains of products over batches of elements.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the prime field elements to invert.
+ * @param[in] n				- the number of elements.
+ */
+static void fp_inv_sim_x8(fp_t *c, const fp_t *a, int n) {
+	int i, j, m = RLC_CEIL(n, 8);
+	fp_t t[8], u[8];
+	fp_x8_t v, w, *x = RLC_ALLOCA(fp_x8_t, m), *y = RLC_ALLOCA(fp_x8_t, m);
+
+	TRY {
+		if (x == NULL || y == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < 8; i++) {
+			fp_null(t[i]);
+			fp_null(u[i]);
+			fp_new(t[i]);
+			fp_new(u[i]);
+		}
+
+		/* Lane k of the j-th batch holds element 8 * j + k, padded by one. */
+		for (j = 0; j < m; j++) {
+			for (i = 0; i < 8; i++) {
+				if (8 * j + i < n) {
+					fp_copy(t[i], a[8 * j + i]);
+				} else {
+					fp_set_dig(t[i], 1);
+				}
+			}
+			fp_x8_conv(x[j], (const fp_t *)t);
+			if (j == 0) {
+				memcpy(y[0], x[0], sizeof(fp_x8_t));
+			} else {
+				fp_mul_x8(y[j], y[j - 1], x[j]);
+			}
+		}
+
+		fp_x8_back(t, y[m - 1]);
+		fp_inv_sim(u, (const fp_t *)t, 8);
+		fp_x8_conv(v, (const fp_t *)u);
+
+		for (j = m - 1; j >= 0; j--) {
+			if (j > 0) {
+				fp_mul_x8(w, v, y[j - 1]);
+				fp_mul_x8(v, v, x[j]);
+				fp_x8_back(t, w);
+			} else {
+				fp_x8_back(t, v);
+			}
+			for (i = 0; i < 8 && 8 * j + i < n; i++) {
+				fp_copy(c[8 * j + i], t[i]);
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (i = 0; i < 8; i++) {
+			fp_free(t[i]);
+			fp_free(u[i]);
+		}
+		RLC_FREE(x);
+		RLC_FREE(y);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -42,6 +123,8 @@
 void fp_inv_basic(fp_t c, const fp_t a) {
 	bn_t e;
 
+	RLC_COUNT(RLC_CNT_FP_INV);
+
 	bn_null(e);
 
 	if (fp_is_zero(a)) {
@@ -72,6 +155,8 @@ void fp_inv_basic(fp_t c, const fp_t a) {
 void fp_inv_binar(fp_t c, const fp_t a) {
 	bn_t u, v, g1, g2, p;
 
+	RLC_COUNT(RLC_CNT_FP_INV);
+
 	bn_null(u);
 	bn_null(v);
 	bn_null(g1);
@@ -191,6 +276,8 @@ void fp_inv_monty(fp_t c, const fp_t a) {
 	dig_t carry;
 	int i, k, flag = 0;
 
+	RLC_COUNT(RLC_CNT_FP_INV);
+
 	bn_null(_a);
 	bn_null(_p);
 	bn_null(u);
@@ -330,6 +417,8 @@ void fp_inv_monty(fp_t c, const fp_t a) {
 void fp_inv_exgcd(fp_t c, const fp_t a) {
 	bn_t u, v, g1, g2, p, q, r;
 
+	RLC_COUNT(RLC_CNT_FP_INV);
+
 	bn_null(u);
 	bn_null(v);
 	bn_null(g1);
@@ -414,6 +503,8 @@ void fp_inv_divst(fp_t c, const fp_t a) {
 	dv_t f, g, z, _v0, _r0, _t, u;
 	fp_t precomp;
 
+	RLC_COUNT(RLC_CNT_FP_INV);
+
 	bn_null(t);
 	dv_null(f);
 	dv_null(g);
@@ -538,6 +629,7 @@ void fp_inv_divst(fp_t c, const fp_t a) {
 #if FP_INV == LOWER || !defined(STRIP)
 
 void fp_inv_lower(fp_t c, const fp_t a) {
+	RLC_COUNT(RLC_CNT_FP_INV);
 	fp_invn_low(c, a);
 }
 
@@ -545,8 +637,14 @@ void fp_inv_lower(fp_t c, const fp_t a) {
 
 void fp_inv_sim(fp_t *c, const fp_t *a, int n) {
 	int i;
-	fp_t u, *t = RLC_ALLOCA(fp_t, n);
+	fp_t u, *t;
+
+	if (n >= FP_INV_X8 && fp_x8_is_vec()) {
+		fp_inv_sim_x8(c, a, n);
+		return;
+	}
 
+	t = RLC_ALLOCA(fp_t, n);
 	fp_null(u);
 
 	TRY {
@@ -187,6 +187,8 @@ void fp_mul_basic(fp_t c, const fp_t a, const fp_t b) {
 	dv_t t;
 	dig_t carry;
 
+	RLC_COUNT(RLC_CNT_FP_MUL);
+
 	dv_null(t);
 
 	TRY {
@@ -215,6 +217,8 @@ void fp_mul_basic(fp_t c, const fp_t a, const fp_t b) {
 void fp_mul_comba(fp_t c, const fp_t a, const fp_t b) {
 	dv_t t;
 
+	RLC_COUNT(RLC_CNT_FP_MUL);
+
 	dv_null(t);
 
 	TRY {
@@ -237,6 +241,7 @@ void fp_mul_comba(fp_t c, const fp_t a, const fp_t b) {
 #if FP_MUL == INTEG || !defined(STRIP)
 
 void fp_mul_integ(fp_t c, const fp_t a, const fp_t b) {
+	RLC_COUNT(RLC_CNT_FP_MUL);
 	fp_mulm_low(c, a, b);
 }
 
@@ -247,6 +252,8 @@ void fp_mul_integ(fp_t c, const fp_t a, const fp_t b) {
 void fp_mul_karat(fp_t c, const fp_t a, const fp_t b) {
 	dv_t t;
 
+	RLC_COUNT(RLC_CNT_FP_MUL);
+
 	dv_null(t);
 
 	TRY {
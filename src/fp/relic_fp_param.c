@@ -76,6 +76,8 @@ void fp_param_set(int param) {
 	/* Suppress possible unused parameter warning. */
 	(void) f;
 
+	core_init_mod(RLC_CORE_FP);
+
 	TRY {
 		bn_new(t0);
 		bn_new(t1);
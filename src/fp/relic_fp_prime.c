@@ -39,6 +39,54 @@
 /* Private definitions                                                        */
 /*============================================================================*/
 
+/**
+ * Writes a multiple precision integer in radix 2^52.
+ *
+ * @param[out] c			- the limbs of the result.
+ * @param[in] a				- the multiple precision integer.
+ */
+static void fp_prime_limbs(uint64_t *c, const bn_t a) {
+	for (int i = 0; i < RLC_FP_X8_DIGS; i++) {
+		c[i] = 0;
+		for (int j = 0; j < 52; j++) {
+			c[i] |= (uint64_t)bn_get_bit(a, 52 * i + j) << j;
+		}
+	}
+}
+
+/**
+ * Precomputes the constants used by the batched prime field arithmetic, which
+ * works with Montgomery reduction modulo R' = 2^(52 * RLC_FP_X8_DIGS).
+ *
+ * @param[in] t				- a temporary multiple precision integer.
+ */
+static void fp_prime_set_x8(bn_t t) {
+	ctx_t *ctx = core_get();
+	uint64_t p0, inv;
+	int r = 0;
+
+#if FP_RDC == MONTY
+	r = RLC_FP_DIGS * RLC_DIG;
+#endif
+
+	fp_prime_limbs(ctx->x8_prime, &(ctx->prime));
+	/* Newton iteration doubles the precision of the inverse at each step. */
+	p0 = ctx->x8_prime[0];
+	inv = p0;
+	for (int i = 0; i < 5; i++) {
+		inv *= 2 - p0 * inv;
+	}
+	ctx->x8_u = (0 - inv) & (((uint64_t)1 << 52) - 1);
+
+	/* Conversions multiply by R'^2/R and R, where R is the radix of fp_t. */
+	bn_set_2b(t, 2 * 52 * RLC_FP_X8_DIGS - r);
+	bn_mod(t, t, &(ctx->prime));
+	fp_prime_limbs(ctx->x8_conv, t);
+	bn_set_2b(t, r);
+	bn_mod(t, t, &(ctx->prime));
+	fp_prime_limbs(ctx->x8_back, t);
+}
+
 /**
  * Assigns the prime field modulus.
  *
@@ -121,6 +169,7 @@ static void fp_prime_set(const bn_t p) {
 		}
 #endif
 
+		fp_prime_set_x8(t);
 		fp_prime_calc();
 	}
 	CATCH_ANY {
@@ -161,6 +161,8 @@ void fp_sqr_basic(fp_t c, const fp_t a) {
 	int i;
 	dv_t t;
 
+	RLC_COUNT(RLC_CNT_FP_SQR);
+
 	dv_null(t);
 
 	TRY {
@@ -188,6 +190,8 @@ void fp_sqr_basic(fp_t c, const fp_t a) {
 void fp_sqr_comba(fp_t c, const fp_t a) {
 	dv_t t;
 
+	RLC_COUNT(RLC_CNT_FP_SQR);
+
 	dv_null(t);
 
 	TRY {
@@ -209,6 +213,7 @@ void fp_sqr_comba(fp_t c, const fp_t a) {
 #if FP_SQR == INTEG || !defined(STRIP)
 
 void fp_sqr_integ(fp_t c, const fp_t a) {
+	RLC_COUNT(RLC_CNT_FP_SQR);
 	fp_sqrm_low(c, a);
 }
 
@@ -219,6 +224,8 @@ void fp_sqr_integ(fp_t c, const fp_t a) {
 void fp_sqr_karat(fp_t c, const fp_t a) {
 	dv_t t;
 
+	RLC_COUNT(RLC_CNT_FP_SQR);
+
 	dv_null(t);
 
 	TRY {
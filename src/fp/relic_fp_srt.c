@@ -41,6 +41,8 @@ int fp_srt(fp_t c, const fp_t a) {
 	fp_t t1;
 	int r = 0;
 
+	RLC_COUNT(RLC_CNT_FP_SRT);
+
 	bn_null(e);
 	fp_null(t0);
 	fp_null(t1);
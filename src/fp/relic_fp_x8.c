@@ -0,0 +1,418 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the batched prime field arithmetic, which operates on
+ * eight independent elements at a time.
+ *
+ * @ingroup fp
+ */
+
+#include "relic_core.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Number of lanes in a batch.
+ */
+#define LANES		8
+
+/**
+ * Mask for the bits of a 52-bit limb.
+ */
+#define MASK52		(((uint64_t)1 << 52) - 1)
+
+/**
+ * Flag to indicate that the AVX-512 IFMA kernels can be compiled.
+ */
+#if defined(__x86_64__) && defined(__GNUC__)
+#define FP_X8_IFMA
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+/**
+ * Enables the AVX-512 IFMA instruction set extension for a single function.
+ */
+#define RLC_IFMA	__attribute__((target("avx512f,avx512ifma")))
+
+/**
+ * Checks if the processor supports AVX-512 IFMA and the operating system saves
+ * the vector registers. The result is computed once and cached.
+ *
+ * @return 1 if the extension can be used, 0 otherwise.
+ */
+static int fp_x8_ifma(void) {
+	static int flag = -1;
+	unsigned int a, b, c, d, lo, hi;
+
+	if (flag < 0) {
+		flag = 0;
+		/* OSXSAVE is bit 27 of ECX. */
+		if (__get_cpuid(1, &a, &b, &c, &d) && ((c >> 27) & 1)) {
+			__asm__ volatile ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+			/* The OS must save the SSE, AVX and AVX-512 state (bits 1-2, 5-7). */
+			if ((lo & 0xE6) == 0xE6 && __get_cpuid_count(7, 0, &a, &b, &c, &d)) {
+				/* AVX512F is bit 16 and AVX512IFMA is bit 21 of EBX. */
+				flag = ((b >> 16) & 1) && ((b >> 21) & 1);
+			}
+		}
+		(void)hi;
+	}
+	return flag;
+}
+
+/**
+ * Reduces a batch in [0, 2p) to [0, p) by a conditional subtraction.
+ *
+ * @param[out] c			- the result.
+ * @param[in] t				- the normalized limbs of the batch to reduce.
+ * @param[in] p				- the limbs of the prime modulus.
+ */
+static RLC_IFMA void fp_x8_sub_ifma(uint64_t *c, const __m512i *t,
+		const uint64_t *p) {
+	__m512i s[RLC_FP_X8_DIGS], b = _mm512_setzero_si512();
+	__m512i mask = _mm512_set1_epi64(MASK52);
+	__mmask8 k;
+
+	for (int i = 0; i < RLC_FP_X8_DIGS; i++) {
+		s[i] = _mm512_sub_epi64(t[i], _mm512_set1_epi64(p[i]));
+		s[i] = _mm512_sub_epi64(s[i], b);
+		b = _mm512_srli_epi64(s[i], 63);
+		s[i] = _mm512_and_si512(s[i], mask);
+	}
+	/* Keep the subtraction in the lanes where it did not borrow. */
+	k = _mm512_cmpeq_epi64_mask(b, _mm512_setzero_si512());
+	for (int i = 0; i < RLC_FP_X8_DIGS; i++) {
+		_mm512_storeu_si512(c + LANES * i, _mm512_mask_blend_epi64(k, t[i], s[i]));
+	}
+}
+
+/**
+ * Adds two batches using AVX-512 instructions.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first batch to add.
+ * @param[in] b				- the second batch to add.
+ * @param[in] p				- the limbs of the prime modulus.
+ */
+static RLC_IFMA void fp_add_x8_ifma(uint64_t *c, const uint64_t *a,
+		const uint64_t *b, const uint64_t *p) {
+	__m512i t[RLC_FP_X8_DIGS], r = _mm512_setzero_si512();
+	__m512i mask = _mm512_set1_epi64(MASK52);
+
+	for (int i = 0; i < RLC_FP_X8_DIGS; i++) {
+		t[i] = _mm512_add_epi64(_mm512_loadu_si512(a + LANES * i),
+				_mm512_loadu_si512(b + LANES * i));
+		t[i] = _mm512_add_epi64(t[i], r);
+		r = _mm512_srli_epi64(t[i], 52);
+		t[i] = _mm512_and_si512(t[i], mask);
+	}
+	fp_x8_sub_ifma(c, t, p);
+}
+
+/**
+ * Multiplies two batches with Montgomery reduction modulo 2^(52 * L) using
+ * AVX-512 IFMA instructions.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first batch to multiply.
+ * @param[in] b				- the second batch to multiply.
+ * @param[in] p				- the limbs of the prime modulus.
+ * @param[in] u				- the reduction constant.
+ */
+static RLC_IFMA void fp_mul_x8_ifma(uint64_t *c, const uint64_t *a,
+		const uint64_t *b, const uint64_t *p, uint64_t u) {
+	__m512i t[RLC_FP_X8_DIGS + 1], x[RLC_FP_X8_DIGS], m[RLC_FP_X8_DIGS];
+	__m512i y, q, r, zero = _mm512_setzero_si512();
+	__m512i mask = _mm512_set1_epi64(MASK52), v = _mm512_set1_epi64(u);
+
+	for (int i = 0; i < RLC_FP_X8_DIGS; i++) {
+		t[i] = zero;
+		x[i] = _mm512_loadu_si512(a + LANES * i);
+		m[i] = _mm512_set1_epi64(p[i]);
+	}
+	t[RLC_FP_X8_DIGS] = zero;
+
+	for (int i = 0; i < RLC_FP_X8_DIGS; i++) {
+		y = _mm512_loadu_si512(b + LANES * i);
+		for (int j = 0; j < RLC_FP_X8_DIGS; j++) {
+			t[j] = _mm512_madd52lo_epu64(t[j], x[j], y);
+			t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], x[j], y);
+		}
+		q = _mm512_and_si512(_mm512_madd52lo_epu64(zero, t[0], v), mask);
+		for (int j = 0; j < RLC_FP_X8_DIGS; j++) {
+			t[j] = _mm512_madd52lo_epu64(t[j], m[j], q);
+			t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], m[j], q);
+		}
+		/* The lowest limb is now divisible by 2^52, so shift it out. */
+		r = _mm512_srli_epi64(t[0], 52);
+		for (int j = 0; j < RLC_FP_X8_DIGS; j++) {
+			t[j] = t[j + 1];
+		}
+		t[0] = _mm512_add_epi64(t[0], r);
+		t[RLC_FP_X8_DIGS] = zero;
+	}
+
+	for (int i = 0; i < RLC_FP_X8_DIGS - 1; i++) {
+		t[i + 1] = _mm512_add_epi64(t[i + 1], _mm512_srli_epi64(t[i], 52));
+		t[i] = _mm512_and_si512(t[i], mask);
+	}
+	fp_x8_sub_ifma(c, t, p);
+}
+
+#endif /* FP_X8_IFMA */
+
+/**
+ * Computes the 104-bit product of two 52-bit limbs using only 64-bit
+ * arithmetic.
+ *
+ * @param[out] h			- the higher 52 bits of the product.
+ * @param[out] l			- the lower 52 bits of the product.
+ * @param[in] a				- the first limb.
+ * @param[in] b				- the second limb.
+ */
+static void fp_mul52(uint64_t *h, uint64_t *l, uint64_t a, uint64_t b) {
+	uint64_t m26 = ((uint64_t)1 << 26) - 1, a0, a1, b0, b1, r, s;
+
+	a0 = a & m26;
+	a1 = a >> 26;
+	b0 = b & m26;
+	b1 = b >> 26;
+	s = a0 * b1 + a1 * b0;
+	r = a0 * b0 + ((s & m26) << 26);
+	*l = r & MASK52;
+	*h = a1 * b1 + (s >> 26) + (r >> 52);
+}
+
+/**
+ * Reduces one element of a batch in [0, 2p) to [0, p) by a conditional
+ * subtraction.
+ *
+ * @param[out] c			- the result, at the lane of the element.
+ * @param[in] t				- the normalized limbs of the element to reduce.
+ * @param[in] p				- the limbs of the prime modulus.
+ */
+static void fp_x8_sub_basic(uint64_t *c, const uint64_t *t, const uint64_t *p) {
+	uint64_t s[RLC_FP_X8_DIGS], b = 0;
+
+	for (int i = 0; i < RLC_FP_X8_DIGS; i++) {
+		s[i] = t[i] - p[i] - b;
+		b = s[i] >> 63;
+		s[i] &= MASK52;
+	}
+	for (int i = 0; i < RLC_FP_X8_DIGS; i++) {
+		c[LANES * i] = (b ? t[i] : s[i]);
+	}
+}
+
+/**
+ * Multiplies one element of two batches with Montgomery reduction modulo
+ * 2^(52 * L) using portable code.
+ *
+ * @param[out] c			- the result, at the lane of the element.
+ * @param[in] a				- the first element, at its lane.
+ * @param[in] b				- the second element, at its lane.
+ * @param[in] p				- the limbs of the prime modulus.
+ * @param[in] u				- the reduction constant.
+ */
+static void fp_mul_x8_basic(uint64_t *c, const uint64_t *a, const uint64_t *b,
+		const uint64_t *p, uint64_t u) {
+	uint64_t t[RLC_FP_X8_DIGS + 1] = { 0 }, h, l, q;
+
+	for (int i = 0; i < RLC_FP_X8_DIGS; i++) {
+		for (int j = 0; j < RLC_FP_X8_DIGS; j++) {
+			fp_mul52(&h, &l, a[LANES * j], b[LANES * i]);
+			t[j] += l;
+			t[j + 1] += h;
+		}
+		q = ((t[0] & MASK52) * u) & MASK52;
+		for (int j = 0; j < RLC_FP_X8_DIGS; j++) {
+			fp_mul52(&h, &l, p[j], q);
+			t[j] += l;
+			t[j + 1] += h;
+		}
+		l = t[0] >> 52;
+		for (int j = 0; j < RLC_FP_X8_DIGS; j++) {
+			t[j] = t[j + 1];
+		}
+		t[0] += l;
+		t[RLC_FP_X8_DIGS] = 0;
+	}
+
+	for (int i = 0; i < RLC_FP_X8_DIGS - 1; i++) {
+		t[i + 1] += t[i] >> 52;
+		t[i] &= MASK52;
+	}
+	fp_x8_sub_basic(c, t, p);
+}
+
+/**
+ * Multiplies two batches, dispatching to the fastest available kernel.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first batch to multiply.
+ * @param[in] b				- the second batch to multiply.
+ * @param[in] p				- the limbs of the prime modulus.
+ * @param[in] u				- the reduction constant.
+ */
+static void fp_x8_mul(uint64_t *c, const uint64_t *a, const uint64_t *b,
+		const uint64_t *p, uint64_t u) {
+#ifdef FP_X8_IFMA
+	if (fp_x8_ifma()) {
+		fp_mul_x8_ifma(c, a, b, p, u);
+		return;
+	}
+#endif
+	for (int k = 0; k < LANES; k++) {
+		fp_mul_x8_basic(c + k, a + k, b + k, p, u);
+	}
+}
+
+/**
+ * Multiplies each element of a batch by a constant, which is replicated
+ * across all lanes.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the batch to multiply.
+ * @param[in] k				- the limbs of the constant.
+ */
+static void fp_x8_mul_const(uint64_t *c, const uint64_t *a, const uint64_t *k) {
+	fp_x8_t t;
+
+	for (int i = 0; i < RLC_FP_X8_DIGS; i++) {
+		for (int j = 0; j < LANES; j++) {
+			t[LANES * i + j] = k[i];
+		}
+	}
+	fp_x8_mul(c, a, t, core_get()->x8_prime, core_get()->x8_u);
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+int fp_x8_is_vec(void) {
+#ifdef FP_X8_IFMA
+	return fp_x8_ifma();
+#else
+	return 0;
+#endif
+}
+
+void fp_x8_conv(fp_x8_t c, const fp_t *a) {
+	int i, k, d, o;
+	uint64_t t;
+
+	/* Slice the bits of each element into 52-bit limbs. */
+	for (k = 0; k < LANES; k++) {
+		for (i = 0; i < RLC_FP_X8_DIGS; i++) {
+#if WSIZE == 64
+			d = (52 * i) >> 6;
+			o = (52 * i) & 63;
+			t = (d < RLC_FP_DIGS ? a[k][d] >> o : 0);
+			if (o > 12 && d + 1 < RLC_FP_DIGS) {
+				t |= a[k][d + 1] << (64 - o);
+			}
+#else
+			t = 0;
+			for (int j = 0, n = 0; j < 52; j += n) {
+				d = (52 * i + j) / RLC_DIG;
+				o = (52 * i + j) % RLC_DIG;
+				n = RLC_MIN(RLC_DIG - o, 52 - j);
+				if (d < RLC_FP_DIGS) {
+					t |= ((uint64_t)(a[k][d] >> o) &
+							(((uint64_t)1 << n) - 1)) << j;
+				}
+			}
+#endif
+			c[LANES * i + k] = t & MASK52;
+		}
+	}
+	fp_x8_mul_const(c, c, core_get()->x8_conv);
+}
+
+void fp_x8_back(fp_t *c, const fp_x8_t a) {
+	int i, k, d, o;
+	fp_x8_t t;
+
+	fp_x8_mul_const(t, a, core_get()->x8_back);
+	for (k = 0; k < LANES; k++) {
+		fp_zero(c[k]);
+		for (i = 0; i < RLC_FP_X8_DIGS; i++) {
+#if WSIZE == 64
+			d = (52 * i) >> 6;
+			o = (52 * i) & 63;
+			if (d < RLC_FP_DIGS) {
+				c[k][d] |= t[LANES * i + k] << o;
+			}
+			if (o > 12 && d + 1 < RLC_FP_DIGS) {
+				c[k][d + 1] |= t[LANES * i + k] >> (64 - o);
+			}
+#else
+			for (int j = 0, n = 0; j < 52; j += n) {
+				d = (52 * i + j) / RLC_DIG;
+				o = (52 * i + j) % RLC_DIG;
+				n = RLC_MIN(RLC_DIG - o, 52 - j);
+				if (d < RLC_FP_DIGS) {
+					c[k][d] |= (dig_t)((t[LANES * i + k] >> j) &
+							(((uint64_t)1 << n) - 1)) << o;
+				}
+			}
+#endif
+		}
+	}
+}
+
+void fp_add_x8(fp_x8_t c, const fp_x8_t a, const fp_x8_t b) {
+	const uint64_t *p = core_get()->x8_prime;
+	uint64_t t[RLC_FP_X8_DIGS], r;
+
+#ifdef FP_X8_IFMA
+	if (fp_x8_ifma()) {
+		fp_add_x8_ifma(c, a, b, p);
+		return;
+	}
+#endif
+	for (int k = 0; k < LANES; k++) {
+		r = 0;
+		for (int i = 0; i < RLC_FP_X8_DIGS; i++) {
+			t[i] = a[LANES * i + k] + b[LANES * i + k] + r;
+			r = t[i] >> 52;
+			t[i] &= MASK52;
+		}
+		fp_x8_sub_basic(c + k, t, p);
+	}
+}
+
+void fp_mul_x8(fp_x8_t c, const fp_x8_t a, const fp_x8_t b) {
+	fp_x8_mul(c, a, b, core_get()->x8_prime, core_get()->x8_u);
+}
+
+void fp_sqr_x8(fp_x8_t c, const fp_x8_t a) {
+	fp_x8_mul(c, a, a, core_get()->x8_prime, core_get()->x8_u);
+}
@@ -120,6 +120,8 @@ inline static void fp6_mul_dxs_unr_lazyr(dv6_t c, fp6_t a, fp6_t b) {
 void fp12_mul_basic(fp12_t c, fp12_t a, fp12_t b) {
 	fp6_t t0, t1, t2;
 
+	RLC_COUNT(RLC_CNT_FP12_MUL);
+
 	fp6_null(t0);
 	fp6_null(t1);
 	fp6_null(t2);
@@ -161,6 +163,8 @@ void fp12_mul_basic(fp12_t c, fp12_t a, fp12_t b) {
 void fp12_mul_dxs_basic(fp12_t c, fp12_t a, fp12_t b) {
 	fp6_t t0, t1, t2;
 
+	RLC_COUNT(RLC_CNT_FP12_DXS);
+
 	fp6_null(t0);
 	fp6_null(t1);
 	fp6_null(t2);
@@ -301,6 +305,8 @@ void fp12_mul_unr(dv12_t c, fp12_t a, fp12_t b) {
 void fp12_mul_lazyr(fp12_t c, fp12_t a, fp12_t b) {
 	dv12_t t;
 
+	RLC_COUNT(RLC_CNT_FP12_MUL);
+
 	dv12_null(t);
 
 	TRY {
@@ -321,6 +327,8 @@ void fp12_mul_dxs_lazyr(fp12_t c, fp12_t a, fp12_t b) {
 	fp6_t t0;
 	dv6_t u0, u1, u2;
 
+	RLC_COUNT(RLC_CNT_FP12_DXS);
+
 	fp6_null(t0);
 	dv6_null(u0);
 	dv6_null(u1);
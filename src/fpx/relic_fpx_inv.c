@@ -39,6 +39,8 @@
 void fp2_inv(fp2_t c, fp2_t a) {
 	fp_t t0, t1;
 
+	RLC_COUNT(RLC_CNT_FP2_INV);
+
 	fp_null(t0);
 	fp_null(t1);
 
@@ -353,6 +355,57 @@ void fp6_inv(fp6_t c, fp6_t a) {
 	}
 }
 
+void fp6_inv_sim(fp6_t *c, fp6_t *a, int n) {
+	int i;
+	fp6_t u, *t = RLC_ALLOCA(fp6_t, n);
+
+	if (n == 0) {
+		RLC_FREE(t);
+		return;
+	}
+
+	for (i = 0; i < n; i++) {
+		fp6_null(t[i]);
+	}
+	fp6_null(u);
+
+	TRY {
+		if (t == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		for (i = 0; i < n; i++) {
+			fp6_new(t[i]);
+		}
+		fp6_new(u);
+
+		fp6_copy(c[0], a[0]);
+		fp6_copy(t[0], a[0]);
+
+		for (i = 1; i < n; i++) {
+			fp6_copy(t[i], a[i]);
+			fp6_mul(c[i], c[i - 1], t[i]);
+		}
+
+		fp6_inv(u, c[n - 1]);
+
+		for (i = n - 1; i > 0; i--) {
+			fp6_mul(c[i], c[i - 1], u);
+			fp6_mul(u, u, t[i]);
+		}
+		fp6_copy(c[0], u);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (i = 0; i < n; i++) {
+			fp6_free(t[i]);
+		}
+		fp6_free(u);
+		RLC_FREE(t);
+	}
+}
+
 void fp8_inv_cyc(fp8_t c, fp8_t a) {
 	fp4_copy(c[0], a[0]);
 	fp4_neg(c[1], a[1]);
@@ -533,6 +586,8 @@ void fp12_inv(fp12_t c, fp12_t a) {
 	fp6_t t0;
 	fp6_t t1;
 
+	RLC_COUNT(RLC_CNT_FP12_INV);
+
 	fp6_null(t0);
 	fp6_null(t1);
 
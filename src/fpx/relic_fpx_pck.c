@@ -106,6 +106,159 @@ int fp12_upk(fp12_t c, fp12_t a) {
 	}
 }
 
+void fp12_pck_max(fp12_t c, fp12_t a) {
+	fp6_t t, u;
+
+	fp6_null(t);
+	fp6_null(u);
+
+	TRY {
+		fp6_new(t);
+		fp6_new(u);
+
+		if (fp6_is_zero(a[1])) {
+			/* The only cyclotomic element with a_1 = 0 is the identity. */
+			if (fp12_cmp_dig(a, 1) == RLC_EQ) {
+				fp12_zero(c);
+			} else {
+				fp12_copy(c, a);
+			}
+		} else if (!fp12_test_cyc(a)) {
+			fp12_copy(c, a);
+		} else {
+			/* Map a = a_0 + a_1 * w to the torus T2 as t = (1 + a_0)/a_1. */
+			fp6_inv(t, a[1]);
+			fp6_copy(u, a[0]);
+			fp_add_dig(u[0][0], u[0][0], 1);
+			fp6_mul(t, t, u);
+			/* Elements of T6 satisfy t_0 * t_1 = E * t_2^2 + 1/3, so t_0 is
+			 * implied by (t_1, t_2) whenever t_1 is non-zero. */
+			if (fp2_is_zero(t[1])) {
+				fp12_pck(c, a);
+			} else {
+				fp12_zero(c);
+				fp2_copy(c[0][1], t[1]);
+				fp2_copy(c[0][2], t[2]);
+			}
+		}
+	} CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	} FINALLY {
+		fp6_free(t);
+		fp6_free(u);
+	}
+}
+
+int fp12_upk_max(fp12_t c, fp12_t a) {
+	return fp12_upk_max_sim((fp12_t *)c, (fp12_t *)a, 1);
+}
+
+int fp12_upk_max_sim(fp12_t *c, fp12_t *a, int n) {
+	int i, result = 1;
+	fp2_t d, t;
+	fp6_t *v = RLC_ALLOCA(fp6_t, 3 * n);
+	fp6_t *x = v + 0 * n, *y = v + 1 * n, *z = v + 2 * n;
+
+	if (n == 0) {
+		RLC_FREE(v);
+		return 1;
+	}
+
+	fp2_null(d);
+	fp2_null(t);
+
+	TRY {
+		if (v == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		fp2_new(d);
+		fp2_new(t);
+		for (i = 0; i < n; i++) {
+			fp6_null(x[i]);
+			fp6_null(y[i]);
+			fp6_null(z[i]);
+			fp6_new(x[i]);
+			fp6_new(y[i]);
+			fp6_new(z[i]);
+		}
+
+		for (i = 0; i < n; i++) {
+			if (!fp2_is_zero(a[i][0][0]) || !fp6_is_zero(a[i][1])) {
+				fp6_set_dig(z[i], 1);
+				continue;
+			}
+			/* Elements of T6 with t_1 = 0 must also have t_2 = 0. */
+			if (fp2_is_zero(a[i][0][1]) && !fp2_is_zero(a[i][0][2])) {
+				fp6_zero(y[i]);
+				fp6_set_dig(z[i], 1);
+				continue;
+			}
+			/* Compute g = 3 * t_1 * (t_0 + t_1 * v + t_2 * v^2) and d = 3 * t_1
+			 * without inverting t_1, so that a = (g + d * w)/(g - d * w). */
+			fp2_sqr(t, a[i][0][2]);
+			fp2_mul_nor(d, t);
+			fp2_dbl(t, d);
+			fp2_add(x[i][0], t, d);
+			fp_add_dig(x[i][0][0], x[i][0][0], 1);
+			fp2_sqr(t, a[i][0][1]);
+			fp2_dbl(d, t);
+			fp2_add(x[i][1], d, t);
+			fp2_mul(t, a[i][0][1], a[i][0][2]);
+			fp2_dbl(d, t);
+			fp2_add(x[i][2], d, t);
+			fp2_dbl(d, a[i][0][1]);
+			fp2_add(d, d, a[i][0][1]);
+
+			/* y = g^2 + d^2 * v, z = g^2 - d^2 * v. */
+			fp6_sqr(y[i], x[i]);
+			fp2_sqr(t, d);
+			fp6_copy(z[i], y[i]);
+			fp2_add(y[i][1], y[i][1], t);
+			fp2_sub(z[i][1], z[i][1], t);
+			/* x = 2 * d * g. */
+			fp2_dbl(d, d);
+			fp2_mul(x[i][0], x[i][0], d);
+			fp2_mul(x[i][1], x[i][1], d);
+			fp2_mul(x[i][2], x[i][2], d);
+
+			/* Since v is not a square, z = 0 only if both g and d are zero. */
+			if (fp6_is_zero(z[i])) {
+				result = 0;
+				fp6_set_dig(z[i], 1);
+			}
+		}
+
+		/* Share a single inversion among all denominators. */
+		fp6_inv_sim(z, z, n);
+
+		for (i = 0; i < n; i++) {
+			if (!fp2_is_zero(a[i][0][0]) || !fp6_is_zero(a[i][1])) {
+				if (!fp12_upk(c[i], a[i])) {
+					result = 0;
+				}
+			} else if (!fp6_is_zero(y[i])) {
+				fp6_mul(c[i][0], y[i], z[i]);
+				fp6_mul(c[i][1], x[i], z[i]);
+			} else {
+				fp12_set_dig(c[i], 1);
+				result = 0;
+			}
+		}
+	} CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	} FINALLY {
+		fp2_free(d);
+		fp2_free(t);
+		for (i = 0; i < n; i++) {
+			fp6_free(x[i]);
+			fp6_free(y[i]);
+			fp6_free(z[i]);
+		}
+		RLC_FREE(v);
+	}
+	return result;
+}
+
 void fp48_pck(fp48_t c, fp48_t a) {
 	fp48_copy(c, a);
 	if (fp48_test_cyc(c)) {
@@ -424,21 +424,47 @@ void fp12_print(fp12_t a) {
 }
 
 int fp12_size_bin(fp12_t a, int pack) {
-	if (pack) {
-		if (fp12_test_cyc(a)) {
-			return 8 * RLC_FP_BYTES;
-		} else {
-			return 12 * RLC_FP_BYTES;
+	fp12_t t;
+	int size = 12 * RLC_FP_BYTES;
+
+	fp12_null(t);
+
+	TRY {
+		fp12_new(t);
+
+		if (pack > 1) {
+			fp12_pck_max(t, a);
+			if (fp2_is_zero(t[0][0]) && fp6_is_zero(t[1])) {
+				size = 4 * RLC_FP_BYTES;
+			} else if (fp12_test_cyc(a)) {
+				size = 8 * RLC_FP_BYTES;
+			}
+		} else if (pack) {
+			if (fp12_test_cyc(a)) {
+				size = 8 * RLC_FP_BYTES;
+			}
 		}
-	} else {
-		return 12 * RLC_FP_BYTES;
+	} CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	} FINALLY {
+		fp12_free(t);
 	}
+	return size;
 }
 
 void fp12_read_bin(fp12_t a, const uint8_t *bin, int len) {
-	if (len != 8 * RLC_FP_BYTES && len != 12 * RLC_FP_BYTES) {
+	if (len != 4 * RLC_FP_BYTES && len != 8 * RLC_FP_BYTES &&
+			len != 12 * RLC_FP_BYTES) {
 		THROW(ERR_NO_BUFFER);
 	}
+	if (len == 4 * RLC_FP_BYTES) {
+		fp12_zero(a);
+		fp2_read_bin(a[0][1], bin, 2 * RLC_FP_BYTES);
+		fp2_read_bin(a[0][2], bin + 2 * RLC_FP_BYTES, 2 * RLC_FP_BYTES);
+		if (!fp12_upk_max(a, a)) {
+			THROW(ERR_NO_VALID);
+		}
+	}
 	if (len == 8 * RLC_FP_BYTES) {
 		fp2_zero(a[0][0]);
 		fp2_read_bin(a[0][1], bin, 2 * RLC_FP_BYTES);
@@ -462,7 +488,14 @@ void fp12_write_bin(uint8_t *bin, int len, fp12_t a, int pack) {
 	TRY {
 		fp12_new(t);
 
-		if (pack) {
+		if (pack && len == 4 * RLC_FP_BYTES) {
+			fp12_pck_max(t, a);
+			if (!fp2_is_zero(t[0][0]) || !fp6_is_zero(t[1])) {
+				THROW(ERR_NO_VALID);
+			}
+			fp2_write_bin(bin, 2 * RLC_FP_BYTES, t[0][1], 0);
+			fp2_write_bin(bin + 2 * RLC_FP_BYTES, 2 * RLC_FP_BYTES, t[0][2], 0);
+		} else if (pack) {
 			if (len != 8 * RLC_FP_BYTES) {
 				THROW(ERR_NO_BUFFER);
 			}
@@ -0,0 +1,63 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Glue between the code generated by Fiat-Crypto and the low-level prime
+ * field functions.
+ *
+ * @ingroup fp
+ */
+
+#ifndef RLC_FIAT_LOW_H
+#define RLC_FIAT_LOW_H
+
+#include "relic_fp.h"
+
+#include "fiat_fp.c"
+
+/**
+ * Type of the carry bits produced by the generated code.
+ */
+typedef fiat_fp_uint1 fiat_bit_t;
+
+#if WSIZE == 64
+/** Adds two digits and a carry, returning the carry out. */
+#define fiat_addc		fiat_fp_addcarryx_u64
+/** Subtracts two digits and a borrow, returning the borrow out. */
+#define fiat_subb		fiat_fp_subborrowx_u64
+/** Multiplies two digits into a double-precision digit. */
+#define fiat_mulx		fiat_fp_mulx_u64
+/** Selects one of two digits in constant time. */
+#define fiat_cmov		fiat_fp_cmovznz_u64
+#elif WSIZE == 32
+#define fiat_addc		fiat_fp_addcarryx_u32
+#define fiat_subb		fiat_fp_subborrowx_u32
+#define fiat_mulx		fiat_fp_mulx_u32
+#define fiat_cmov		fiat_fp_cmovznz_u32
+#else
+#error "Fiat-Crypto backend only supports 32-bit and 64-bit digits."
+#endif
+
+#endif /* !RLC_FIAT_LOW_H */
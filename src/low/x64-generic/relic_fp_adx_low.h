@@ -0,0 +1,71 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Runtime detection of the MULX/ADCX/ADOX instructions used by the generic
+ * x86-64 backend.
+ *
+ * @ingroup fp
+ */
+
+#ifndef RLC_FP_ADX_LOW_H
+#define RLC_FP_ADX_LOW_H
+
+#include "relic_fp.h"
+
+/**
+ * Flag to indicate that the MULX/ADX kernels can be compiled for the
+ * configured precision, which must span from 4 to 10 digits.
+ */
+#if defined(__x86_64__) && defined(__GNUC__) && WSIZE == 64 && \
+	FP_PRIME > 192 && FP_PRIME <= 640
+#define FP_ADX_LOW
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+/**
+ * Enables the BMI2 and ADX instruction set extensions for a single function.
+ */
+#define RLC_ADX		__attribute__((target("bmi2,adx")))
+
+/**
+ * Checks if the processor supports the BMI2 and ADX extensions.
+ *
+ * @return 1 if the extensions are supported, 0 otherwise.
+ */
+static inline int fp_adx_cpu(void) {
+	unsigned int a, b, c, d;
+
+	if (__get_cpuid_count(7, 0, &a, &b, &c, &d)) {
+		/* BMI2 is bit 8 and ADX is bit 19 of EBX. */
+		return ((b >> 8) & 1) && ((b >> 19) & 1);
+	}
+	return 0;
+}
+
+#endif /* x86-64 */
+
+#endif /* !RLC_FP_ADX_LOW_H */
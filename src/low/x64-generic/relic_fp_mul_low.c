@@ -0,0 +1,198 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level prime field multiplication functions, using
+ * MULX/ADX instructions when supported by the processor.
+ *
+ * @ingroup fp
+ */
+
+#include "relic_fp.h"
+#include "relic_fp_low.h"
+#include "relic_fp_adx_low.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Accumulates a double precision digit in a triple register variable.
+ *
+ * @param[in,out] R2		- most significant word of the triple register.
+ * @param[in,out] R1		- middle word of the triple register.
+ * @param[in,out] R0		- lowest significant word of the triple register.
+ * @param[in] A				- the first digit to multiply.
+ * @param[in] B				- the second digit to multiply.
+ */
+#define COMBA_STEP_FP_MUL_LOW(R2, R1, R0, A, B)								\
+	dbl_t r = (dbl_t)(A) * (dbl_t)(B);										\
+	dig_t _r = (R1);														\
+	(R0) += (dig_t)(r);														\
+	(R1) += (R0) < (dig_t)(r);												\
+	(R2) += (R1) < _r;														\
+	(R1) += (dig_t)((r) >> (dbl_t)RLC_DIG);								\
+	(R2) += (R1) < (dig_t)((r) >> (dbl_t)RLC_DIG);							\
+
+#ifdef FP_ADX_LOW
+
+/**
+ * Flag to indicate if the MULX/ADX kernels are used, or -1 if the processor
+ * was not yet checked.
+ */
+static int adx_flag = -1;
+
+/**
+ * Multiplies two digit vectors of the same size using MULX to compute the
+ * partial products and two independent carry chains to accumulate them.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first digit vector to multiply.
+ * @param[in] b				- the second digit vector to multiply.
+ */
+static RLC_ADX void fp_muln_adx(dig_t *c, const dig_t *a, const dig_t *b) {
+	unsigned long long t[2 * RLC_FP_DIGS] = { 0 }, lo, hi;
+	unsigned char c0, c1;
+
+	for (int i = 0; i < RLC_FP_DIGS; i++) {
+		c0 = c1 = 0;
+		for (int j = 0; j < RLC_FP_DIGS; j++) {
+			lo = _mulx_u64(a[j], b[i], &hi);
+			c0 = _addcarryx_u64(c0, t[i + j], lo, &t[i + j]);
+			c1 = _addcarryx_u64(c1, t[i + j + 1], hi, &t[i + j + 1]);
+		}
+		/* The partial result is smaller than 2^(DIG * (i + DIGS + 1)), so
+		 * the second chain never carries out and the first one fits. */
+		t[i + RLC_FP_DIGS] += c0;
+	}
+	for (int i = 0; i < 2 * RLC_FP_DIGS; i++) {
+		c[i] = t[i];
+	}
+}
+
+#endif
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+int fp_adx_low(void) {
+#ifdef FP_ADX_LOW
+	if (adx_flag < 0) {
+		adx_flag = fp_adx_cpu();
+	}
+	return adx_flag;
+#else
+	return 0;
+#endif
+}
+
+void fp_adx_low_set(int on) {
+#ifdef FP_ADX_LOW
+	adx_flag = (on && fp_adx_cpu());
+#else
+	(void)on;
+#endif
+}
+
+dig_t fp_mula_low(dig_t *c, const dig_t *a, dig_t digit) {
+	int i;
+	dig_t carry;
+	dbl_t r;
+
+	carry = 0;
+	for (i = 0; i < RLC_FP_DIGS; i++, a++, c++) {
+		/* Multiply the digit *tmpa by b and accumulate with the previous
+		 * result in the same columns and the propagated carry. */
+		r = (dbl_t)(*c) + (dbl_t)(*a) * (dbl_t)(digit) + (dbl_t)(carry);
+		/* Increment the column and assign the result. */
+		*c = (dig_t)r;
+		/* Update the carry. */
+		carry = (dig_t)(r >> (dbl_t)RLC_DIG);
+	}
+	return carry;
+}
+
+dig_t fp_mul1_low(dig_t *c, const dig_t *a, dig_t digit) {
+	int i;
+	dig_t carry;
+	dbl_t r;
+
+	carry = 0;
+	for (i = 0; i < RLC_FP_DIGS; i++, a++, c++) {
+		/* Multiply the digit *tmpa by b and accumulate with the previous
+		 * result in the same columns and the propagated carry. */
+		r = (dbl_t)(*a) * (dbl_t)(digit) + (dbl_t)(carry);
+		/* Increment the column and assign the result. */
+		*c = (dig_t)r;
+		/* Update the carry. */
+		carry = (dig_t)(r >> (dbl_t)RLC_DIG);
+	}
+	return carry;
+}
+
+void fp_muln_low(dig_t *c, const dig_t *a, const dig_t *b) {
+	int i, j;
+	const dig_t *tmpa, *tmpb;
+	dig_t r0, r1, r2;
+
+#ifdef FP_ADX_LOW
+	if (fp_adx_low()) {
+		fp_muln_adx(c, a, b);
+		return;
+	}
+#endif
+
+	r0 = r1 = r2 = 0;
+	for (i = 0; i < RLC_FP_DIGS; i++, c++) {
+		tmpa = a;
+		tmpb = b + i;
+		for (j = 0; j <= i; j++, tmpa++, tmpb--) {
+			COMBA_STEP_FP_MUL_LOW(r2, r1, r0, *tmpa, *tmpb);
+		}
+		*c = r0;
+		r0 = r1;
+		r1 = r2;
+		r2 = 0;
+	}
+	for (i = 0; i < RLC_FP_DIGS; i++, c++) {
+		tmpa = a + i + 1;
+		tmpb = b + (RLC_FP_DIGS - 1);
+		for (j = 0; j < RLC_FP_DIGS - (i + 1); j++, tmpa++, tmpb--) {
+			COMBA_STEP_FP_MUL_LOW(r2, r1, r0, *tmpa, *tmpb);
+		}
+		*c = r0;
+		r0 = r1;
+		r1 = r2;
+		r2 = 0;
+	}
+}
+
+void fp_mulm_low(dig_t *c, const dig_t *a, const dig_t *b) {
+	rlc_align dig_t t[2 * RLC_FP_DIGS];
+
+	fp_muln_low(t, a, b);
+	fp_rdc(c, t);
+}
@@ -0,0 +1,246 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level prime field modular reduction functions,
+ * using MULX/ADX instructions when supported by the processor.
+ *
+ * @ingroup fp
+ */
+
+#include "relic_core.h"
+#include "relic_fp.h"
+#include "relic_fp_low.h"
+#include "relic_bn_low.h"
+#include "relic_fp_adx_low.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Accumulates a double precision digit in a triple register variable.
+ *
+ * @param[in,out] R2		- most significant word of the triple register.
+ * @param[in,out] R1		- middle word of the triple register.
+ * @param[in,out] R0		- lowest significant word of the triple register.
+ * @param[in] A				- the first digit to multiply.
+ * @param[in] B				- the second digit to multiply.
+ */
+#define COMBA_STEP_FP_RDC_LOW(R2, R1, R0, A, B)								\
+	dbl_t r = (dbl_t)(A) * (dbl_t)(B);										\
+	dig_t _r = (R1);														\
+	(R0) += (dig_t)(r);														\
+	(R1) += (R0) < (dig_t)(r);												\
+	(R2) += (R1) < _r;														\
+	(R1) += (dig_t)(r >> (dbl_t)RLC_DIG);									\
+	(R2) += (R1) < (dig_t)(r >> (dbl_t)RLC_DIG);							\
+
+/**
+ * Accumulates a single precision digit in a triple register variable.
+ *
+ * @param[in,out] R2		- most significant word of the triple register.
+ * @param[in,out] R1		- middle word of the triple register.
+ * @param[in,out] R0		- lowest significant word of the triple register.
+ * @param[in] A				- the first digit to accumulate.
+ */
+#define COMBA_ADD(R2, R1, R0, A)											\
+	dig_t __r = (R1);														\
+	(R0) += (A);															\
+	(R1) += (R0) < (A);														\
+	(R2) += (R1) < __r;														\
+
+#ifdef FP_ADX_LOW
+
+/**
+ * Computes the Montgomery reduction of a double-precision digit vector using
+ * MULX and two independent carry chains for each digit of the quotient.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the digit vector to reduce.
+ */
+static RLC_ADX void fp_rdcn_adx(dig_t *c, const dig_t *a) {
+	unsigned long long t[2 * RLC_FP_DIGS + 1], lo, hi, u;
+	unsigned char c0, c1;
+	const dig_t *m = fp_prime_get();
+	dig_t mu = *(fp_prime_get_rdc());
+
+	for (int i = 0; i < 2 * RLC_FP_DIGS; i++) {
+		t[i] = a[i];
+	}
+	t[2 * RLC_FP_DIGS] = 0;
+
+	for (int i = 0; i < RLC_FP_DIGS; i++) {
+		u = t[i] * mu;
+		c0 = c1 = 0;
+		for (int j = 0; j < RLC_FP_DIGS; j++) {
+			lo = _mulx_u64(m[j], u, &hi);
+			c0 = _addcarryx_u64(c0, t[i + j], lo, &t[i + j]);
+			c1 = _addcarryx_u64(c1, t[i + j + 1], hi, &t[i + j + 1]);
+		}
+		/* Merge both carries and propagate them to the top digit. */
+		c0 = _addcarry_u64(c0, t[i + RLC_FP_DIGS], 0, &t[i + RLC_FP_DIGS]);
+		for (int j = i + RLC_FP_DIGS + 1; j <= 2 * RLC_FP_DIGS; j++) {
+			c0 = _addcarry_u64(c0, t[j], c1, &t[j]);
+			c1 = 0;
+		}
+	}
+
+	for (int i = 0; i < RLC_FP_DIGS; i++) {
+		c[i] = t[i + RLC_FP_DIGS];
+	}
+	if (t[2 * RLC_FP_DIGS] || dv_cmp(c, m, RLC_FP_DIGS) != RLC_LT) {
+		fp_subn_low(c, c, m);
+	}
+}
+
+#endif
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void fp_rdcs_low(dig_t *c, const dig_t *a, const dig_t *m) {
+	rlc_align dig_t q[2 * RLC_FP_DIGS], _q[2 * RLC_FP_DIGS], t[2 * RLC_FP_DIGS], r[RLC_FP_DIGS];
+	const int *sform;
+	int len, first, i, j, k, b0, d0, b1, d1;
+
+	sform = fp_prime_get_sps(&len);
+
+	RLC_RIP(b0, d0, sform[len - 1]);
+	first = (d0) + (b0 == 0 ? 0 : 1);
+
+	/* q = floor(a/b^k) */
+	dv_zero(q, 2 * RLC_FP_DIGS);
+	bn_rshd_low(q, a, 2 * RLC_FP_DIGS, d0);
+	if (b0 > 0) {
+		bn_rshb_low(q, q, 2 * RLC_FP_DIGS, b0);
+	}
+
+	/* r = a - qb^k. */
+	dv_copy(r, a, first);
+	if (b0 > 0) {
+		r[first - 1] &= RLC_MASK(b0);
+	}
+
+	k = 0;
+	while (!fp_is_zero(q)) {
+		dv_zero(_q, 2 * RLC_FP_DIGS);
+		for (i = len - 2; i > 0; i--) {
+			j = (sform[i] < 0 ? -sform[i] : sform[i]);
+			RLC_RIP(b1, d1, j);
+			dv_zero(t, 2 * RLC_FP_DIGS);
+			bn_lshd_low(t, q, RLC_FP_DIGS, d1);
+			if (b1 > 0) {
+				bn_lshb_low(t, t, 2 * RLC_FP_DIGS, b1);
+			}
+			/* Check if these two have the same sign. */
+			if ((sform[len - 2] < 0) == (sform[i] < 0)) {
+				bn_addn_low(_q, _q, t, 2 * RLC_FP_DIGS);
+			} else {
+				bn_subn_low(_q, _q, t, 2 * RLC_FP_DIGS);
+			}
+		}
+		/* Check if these two have the same sign. */
+		if ((sform[len - 2] < 0) == (sform[0] < 0)) {
+			bn_addn_low(_q, _q, q, 2 * RLC_FP_DIGS);
+		} else {
+			bn_subn_low(_q, _q, q, 2 * RLC_FP_DIGS);
+		}
+		bn_rshd_low(q, _q, 2 * RLC_FP_DIGS, d0);
+		if (b0 > 0) {
+			bn_rshb_low(q, q, 2 * RLC_FP_DIGS, b0);
+		}
+		if (b0 > 0) {
+			_q[first - 1] &= RLC_MASK(b0);
+		}
+		if (sform[len - 2] < 0) {
+			fp_add(r, r, _q);
+		} else {
+			if (k++ % 2 == 0) {
+				if (fp_subn_low(r, r, _q)) {
+					fp_addn_low(r, r, m);
+				}
+			} else {
+				fp_addn_low(r, r, _q);
+			}
+		}
+	}
+	while (dv_cmp(r, m, RLC_FP_DIGS) != RLC_LT) {
+		fp_subn_low(r, r, m);
+	}
+	fp_copy(c, r);
+}
+
+void fp_rdcn_low(dig_t *c, dig_t *a) {
+	int i, j;
+	dig_t r0, r1, r2, u, *tmp, *tmpc;
+	const dig_t *m, *tmpm;
+
+#ifdef FP_ADX_LOW
+	if (fp_adx_low()) {
+		fp_rdcn_adx(c, a);
+		return;
+	}
+#endif
+
+	u = *(fp_prime_get_rdc());
+	m = fp_prime_get();
+	tmpc = c;
+
+	r0 = r1 = r2 = 0;
+	for (i = 0; i < RLC_FP_DIGS; i++, tmpc++, a++) {
+		tmp = c;
+		tmpm = m + i;
+		for (j = 0; j < i; j++, tmp++, tmpm--) {
+			COMBA_STEP_FP_RDC_LOW(r2, r1, r0, *tmp, *tmpm);
+		}
+		COMBA_ADD(r2, r1, r0, *a);
+		*tmpc = (dig_t)(r0 * u);
+		COMBA_STEP_FP_RDC_LOW(r2, r1, r0, *tmpc, *m);
+		r0 = r1;
+		r1 = r2;
+		r2 = 0;
+	}
+
+	for (i = RLC_FP_DIGS; i < 2 * RLC_FP_DIGS - 1; i++, a++) {
+		tmp = c + (i - RLC_FP_DIGS + 1);
+		tmpm = m + RLC_FP_DIGS - 1;
+		for (j = i - RLC_FP_DIGS + 1; j < RLC_FP_DIGS; j++, tmp++, tmpm--) {
+			COMBA_STEP_FP_RDC_LOW(r2, r1, r0, *tmp, *tmpm);
+		}
+		COMBA_ADD(r2, r1, r0, *a);
+		c[i - RLC_FP_DIGS] = r0;
+		r0 = r1;
+		r1 = r2;
+		r2 = 0;
+	}
+	COMBA_ADD(r2, r1, r0, *a);
+	c[RLC_FP_DIGS - 1] = r0;
+
+	if (r1 || dv_cmp(c, m, RLC_FP_DIGS) != RLC_LT) {
+		fp_subn_low(c, c, m);
+	}
+}
@@ -0,0 +1,177 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of low-level prime field squaring functions, using MULX/ADX
+ * instructions when supported by the processor.
+ *
+ * @ingroup fp
+ */
+
+#include "relic_fp.h"
+#include "relic_fp_low.h"
+#include "relic_fp_adx_low.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Computes the step of a Comba squaring.
+ *
+ * @param[in,out] R2		- most significant word of the triple register.
+ * @param[in,out] R1		- middle word of the triple register.
+ * @param[in,out] R0		- lowest significant word of the triple register.
+ * @param[in] A				- the first digit to multiply.
+ * @param[in] B				- the second digit to multiply.
+ */
+#define COMBA_STEP_FP_SQR_LOW(R2, R1, R0, A, B)								\
+	dbl_t r = (dbl_t)(A) * (dbl_t)(B);										\
+	dbl_t s = r + r;														\
+	dig_t _r = (R1);														\
+	(R0) += (dig_t)s;														\
+	(R1) += (R0) < (dig_t)s;												\
+	(R2) += (R1) < _r;														\
+	(R1) += (dig_t)(s >> (dbl_t)RLC_DIG);									\
+	(R2) += (R1) < (dig_t)(s >> (dbl_t)RLC_DIG);							\
+	(R2) += (s < r);														\
+
+/**
+ * Computes the step of a Comba squaring when the loop length is odd.
+ *
+ * @param[in,out] R2		- most significant word of the triple register.
+ * @param[in,out] R1		- middle word of the triple register.
+ * @param[in,out] R0		- lowest significant word of the triple register.
+ * @param[in] A				- the first digit to multiply.
+ */
+#define COMBA_FINAL(R2, R1, R0, A)											\
+	dbl_t r = (dbl_t)(*tmpa) * (dbl_t)(*tmpa);								\
+	dig_t _r = (R1);														\
+	(R0) += (dig_t)(r);														\
+	(R1) += (R0) < (dig_t)r;												\
+	(R2) += (R1) < _r;														\
+	(R1) += (dig_t)(r >> (dbl_t)RLC_DIG);									\
+	(R2) += (R1) < (dig_t)(r >> (dbl_t)RLC_DIG);							\
+
+#ifdef FP_ADX_LOW
+
+/**
+ * Squares a digit vector using MULX, computing each cross product once and
+ * doubling their sum before adding the squares of the digits.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the digit vector to square.
+ */
+static RLC_ADX void fp_sqrn_adx(dig_t *c, const dig_t *a) {
+	unsigned long long t[2 * RLC_FP_DIGS] = { 0 }, lo, hi;
+	unsigned char c0, c1;
+
+	for (int i = 0; i < RLC_FP_DIGS - 1; i++) {
+		c0 = c1 = 0;
+		for (int j = i + 1; j < RLC_FP_DIGS; j++) {
+			lo = _mulx_u64(a[j], a[i], &hi);
+			c0 = _addcarryx_u64(c0, t[i + j], lo, &t[i + j]);
+			c1 = _addcarryx_u64(c1, t[i + j + 1], hi, &t[i + j + 1]);
+		}
+		t[i + RLC_FP_DIGS] += c0;
+	}
+	/* The sum of cross products is smaller than 2^(2 * DIG * DIGS - 1). */
+	for (int i = 2 * RLC_FP_DIGS - 1; i > 0; i--) {
+		t[i] = (t[i] << 1) | (t[i - 1] >> (RLC_DIG - 1));
+	}
+	t[0] <<= 1;
+	c0 = 0;
+	for (int i = 0; i < RLC_FP_DIGS; i++) {
+		lo = _mulx_u64(a[i], a[i], &hi);
+		c0 = _addcarryx_u64(c0, t[2 * i], lo, &t[2 * i]);
+		c0 = _addcarryx_u64(c0, t[2 * i + 1], hi, &t[2 * i + 1]);
+	}
+	for (int i = 0; i < 2 * RLC_FP_DIGS; i++) {
+		c[i] = t[i];
+	}
+}
+
+#endif
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void fp_sqrn_low(dig_t *c, const dig_t *a) {
+	int i, j;
+	const dig_t *tmpa, *tmpb;
+	dig_t r0, r1, r2;
+
+#ifdef FP_ADX_LOW
+	if (fp_adx_low()) {
+		fp_sqrn_adx(c, a);
+		return;
+	}
+#endif
+
+	/* Zero the accumulator. */
+	r0 = r1 = r2 = 0;
+
+	/* Comba squaring produces one column of the result per iteration. */
+	for (i = 0; i < RLC_FP_DIGS; i++, c++) {
+		tmpa = a;
+		tmpb = a + i;
+
+		/* Compute the number of additions in this column. */
+		for (j = 0; j < (i + 1) / 2; j++, tmpa++, tmpb--) {
+			COMBA_STEP_FP_SQR_LOW(r2, r1, r0, *tmpa, *tmpb);
+		}
+		if (!(i & 0x01)) {
+			COMBA_FINAL(r2, r1, r0, *tmpa);
+		}
+		*c = r0;
+		r0 = r1;
+		r1 = r2;
+		r2 = 0;
+	}
+	for (i = 0; i < RLC_FP_DIGS; i++, c++) {
+		tmpa = a + (i + 1);
+		tmpb = a + (RLC_FP_DIGS - 1);
+
+		/* Compute the number of additions in this column. */
+		for (j = 0; j < (RLC_FP_DIGS - 1 - i) / 2; j++, tmpa++, tmpb--) {
+			COMBA_STEP_FP_SQR_LOW(r2, r1, r0, *tmpa, *tmpb);
+		}
+		if (!((RLC_FP_DIGS - i) & 0x01)) {
+			COMBA_FINAL(r2, r1, r0, *tmpa);
+		}
+		*c = r0;
+		r0 = r1;
+		r1 = r2;
+		r2 = 0;
+	}
+}
+
+void fp_sqrm_low(dig_t *c, const dig_t *a) {
+	rlc_align dig_t t[2 * RLC_FP_DIGS];
+
+	fp_sqrn_low(t, a);
+	fp_rdc(c, t);
+}
@@ -60,8 +60,9 @@ extern "C" {
     uint8_t  salt[BLAKE2S_SALTBYTES]; // 24
     uint8_t  personal[BLAKE2S_PERSONALBYTES];  // 32
   } blake2s_param;
+#pragma pack(pop)
 
-  ALIGNME( 64 ) typedef struct __blake2s_state
+  typedef struct ALIGNME( 64 ) __blake2s_state
   {
     uint32_t h[8];
     uint32_t t[2];
@@ -71,6 +72,7 @@ extern "C" {
     uint8_t  last_node;
   } blake2s_state ;
 
+#pragma pack(push, 1)
   typedef struct __blake2b_param
   {
     uint8_t  digest_length; // 1
@@ -85,8 +87,9 @@ extern "C" {
     uint8_t  salt[BLAKE2B_SALTBYTES]; // 48
     uint8_t  personal[BLAKE2B_PERSONALBYTES];  // 64
   } blake2b_param;
+#pragma pack(pop)
 
-  ALIGNME( 64 ) typedef struct __blake2b_state
+  typedef struct ALIGNME( 64 ) __blake2b_state
   {
     uint64_t h[8];
     uint64_t t[2];
@@ -111,7 +114,6 @@ extern "C" {
     uint8_t buf[4 * BLAKE2B_BLOCKBYTES];
     size_t  buflen;
   } blake2bp_state;
-#pragma pack(pop)
 
   // Streaming API
   int blake2s_init( blake2s_state *S, const uint8_t outlen );
@@ -0,0 +1,953 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of bounded discrete logarithms in pairing groups.
+ *
+ * @ingroup pc
+ */
+
+#include <string.h>
+
+#include "relic_pc.h"
+#include "relic_core.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Size of the largest encoding used to compute fingerprints.
+ */
+#define DLOG_BYTES		(12 * RLC_FP_BYTES + 1)
+
+/**
+ * Number of baby steps normalized simultaneously.
+ */
+#define DLOG_BATCH		64
+
+/**
+ * Initial number of baby steps when no table is given.
+ */
+#define DLOG_START		16
+
+/**
+ * Largest number of baby steps supported by a table, chosen so that the
+ * serialized table size fits in an int.
+ */
+#define DLOG_MAX		(1 << 27)
+
+/**
+ * Computes the fingerprint of a normalized G_1 element from its compressed
+ * encoding.
+ *
+ * @param[in] p				- the element.
+ * @return the fingerprint.
+ */
+static uint64_t g1_key(g1_t p) {
+	uint8_t bin[DLOG_BYTES];
+	int len = g1_size_bin(p, 1);
+
+	g1_write_bin(bin, len, p, 1);
+	return util_hash(bin, len);
+}
+
+/**
+ * Computes the fingerprint of a normalized G_2 element from its compressed
+ * encoding.
+ *
+ * @param[in] p				- the element.
+ * @return the fingerprint.
+ */
+static uint64_t g2_key(g2_t p) {
+	uint8_t bin[DLOG_BYTES];
+	int len = g2_size_bin(p, 1);
+
+	g2_write_bin(bin, len, p, 1);
+	return util_hash(bin, len);
+}
+
+/**
+ * Computes the fingerprint of a G_T element from its encoding.
+ *
+ * @param[in] a				- the element.
+ * @return the fingerprint.
+ */
+static uint64_t gt_key(gt_t a) {
+	uint8_t bin[DLOG_BYTES];
+	int len = gt_size_bin(a, 0);
+
+	gt_write_bin(bin, len, a, 0);
+	return util_hash(bin, len);
+}
+
+/**
+ * Inserts a baby step in the hash table.
+ *
+ * @param[out] t			- the table.
+ * @param[in] key			- the fingerprint of the baby step.
+ * @param[in] j				- the baby step.
+ */
+static void dlog_insert(pc_dlog_t t, uint64_t key, int j) {
+	util_hash_put(t->keys, t->vals, t->slots, key, j);
+}
+
+/**
+ * Empties the hash table.
+ *
+ * @param[out] t			- the table.
+ */
+static void dlog_reset(pc_dlog_t t) {
+	memset(t->vals, 0xFF, t->slots * sizeof(int));
+}
+
+/**
+ * Returns the number of giant steps of size m needed to cover the interval
+ * [0, bound).
+ *
+ * @param[in] m				- the number of baby steps.
+ * @param[in] bound			- the bound.
+ * @return the number of giant steps.
+ */
+static dig_t dlog_steps(int m, dig_t bound) {
+	return (bound - 1) / m + 1;
+}
+
+/**
+ * Returns the bound covered by m baby steps and m giant steps, capped at the
+ * given bound.
+ *
+ * @param[in] m				- the number of baby steps.
+ * @param[in] bound			- the bound.
+ * @return the covered bound.
+ */
+static dig_t dlog_cover(int m, dig_t bound) {
+	return ((dig_t)m >= bound / m) ? bound : (dig_t)m * m;
+}
+
+/**
+ * Returns the integer square root of a digit.
+ *
+ * @param[in] a				- the digit.
+ * @return the integer square root.
+ */
+static dig_t dlog_isqrt(dig_t a) {
+	dig_t r = 0, b = (dig_t)1 << (RLC_DIG - 2);
+
+	while (b > a) {
+		b >>= 2;
+	}
+	while (b != 0) {
+		if (a >= r + b) {
+			a -= r + b;
+			r = (r >> 1) + b;
+		} else {
+			r >>= 1;
+		}
+		b >>= 2;
+	}
+	return r;
+}
+
+/**
+ * Returns the number of jumps for the kangaroo method, such that the mean jump
+ * size 2^n / n is close to half the square root of the bound.
+ *
+ * @param[in] r				- the square root of the bound.
+ * @return the number of jumps.
+ */
+static int dlog_jumps(dig_t r) {
+	int n = 1;
+
+	while (n < RLC_DIG - 8 && (((dig_t)1 << n) - 1) / n < (r + 1) / 2) {
+		n++;
+	}
+	return n;
+}
+
+/**
+ * Selects the jump of a kangaroo from the fingerprint of its position.
+ *
+ * @param[in] key			- the fingerprint.
+ * @param[in] a				- the attempt, used to vary the jumps.
+ * @param[in] n				- the number of jumps.
+ * @return the index of the jump.
+ */
+static int dlog_jump(uint64_t key, int a, int n) {
+	return (int)((key ^ (a * 0x9E3779B97F4A7C15ULL)) % n);
+}
+
+/**
+ * Computes a discrete logarithm in G_1 using a filled baby-step table.
+ *
+ * @param[out] k			- the discrete logarithm.
+ * @param[in] h				- the element.
+ * @param[in] g				- the base element.
+ * @param[in] t				- the baby-step table.
+ * @param[in] bound			- the bound on the discrete logarithm.
+ * @return RLC_OK if the logarithm was found, RLC_ERR otherwise.
+ */
+static int g1_dlog_imp(dig_t *k, g1_t h, g1_t g, const pc_dlog_t t,
+		dig_t bound) {
+	int j, s, result = RLC_ERR;
+	dig_t i, c, n = dlog_steps(t->size, bound);
+	uint64_t key;
+	g1_t u, v, w;
+
+	g1_null(u);
+	g1_null(v);
+	g1_null(w);
+
+	TRY {
+		g1_new(u);
+		g1_new(v);
+		g1_new(w);
+
+		/* Giant step is -mG. */
+		g1_mul_dig(w, g, t->size);
+		g1_neg(w, w);
+		g1_norm(w, w);
+		g1_norm(u, h);
+
+		for (i = 0; i < n && result == RLC_ERR; i++) {
+			key = g1_key(u);
+			s = -1;
+			while ((j = util_hash_get(t->keys, t->vals, t->slots, key,
+					&s)) >= 0) {
+				c = i * t->size + j;
+				if (c < bound) {
+					/* Rule out collisions between fingerprints. */
+					g1_mul_dig(v, g, c);
+					if (g1_cmp(v, h) == RLC_EQ) {
+						*k = c;
+						result = RLC_OK;
+						break;
+					}
+				}
+			}
+			g1_add(u, u, w);
+			g1_norm(u, u);
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		g1_free(u);
+		g1_free(v);
+		g1_free(w);
+	}
+	return result;
+}
+
+/**
+ * Computes a discrete logarithm in G_2 using a filled baby-step table.
+ *
+ * @param[out] k			- the discrete logarithm.
+ * @param[in] h				- the element.
+ * @param[in] g				- the base element.
+ * @param[in] t				- the baby-step table.
+ * @param[in] bound			- the bound on the discrete logarithm.
+ * @return RLC_OK if the logarithm was found, RLC_ERR otherwise.
+ */
+static int g2_dlog_imp(dig_t *k, g2_t h, g2_t g, const pc_dlog_t t,
+		dig_t bound) {
+	int j, s, result = RLC_ERR;
+	dig_t i, c, n = dlog_steps(t->size, bound);
+	uint64_t key;
+	g2_t u, v, w;
+
+	g2_null(u);
+	g2_null(v);
+	g2_null(w);
+
+	TRY {
+		g2_new(u);
+		g2_new(v);
+		g2_new(w);
+
+		/* Giant step is -mG. */
+		g2_mul_dig(w, g, t->size);
+		g2_neg(w, w);
+		g2_norm(w, w);
+		g2_norm(u, h);
+
+		for (i = 0; i < n && result == RLC_ERR; i++) {
+			key = g2_key(u);
+			s = -1;
+			while ((j = util_hash_get(t->keys, t->vals, t->slots, key,
+					&s)) >= 0) {
+				c = i * t->size + j;
+				if (c < bound) {
+					/* Rule out collisions between fingerprints. */
+					g2_mul_dig(v, g, c);
+					if (g2_cmp(v, h) == RLC_EQ) {
+						*k = c;
+						result = RLC_OK;
+						break;
+					}
+				}
+			}
+			g2_add(u, u, w);
+			g2_norm(u, u);
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		g2_free(u);
+		g2_free(v);
+		g2_free(w);
+	}
+	return result;
+}
+
+/**
+ * Computes a discrete logarithm in G_T using a filled baby-step table.
+ *
+ * @param[out] k			- the discrete logarithm.
+ * @param[in] h				- the element.
+ * @param[in] g				- the base element.
+ * @param[in] t				- the baby-step table.
+ * @param[in] bound			- the bound on the discrete logarithm.
+ * @return RLC_OK if the logarithm was found, RLC_ERR otherwise.
+ */
+static int gt_dlog_imp(dig_t *k, gt_t h, gt_t g, const pc_dlog_t t,
+		dig_t bound) {
+	int j, s, result = RLC_ERR;
+	dig_t i, c, n = dlog_steps(t->size, bound);
+	uint64_t key;
+	gt_t u, v, w;
+
+	gt_null(u);
+	gt_null(v);
+	gt_null(w);
+
+	TRY {
+		gt_new(u);
+		gt_new(v);
+		gt_new(w);
+
+		/* Giant step is g^(-m). */
+		gt_exp_dig(w, g, t->size);
+		gt_inv(w, w);
+		gt_copy(u, h);
+
+		for (i = 0; i < n && result == RLC_ERR; i++) {
+			key = gt_key(u);
+			s = -1;
+			while ((j = util_hash_get(t->keys, t->vals, t->slots, key,
+					&s)) >= 0) {
+				c = i * t->size + j;
+				if (c < bound) {
+					/* Rule out collisions between fingerprints. */
+					gt_exp_dig(v, g, c);
+					if (gt_cmp(v, h) == RLC_EQ) {
+						*k = c;
+						result = RLC_OK;
+						break;
+					}
+				}
+			}
+			gt_mul(u, u, w);
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		gt_free(u);
+		gt_free(v);
+		gt_free(w);
+	}
+	return result;
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void pc_dlog_make(pc_dlog_t t, int m) {
+	if (m < 2 || m > DLOG_MAX) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+
+	t->size = m;
+	for (t->slots = 2; t->slots < 2 * m; t->slots <<= 1);
+	t->base = 0;
+	t->keys = (uint64_t *)malloc(t->slots * sizeof(uint64_t));
+	t->vals = (int *)malloc(t->slots * sizeof(int));
+	if (t->keys == NULL || t->vals == NULL) {
+		pc_dlog_clean(t);
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+	dlog_reset(t);
+}
+
+void pc_dlog_clean(pc_dlog_t t) {
+	free(t->keys);
+	free(t->vals);
+	t->keys = NULL;
+	t->vals = NULL;
+	t->size = t->slots = 0;
+	t->base = 0;
+}
+
+int pc_dlog_size_bin(const pc_dlog_t t) {
+	return 4 + 8 * t->size;
+}
+
+void pc_dlog_read_bin(pc_dlog_t t, const uint8_t *bin, int len) {
+	int i, j, m;
+	uint64_t key;
+
+	if (len < 4) {
+		THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	m = ((int)bin[0] << 24) | ((int)bin[1] << 16) | ((int)bin[2] << 8) | bin[3];
+	if (m < 2 || m > DLOG_MAX) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+	if (len != 4 + 8 * m) {
+		THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	if (m != t->size) {
+		pc_dlog_clean(t);
+		pc_dlog_make(t, m);
+	}
+	dlog_reset(t);
+
+	for (j = 0; j < m; j++) {
+		key = 0;
+		for (i = 0; i < 8; i++) {
+			key = (key << 8) | bin[4 + 8 * j + i];
+		}
+		dlog_insert(t, key, j);
+		if (j == 1) {
+			t->base = key;
+		}
+	}
+}
+
+void pc_dlog_write_bin(uint8_t *bin, int len, const pc_dlog_t t) {
+	int i, s;
+	uint64_t key;
+
+	if (len != pc_dlog_size_bin(t)) {
+		THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	bin[0] = (uint8_t)(t->size >> 24);
+	bin[1] = (uint8_t)(t->size >> 16);
+	bin[2] = (uint8_t)(t->size >> 8);
+	bin[3] = (uint8_t)t->size;
+
+	/* Store fingerprints in baby-step order, so slots can be rebuilt. */
+	for (s = 0; s < t->slots; s++) {
+		if (t->vals[s] >= 0) {
+			key = t->keys[s];
+			for (i = 7; i >= 0; i--) {
+				bin[4 + 8 * t->vals[s] + i] = (uint8_t)key;
+				key >>= 8;
+			}
+		}
+	}
+}
+
+void g1_dlog_tab(pc_dlog_t t, g1_t g) {
+	int i, j, n;
+	g1_t u, p[DLOG_BATCH];
+
+	g1_null(u);
+
+	TRY {
+		g1_new(u);
+		for (i = 0; i < DLOG_BATCH; i++) {
+			g1_null(p[i]);
+			g1_new(p[i]);
+		}
+
+		dlog_reset(t);
+		g1_set_infty(u);
+		dlog_insert(t, g1_key(u), 0);
+
+		/* Compute baby steps in batches to amortize normalization. */
+		g1_norm(u, g);
+		t->base = g1_key(u);
+		for (j = 1; j < t->size; j += n) {
+			n = RLC_MIN(DLOG_BATCH, t->size - j);
+			for (i = 0; i < n; i++) {
+				g1_copy(p[i], u);
+				g1_add(u, u, g);
+			}
+			g1_norm_sim(p, (const g1_t *)p, n);
+			for (i = 0; i < n; i++) {
+				dlog_insert(t, g1_key(p[i]), j + i);
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		g1_free(u);
+		for (i = 0; i < DLOG_BATCH; i++) {
+			g1_free(p[i]);
+		}
+	}
+}
+
+void g2_dlog_tab(pc_dlog_t t, g2_t g) {
+	int i, j, n;
+	g2_t u, p[DLOG_BATCH];
+
+	g2_null(u);
+
+	TRY {
+		g2_new(u);
+		for (i = 0; i < DLOG_BATCH; i++) {
+			g2_null(p[i]);
+			g2_new(p[i]);
+		}
+
+		dlog_reset(t);
+		g2_set_infty(u);
+		dlog_insert(t, g2_key(u), 0);
+
+		/* Compute baby steps in batches to amortize normalization. */
+		g2_norm(u, g);
+		t->base = g2_key(u);
+		for (j = 1; j < t->size; j += n) {
+			n = RLC_MIN(DLOG_BATCH, t->size - j);
+			for (i = 0; i < n; i++) {
+				g2_copy(p[i], u);
+				g2_add(u, u, g);
+			}
+			g2_norm_sim(p, p, n);
+			for (i = 0; i < n; i++) {
+				dlog_insert(t, g2_key(p[i]), j + i);
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		g2_free(u);
+		for (i = 0; i < DLOG_BATCH; i++) {
+			g2_free(p[i]);
+		}
+	}
+}
+
+void gt_dlog_tab(pc_dlog_t t, gt_t g) {
+	int j;
+	gt_t u;
+
+	gt_null(u);
+
+	TRY {
+		gt_new(u);
+
+		dlog_reset(t);
+		gt_set_unity(u);
+		for (j = 0; j < t->size; j++) {
+			dlog_insert(t, gt_key(u), j);
+			gt_mul(u, u, g);
+		}
+		t->base = gt_key(g);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		gt_free(u);
+	}
+}
+
+int g1_dlog(dig_t *k, g1_t h, g1_t g, const pc_dlog_t t, dig_t bound) {
+	int m, result = RLC_ERR;
+	dig_t b;
+	pc_dlog_t s;
+	g1_t u;
+
+	if (bound == 0) {
+		return RLC_ERR;
+	}
+
+	g1_null(u);
+	pc_dlog_null(s);
+
+	TRY {
+		g1_new(u);
+
+		if (t != NULL) {
+			/* The table must have been computed for the same base. */
+			g1_norm(u, g);
+			if (t->base == g1_key(u)) {
+				result = g1_dlog_imp(k, h, g, t, bound);
+			}
+		} else {
+			/* Double the baby steps until the logarithm is found. */
+			for (m = DLOG_START; m <= DLOG_MAX; m <<= 1) {
+				b = dlog_cover(m, bound);
+				pc_dlog_new(s, RLC_MIN((dig_t)m, RLC_MAX(b, 2)));
+				g1_dlog_tab(s, g);
+				result = g1_dlog_imp(k, h, g, s, b);
+				pc_dlog_free(s);
+				if (result == RLC_OK || b == bound) {
+					break;
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		g1_free(u);
+		pc_dlog_free(s);
+	}
+	return result;
+}
+
+int g2_dlog(dig_t *k, g2_t h, g2_t g, const pc_dlog_t t, dig_t bound) {
+	int m, result = RLC_ERR;
+	dig_t b;
+	pc_dlog_t s;
+	g2_t u;
+
+	if (bound == 0) {
+		return RLC_ERR;
+	}
+
+	g2_null(u);
+	pc_dlog_null(s);
+
+	TRY {
+		g2_new(u);
+
+		if (t != NULL) {
+			/* The table must have been computed for the same base. */
+			g2_norm(u, g);
+			if (t->base == g2_key(u)) {
+				result = g2_dlog_imp(k, h, g, t, bound);
+			}
+		} else {
+			/* Double the baby steps until the logarithm is found. */
+			for (m = DLOG_START; m <= DLOG_MAX; m <<= 1) {
+				b = dlog_cover(m, bound);
+				pc_dlog_new(s, RLC_MIN((dig_t)m, RLC_MAX(b, 2)));
+				g2_dlog_tab(s, g);
+				result = g2_dlog_imp(k, h, g, s, b);
+				pc_dlog_free(s);
+				if (result == RLC_OK || b == bound) {
+					break;
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		g2_free(u);
+		pc_dlog_free(s);
+	}
+	return result;
+}
+
+int gt_dlog(dig_t *k, gt_t h, gt_t g, const pc_dlog_t t, dig_t bound) {
+	int m, result = RLC_ERR;
+	dig_t b;
+	pc_dlog_t s;
+
+	if (bound == 0) {
+		return RLC_ERR;
+	}
+
+	pc_dlog_null(s);
+
+	TRY {
+		if (t != NULL) {
+			/* The table must have been computed for the same base. */
+			if (t->base == gt_key(g)) {
+				result = gt_dlog_imp(k, h, g, t, bound);
+			}
+		} else {
+			/* Double the baby steps until the logarithm is found. */
+			for (m = DLOG_START; m <= DLOG_MAX; m <<= 1) {
+				b = dlog_cover(m, bound);
+				pc_dlog_new(s, RLC_MIN((dig_t)m, RLC_MAX(b, 2)));
+				gt_dlog_tab(s, g);
+				result = gt_dlog_imp(k, h, g, s, b);
+				pc_dlog_free(s);
+				if (result == RLC_OK || b == bound) {
+					break;
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		pc_dlog_free(s);
+	}
+	return result;
+}
+
+int g1_dlog_kgr(dig_t *k, g1_t h, g1_t g, dig_t bound) {
+	int a, i, j, n, result = RLC_ERR;
+	dig_t l, r, dt, dw;
+	uint64_t key, trap;
+	g1_t t, w, p[RLC_DIG];
+
+	if (bound == 0 || (bound >> (RLC_DIG - 8)) != 0) {
+		return RLC_ERR;
+	}
+
+	r = dlog_isqrt(bound) + 1;
+	n = dlog_jumps(r);
+
+	g1_null(t);
+	g1_null(w);
+
+	TRY {
+		g1_new(t);
+		g1_new(w);
+		for (i = 0; i < n; i++) {
+			g1_null(p[i]);
+			g1_new(p[i]);
+		}
+
+		/* Jumps are 2^i * G, for i < n. */
+		g1_norm(p[0], g);
+		for (i = 1; i < n; i++) {
+			g1_dbl(p[i], p[i - 1]);
+			g1_norm(p[i], p[i]);
+		}
+
+		for (a = 0; a < RLC_DLOG_TRIES && result == RLC_ERR; a++) {
+			/* The tame kangaroo starts at bound * G and sets a trap. */
+			g1_mul_dig(t, g, bound);
+			g1_norm(t, t);
+			dt = 0;
+			for (l = 0; l < 2 * r; l++) {
+				j = dlog_jump(g1_key(t), a, n);
+				g1_add(t, t, p[j]);
+				g1_norm(t, t);
+				dt += (dig_t)1 << j;
+			}
+			trap = g1_key(t);
+
+			/* The wild kangaroo starts at H and runs past the trap. */
+			g1_norm(w, h);
+			dw = 0;
+			while (dw <= bound + dt) {
+				key = g1_key(w);
+				if (key == trap && g1_cmp(w, t) == RLC_EQ) {
+					if (dw > dt) {
+						*k = bound + dt - dw;
+						result = RLC_OK;
+					}
+					break;
+				}
+				j = dlog_jump(key, a, n);
+				g1_add(w, w, p[j]);
+				g1_norm(w, w);
+				dw += (dig_t)1 << j;
+			}
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		g1_free(t);
+		g1_free(w);
+		for (i = 0; i < n; i++) {
+			g1_free(p[i]);
+		}
+	}
+	return result;
+}
+
+int g2_dlog_kgr(dig_t *k, g2_t h, g2_t g, dig_t bound) {
+	int a, i, j, n, result = RLC_ERR;
+	dig_t l, r, dt, dw;
+	uint64_t key, trap;
+	g2_t t, w, p[RLC_DIG];
+
+	if (bound == 0 || (bound >> (RLC_DIG - 8)) != 0) {
+		return RLC_ERR;
+	}
+
+	r = dlog_isqrt(bound) + 1;
+	n = dlog_jumps(r);
+
+	g2_null(t);
+	g2_null(w);
+
+	TRY {
+		g2_new(t);
+		g2_new(w);
+		for (i = 0; i < n; i++) {
+			g2_null(p[i]);
+			g2_new(p[i]);
+		}
+
+		/* Jumps are 2^i * G, for i < n. */
+		g2_norm(p[0], g);
+		for (i = 1; i < n; i++) {
+			g2_dbl(p[i], p[i - 1]);
+			g2_norm(p[i], p[i]);
+		}
+
+		for (a = 0; a < RLC_DLOG_TRIES && result == RLC_ERR; a++) {
+			/* The tame kangaroo starts at bound * G and sets a trap. */
+			g2_mul_dig(t, g, bound);
+			g2_norm(t, t);
+			dt = 0;
+			for (l = 0; l < 2 * r; l++) {
+				j = dlog_jump(g2_key(t), a, n);
+				g2_add(t, t, p[j]);
+				g2_norm(t, t);
+				dt += (dig_t)1 << j;
+			}
+			trap = g2_key(t);
+
+			/* The wild kangaroo starts at H and runs past the trap. */
+			g2_norm(w, h);
+			dw = 0;
+			while (dw <= bound + dt) {
+				key = g2_key(w);
+				if (key == trap && g2_cmp(w, t) == RLC_EQ) {
+					if (dw > dt) {
+						*k = bound + dt - dw;
+						result = RLC_OK;
+					}
+					break;
+				}
+				j = dlog_jump(key, a, n);
+				g2_add(w, w, p[j]);
+				g2_norm(w, w);
+				dw += (dig_t)1 << j;
+			}
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		g2_free(t);
+		g2_free(w);
+		for (i = 0; i < n; i++) {
+			g2_free(p[i]);
+		}
+	}
+	return result;
+}
+
+int gt_dlog_kgr(dig_t *k, gt_t h, gt_t g, dig_t bound) {
+	int a, i, j, n, result = RLC_ERR;
+	dig_t l, r, dt, dw;
+	uint64_t key, trap;
+	gt_t t, w, p[RLC_DIG];
+
+	if (bound == 0 || (bound >> (RLC_DIG - 8)) != 0) {
+		return RLC_ERR;
+	}
+
+	r = dlog_isqrt(bound) + 1;
+	n = dlog_jumps(r);
+
+	gt_null(t);
+	gt_null(w);
+
+	TRY {
+		gt_new(t);
+		gt_new(w);
+		for (i = 0; i < n; i++) {
+			gt_null(p[i]);
+			gt_new(p[i]);
+		}
+
+		/* Jumps are g^(2^i), for i < n. */
+		gt_copy(p[0], g);
+		for (i = 1; i < n; i++) {
+			gt_sqr(p[i], p[i - 1]);
+		}
+
+		for (a = 0; a < RLC_DLOG_TRIES && result == RLC_ERR; a++) {
+			/* The tame kangaroo starts at g^bound and sets a trap. */
+			gt_exp_dig(t, g, bound);
+			dt = 0;
+			for (l = 0; l < 2 * r; l++) {
+				j = dlog_jump(gt_key(t), a, n);
+				gt_mul(t, t, p[j]);
+				dt += (dig_t)1 << j;
+			}
+			trap = gt_key(t);
+
+			/* The wild kangaroo starts at h and runs past the trap. */
+			gt_copy(w, h);
+			dw = 0;
+			while (dw <= bound + dt) {
+				key = gt_key(w);
+				if (key == trap && gt_cmp(w, t) == RLC_EQ) {
+					if (dw > dt) {
+						*k = bound + dt - dw;
+						result = RLC_OK;
+					}
+					break;
+				}
+				j = dlog_jump(key, a, n);
+				gt_mul(w, w, p[j]);
+				dw += (dig_t)1 << j;
+			}
+		}
+	}
+	CATCH_ANY {
+		result = RLC_ERR;
+	}
+	FINALLY {
+		gt_free(t);
+		gt_free(w);
+		for (i = 0; i < n; i++) {
+			gt_free(p[i]);
+		}
+	}
+	return result;
+}
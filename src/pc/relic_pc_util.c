@@ -56,6 +56,28 @@ void gt_rand(gt_t a) {
 #endif
 }
 
+void gt_read_bin_sim(gt_t *a, const uint8_t *bin, int len, int n) {
+	int i;
+
+#if FP_PRIME < 1536
+	if (len == 4 * RLC_FP_BYTES) {
+		for (i = 0; i < n; i++) {
+			fp12_zero(a[i]);
+			fp2_read_bin(a[i][0][1], bin + i * len, 2 * RLC_FP_BYTES);
+			fp2_read_bin(a[i][0][2], bin + i * len + 2 * RLC_FP_BYTES,
+					2 * RLC_FP_BYTES);
+		}
+		if (!fp12_upk_max_sim(a, a, n)) {
+			THROW(ERR_NO_VALID);
+		}
+		return;
+	}
+#endif
+	for (i = 0; i < n; i++) {
+		gt_read_bin(a[i], bin + i * len, len);
+	}
+}
+
 void gt_get_gen(gt_t g) {
 	g1_t g1;
 	g2_t g2;
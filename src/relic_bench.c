@@ -29,12 +29,24 @@
  * @ingroup relic
  */
 
+/* Needed for syscall() when building with -std=c99. */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "relic_core.h"
 #include "relic_conf.h"
 
+#if defined(PERFC) && OPSYS == LINUX
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
 #if OPSYS == DUINO && TIMER == HREAL
 /*
  * Prototype for Arduino timing function.
@@ -107,10 +119,333 @@ typedef unsigned long long bench_t;
 
 #endif
 
+#ifdef COUNT
+
+/**
+ * Symbols of the counted field operations, following the usual notation for
+ * cost accounting.
+ */
+static const char *cnt_names[RLC_CNT_MAX] = {
+	"A", "M", "S", "I", "R", "M2", "S2", "I2", "M12", "S12", "C12", "D12",
+	"I12"
+};
+
+/**
+ * Returns the number of executions of a field operation per benchmark.
+ *
+ * @param op			- the operation.
+ * @return the number of executions.
+ */
+static double cnt_per_op(int op) {
+	ctx_t *ctx = core_get();
+	return (ctx->benches > 0 ? (double)ctx->cnt_total[op] / ctx->benches : 0);
+}
+
+#endif /* COUNT */
+
+#ifdef PERFC
+
+/**
+ * Names of the hardware events in the machine-readable output.
+ */
+static const char *perf_names[RLC_BENCH_EVENTS] = {
+	"cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses"
+};
+
+/**
+ * Opens a hardware performance counter for the calling thread.
+ *
+ * @param event			- the event to count.
+ * @param group			- the leader of the event group, or -1 for a new group.
+ * @return the file descriptor of the counter, or -1 if it is not available.
+ */
+static int perf_open(int event, int group) {
+#if OPSYS == LINUX
+	struct perf_event_attr attr;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = PERF_TYPE_HARDWARE;
+	/* Report how long the counter was scheduled to detect multiplexing. */
+	attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED |
+			PERF_FORMAT_TOTAL_TIME_RUNNING;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	switch (event) {
+		case RLC_BENCH_CYCLES:
+			attr.config = PERF_COUNT_HW_CPU_CYCLES;
+			break;
+		case RLC_BENCH_INSTRS:
+			attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+			break;
+		case RLC_BENCH_L1D:
+			attr.type = PERF_TYPE_HW_CACHE;
+			attr.config = PERF_COUNT_HW_CACHE_L1D |
+					(PERF_COUNT_HW_CACHE_OP_READ << 8) |
+					(PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+			break;
+		case RLC_BENCH_LLC:
+			attr.type = PERF_TYPE_HW_CACHE;
+			attr.config = PERF_COUNT_HW_CACHE_LL |
+					(PERF_COUNT_HW_CACHE_OP_READ << 8) |
+					(PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+			break;
+		case RLC_BENCH_BRANCH:
+			attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+			break;
+	}
+	/* Count the calling thread on any processor. */
+	return (int)syscall(__NR_perf_event_open, &attr, 0, -1, group, 0);
+#else
+	(void)event;
+	(void)group;
+	return -1;
+#endif
+}
+
+/**
+ * Reads the hardware performance counters of the calling thread, together with
+ * the time each counter was enabled and running.
+ *
+ * @param cnt			- the counter values and times.
+ */
+static void perf_read(ull_t cnt[RLC_BENCH_EVENTS][3]) {
+	ctx_t *ctx = core_get();
+
+	for (int i = 0; i < RLC_BENCH_EVENTS; i++) {
+		memset(cnt[i], 0, 3 * sizeof(ull_t));
+#if OPSYS == LINUX
+		if (ctx->perf_fd[i] >= 0 && read(ctx->perf_fd[i], cnt[i],
+				3 * sizeof(ull_t)) != 3 * sizeof(ull_t)) {
+			memset(cnt[i], 0, 3 * sizeof(ull_t));
+		}
+#endif
+	}
+	(void)ctx;
+}
+
+#endif /* PERFC */
+
+/**
+ * Compares two timing samples for sorting.
+ *
+ * @param a				- the first sample.
+ * @param b				- the second sample.
+ * @return a negative, zero or positive value if a < b, a = b or a > b.
+ */
+static int cmp_sample(const void *a, const void *b) {
+	long long x = *(const long long *)a, y = *(const long long *)b;
+	return (x > y) - (x < y);
+}
+
+/**
+ * Computes the integer square root of a non-negative value.
+ *
+ * @param a				- the value.
+ * @return the largest integer whose square does not exceed a.
+ */
+static long long isqrt(unsigned long long a) {
+	unsigned long long r = 0, b = 1ULL << 62;
+
+	while (b > a) {
+		b >>= 2;
+	}
+	while (b != 0) {
+		if (a >= r + b) {
+			a -= r + b;
+			r = (r >> 1) + b;
+		} else {
+			r >>= 1;
+		}
+		b >>= 2;
+	}
+	return r;
+}
+
+/**
+ * Returns the unit of the timings produced by the configured timer.
+ *
+ * @return the unit name.
+ */
+static const char *unit(void) {
+#if TIMER == POSIX || TIMER == ANSI || (OPSYS == DUINO && TIMER == HREAL)
+	return "microsec";
+#elif TIMER == CYCLE
+	return "cycles";
+#else
+	return "nanosec";
+#endif
+}
+
+/**
+ * Writes the last benchmark to the machine-readable output.
+ */
+static void write_output(void) {
+	ctx_t *ctx = core_get();
+	FILE *f = (FILE *)ctx->output;
+	const char *c;
+
+	if (f == NULL || ctx->label == NULL) {
+		return;
+	}
+
+	if (ctx->format == RLC_BENCH_JSON) {
+		fputs("{\"label\": \"", f);
+		for (c = ctx->label; *c != '\0'; c++) {
+			if (*c == '"' || *c == '\\') {
+				fputc('\\', f);
+			}
+			fputc(*c, f);
+		}
+		fprintf(f, "\", \"unit\": \"%s\", \"mean\": %lld, \"min\": %lld, "
+				"\"median\": %lld, \"p90\": %lld, \"p99\": %lld, "
+				"\"stddev\": %lld, \"samples\": %d", unit(), ctx->total,
+				ctx->stats[RLC_BENCH_MIN], ctx->stats[RLC_BENCH_MED],
+				ctx->stats[RLC_BENCH_P90], ctx->stats[RLC_BENCH_P99],
+				ctx->stats[RLC_BENCH_DEV], ctx->sampled);
+#ifdef COUNT
+		fputs(", \"counts\": {", f);
+		for (int i = 0; i < RLC_CNT_MAX; i++) {
+			fprintf(f, "%s\"%s\": %.4g", (i > 0 ? ", " : ""), cnt_names[i],
+					cnt_per_op(i));
+		}
+		fputc('}', f);
+#endif
+#ifdef PERFC
+		for (int i = 0; i < RLC_BENCH_EVENTS; i++) {
+			if (bench_event(i) < 0) {
+				fprintf(f, ", \"%s\": null", perf_names[i]);
+			} else {
+				fprintf(f, ", \"%s\": %.4g", perf_names[i], bench_event(i));
+			}
+		}
+		if (bench_running() < 0) {
+			fputs(", \"running\": null", f);
+		} else {
+			fprintf(f, ", \"running\": %.4g", bench_running());
+		}
+#endif
+		fputs("}\n", f);
+	} else {
+		fputc('"', f);
+		for (c = ctx->label; *c != '\0'; c++) {
+			if (*c == '"') {
+				fputc('"', f);
+			}
+			fputc(*c, f);
+		}
+		fprintf(f, "\",%s,%lld,%lld,%lld,%lld,%lld,%lld,%d", unit(),
+				ctx->total, ctx->stats[RLC_BENCH_MIN],
+				ctx->stats[RLC_BENCH_MED], ctx->stats[RLC_BENCH_P90],
+				ctx->stats[RLC_BENCH_P99], ctx->stats[RLC_BENCH_DEV],
+				ctx->sampled);
+#ifdef COUNT
+		for (int i = 0; i < RLC_CNT_MAX; i++) {
+			fprintf(f, ",%.4g", cnt_per_op(i));
+		}
+#endif
+#ifdef PERFC
+		for (int i = 0; i < RLC_BENCH_EVENTS; i++) {
+			if (bench_event(i) < 0) {
+				fputc(',', f);
+			} else {
+				fprintf(f, ",%.4g", bench_event(i));
+			}
+		}
+		if (bench_running() < 0) {
+			fputc(',', f);
+		} else {
+			fprintf(f, ",%.4g", bench_running());
+		}
+#endif
+		fputc('\n', f);
+	}
+	fflush(f);
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
+void bench_init(void) {
+	ctx_t *ctx = core_get();
+	const char *path;
+
+	ctx->label = NULL;
+	ctx->sampled = 0;
+	ctx->benches = 0;
+	ctx->format = RLC_BENCH_TXT;
+	ctx->output = NULL;
+
+#ifdef PERFC
+	/* Open the events as a group so that they are scheduled together and
+	 * their ratios stay meaningful. Events that do not fit in the group are
+	 * counted alone, and those not supported or not allowed are skipped. */
+	for (int i = 0, group = -1; i < RLC_BENCH_EVENTS; i++) {
+		ctx->perf_fd[i] = perf_open(i, group);
+		if (ctx->perf_fd[i] < 0 && group >= 0) {
+			ctx->perf_fd[i] = perf_open(i, -1);
+		} else if (group < 0) {
+			group = ctx->perf_fd[i];
+		}
+	}
+	memset(ctx->perf_total, 0, sizeof(ctx->perf_total));
+	memset(ctx->perf_enabled, 0, sizeof(ctx->perf_enabled));
+	memset(ctx->perf_running, 0, sizeof(ctx->perf_running));
+#endif
+
+	if ((path = getenv("RELIC_BENCH_JSON")) != NULL) {
+		bench_output(RLC_BENCH_JSON, path);
+	} else if ((path = getenv("RELIC_BENCH_CSV")) != NULL) {
+		bench_output(RLC_BENCH_CSV, path);
+	}
+}
+
+void bench_clean(void) {
+	bench_output(RLC_BENCH_TXT, NULL);
+#if defined(PERFC) && OPSYS == LINUX
+	/* Close the group members before the leader. */
+	for (int i = RLC_BENCH_EVENTS - 1; i >= 0; i--) {
+		if (core_get()->perf_fd[i] >= 0) {
+			close(core_get()->perf_fd[i]);
+			core_get()->perf_fd[i] = -1;
+		}
+	}
+#endif
+}
+
+int bench_output(int format, const char *path) {
+	ctx_t *ctx = core_get();
+	FILE *f = NULL;
+
+	if (format != RLC_BENCH_TXT) {
+		if (path == NULL || (f = fopen(path, "w")) == NULL) {
+			return RLC_ERR;
+		}
+		if (format == RLC_BENCH_CSV) {
+			fputs("label,unit,mean,min,median,p90,p99,stddev,samples", f);
+#ifdef COUNT
+			for (int i = 0; i < RLC_CNT_MAX; i++) {
+				fprintf(f, ",%s", cnt_names[i]);
+			}
+#endif
+#ifdef PERFC
+			for (int i = 0; i < RLC_BENCH_EVENTS; i++) {
+				fprintf(f, ",%s", perf_names[i]);
+			}
+			fputs(",running", f);
+#endif
+			fputc('\n', f);
+		}
+	}
+	if (ctx->output != NULL) {
+		fclose((FILE *)ctx->output);
+	}
+	ctx->format = format;
+	ctx->output = f;
+	return RLC_OK;
+}
+
 #if defined(OVERH) && defined(TIMER) && BENCH > 1
 
 void bench_overhead(void) {
@@ -156,18 +491,43 @@ void bench_overhead(void) {
 		ctx->over /= BENCH;
 	} while (ctx->over < 0);
 	ctx->total = ctx->over;
+	ctx->sampled = 0;
+	ctx->label = NULL;
 	bench_print();
 }
 
 #endif /* OVER && TIMER && BENCH > 1 */
 
 void bench_reset(void) {
+	bench_reset_label(NULL);
+}
+
+void bench_reset_label(const char *label) {
+#ifdef COUNT
+	memset(core_get()->cnt_total, 0, sizeof(core_get()->cnt_total));
+#endif
+#ifdef PERFC
+	memset(core_get()->perf_total, 0, sizeof(core_get()->perf_total));
+	memset(core_get()->perf_enabled, 0, sizeof(core_get()->perf_enabled));
+	memset(core_get()->perf_running, 0, sizeof(core_get()->perf_running));
+#endif
+	core_get()->benches = 0;
 #ifdef TIMER
 	core_get()->total = 0;
+	core_get()->sampled = 0;
+	core_get()->label = label;
+#else
+	(void)label;
 #endif
 }
 
 void bench_before(void) {
+#ifdef COUNT
+	core_cnt_get(core_get()->cnt_before);
+#endif
+#ifdef PERFC
+	perf_read(core_get()->perf_before);
+#endif
 #if OPSYS == DUINO && TIMER == HREAL
 	core_get()->before = micros();
 #elif TIMER == HREAL || TIMER == HPROC || TIMER == HTHRD
@@ -184,6 +544,9 @@ void bench_before(void) {
 void bench_after(void) {
 	ctx_t *ctx = core_get();
 	long long result;
+#ifdef PERFC
+	ull_t perf[RLC_BENCH_EVENTS][3], enabled, running;
+#endif
 
 #if OPSYS == DUINO && TIMER == HREAL
 	core_get()->after = micros();
@@ -204,8 +567,32 @@ void bench_after(void) {
   	result = (ctx->after - ctx->before);
 #endif
 
+#ifdef PERFC
+	perf_read(perf);
+	for (int i = 0; i < RLC_BENCH_EVENTS; i++) {
+		enabled = perf[i][1] - ctx->perf_before[i][1];
+		running = perf[i][2] - ctx->perf_before[i][2];
+		/* Scale the count if the counter was multiplexed out for a while. */
+		if (running > 0) {
+			ctx->perf_total[i] += (double)(perf[i][0] -
+					ctx->perf_before[i][0]) * enabled / running;
+		}
+		ctx->perf_enabled[i] += enabled;
+		ctx->perf_running[i] += running;
+	}
+#endif
+#ifdef COUNT
+	for (int i = 0; i < RLC_CNT_MAX; i++) {
+		ctx->cnt_total[i] += ctx->cnt[i] - ctx->cnt_before[i];
+	}
+#endif
+
 #ifdef TIMER
 	ctx->total += result;
+	if (ctx->sampled < RLC_BENCH_SAMPLES) {
+		ctx->samples[ctx->sampled] = result;
+	}
+	ctx->sampled++;
 #else
 	(void)result;
 	(void)ctx;
@@ -214,11 +601,38 @@ void bench_after(void) {
 
 void bench_compute(int benches) {
 	ctx_t *ctx = core_get();
+
+	ctx->benches = benches;
 #ifdef TIMER
+	long long *s = ctx->samples, over = 0;
+	int i, n = RLC_MIN(ctx->sampled, RLC_BENCH_SAMPLES);
+	double sum = 0, dev = 0;
+
 	ctx->total = ctx->total / benches;
 #ifdef OVERH
-	ctx->total = ctx->total - ctx->over;
+	over = ctx->over;
+	ctx->total = ctx->total - over;
 #endif /* OVERH */
+
+	/* Scale each sample to the cost of one execution. */
+	for (i = 0; i < n; i++) {
+		s[i] = s[i] * ctx->sampled / benches - over;
+		sum += s[i];
+	}
+	qsort(s, n, sizeof(long long), cmp_sample);
+	for (i = 0; i < n; i++) {
+		dev += (s[i] - sum / n) * (s[i] - sum / n);
+	}
+	for (i = 0; i < RLC_BENCH_STATS; i++) {
+		ctx->stats[i] = 0;
+	}
+	if (n > 0) {
+		ctx->stats[RLC_BENCH_MIN] = s[0];
+		ctx->stats[RLC_BENCH_MED] = s[n / 2];
+		ctx->stats[RLC_BENCH_P90] = s[(90 * n) / 100];
+		ctx->stats[RLC_BENCH_P99] = s[(99 * n) / 100];
+		ctx->stats[RLC_BENCH_DEV] = isqrt((unsigned long long)(dev / n));
+	}
 #else
 	(void)benches;
 	(void)ctx;
@@ -227,21 +641,103 @@ void bench_compute(int benches) {
 
 void bench_print(void) {
 	ctx_t *ctx = core_get();
-
-#if TIMER == POSIX || TIMER == ANSI || (OPSYS == DUINO && TIMER == HREAL)
-	util_print("%lld microsec", ctx->total);
-#elif TIMER == CYCLE
-	util_print("%lld cycles", ctx->total);
-#else
-	util_print("%lld nanosec", ctx->total);
+#if defined(COUNT) || defined(PERFC)
+	int i, first = 1;
 #endif
+
+	util_print("%lld %s", ctx->total, unit());
 	if (ctx->total < 0) {
-		util_print(" (overflow or bad overhead estimation)\n");
-	} else {
-		util_print("\n");
+		util_print(" (overflow or bad overhead estimation)");
+	} else if (ctx->sampled > 1) {
+		util_print(" (min %lld, med %lld, p90 %lld, p99 %lld, sd %lld)",
+				ctx->stats[RLC_BENCH_MIN], ctx->stats[RLC_BENCH_MED],
+				ctx->stats[RLC_BENCH_P90], ctx->stats[RLC_BENCH_P99],
+				ctx->stats[RLC_BENCH_DEV]);
+	}
+#ifdef COUNT
+	/* Print the field operations executed per benchmark, skipping zeros. */
+	for (i = 0; i < RLC_CNT_MAX; i++) {
+		if (ctx->cnt_total[i] != 0) {
+			util_print("%s%.4g%s", (first ? " [" : ", "), cnt_per_op(i),
+					cnt_names[i]);
+			first = 0;
+		}
+	}
+	if (!first) {
+		util_print("]");
+	}
+#endif
+#ifdef PERFC
+	/* Print only the events available, so nothing is printed without perf. */
+	if (bench_event(RLC_BENCH_CYCLES) > 0 && bench_event(RLC_BENCH_INSTRS) >= 0) {
+		util_print(" [IPC %.2f]", bench_event(RLC_BENCH_INSTRS) /
+				bench_event(RLC_BENCH_CYCLES));
+	}
+	first = 1;
+	for (i = RLC_BENCH_L1D; i < RLC_BENCH_EVENTS; i++) {
+		if (bench_event(i) >= 0) {
+			util_print("%s%.4g %s", (first ? " [misses: " : ", "),
+					bench_event(i), (i == RLC_BENCH_L1D ? "L1D" :
+					(i == RLC_BENCH_LLC ? "LLC" : "branch")));
+			first = 0;
+		}
+	}
+	if (!first) {
+		util_print("]");
 	}
+	if (bench_running() >= 0 && bench_running() < 1) {
+		util_print(" [multiplexed, counted %.0f%%]", 100 * bench_running());
+	}
+#endif
+	util_print("\n");
+	write_output();
 }
 
 ull_t bench_total(void) {
 	return core_get()->total;
 }
+
+ull_t bench_stat(int stat) {
+	return core_get()->stats[stat];
+}
+
+double bench_event(int event) {
+#ifdef PERFC
+	ctx_t *ctx = core_get();
+
+	if (event < 0 || event >= RLC_BENCH_EVENTS || ctx->perf_fd[event] < 0) {
+		return -1;
+	}
+	/* An event that was never scheduled cannot be estimated. */
+	if (ctx->perf_enabled[event] > 0 && ctx->perf_running[event] == 0) {
+		return -1;
+	}
+	if (ctx->benches <= 0) {
+		return 0;
+	}
+	return ctx->perf_total[event] / ctx->benches;
+#else
+	(void)event;
+	return -1;
+#endif
+}
+
+double bench_running(void) {
+	double r = -1;
+#ifdef PERFC
+	ctx_t *ctx = core_get();
+
+	/* Report the event that was counted for the shortest time. */
+	for (int i = 0; i < RLC_BENCH_EVENTS; i++) {
+		if (ctx->perf_fd[i] >= 0) {
+			if (ctx->perf_enabled[i] == 0) {
+				r = (r < 0 ? 1 : r);
+			} else if (r < 0 || ctx->perf_running[i] <
+					r * ctx->perf_enabled[i]) {
+				r = (double)ctx->perf_running[i] / ctx->perf_enabled[i];
+			}
+		}
+	}
+#endif
+	return r;
+}
@@ -96,6 +96,10 @@ thread ctx_t *core_ctx = NULL;
 #endif
 
 int core_init(void) {
+	return core_init_with(RLC_CORE_ALL);
+}
+
+int core_init_with(int mods) {
 	if (core_ctx == NULL) {
 		core_ctx = &(first_ctx);
 	}
@@ -117,64 +121,119 @@ int core_init(void) {
 	core_ctx->over = 0;
 #endif
 
+	core_cnt_reset();
+
 	core_ctx->code = RLC_OK;
+	core_ctx->mods = 0;
 
 	TRY {
 		arch_init();
 		rand_init();
+#if BENCH > 0
+		bench_init();
+#endif
+#ifdef WITH_FT
+		ft_poly_init();
+#endif
+		core_init_mod(mods);
+	}
+	CATCH_ANY {
+		return RLC_ERR;
+	}
+
+	return RLC_OK;
+}
+
+void core_init_mod(int mods) {
+	ctx_t *ctx = core_get();
+
+	/* Add the dependencies of each module. */
+	if (mods & (RLC_CORE_EP | RLC_CORE_ED | RLC_CORE_PP)) {
+		mods |= RLC_CORE_FP;
+	}
+	if (mods & RLC_CORE_PP) {
+		mods |= RLC_CORE_EP;
+	}
+	if (mods & RLC_CORE_EB) {
+		mods |= RLC_CORE_FB;
+	}
+	mods &= ~ctx->mods;
+
 #ifdef WITH_FP
+	if (mods & RLC_CORE_FP) {
 		fp_prime_init();
+	}
 #endif
 #ifdef WITH_FB
+	if (mods & RLC_CORE_FB) {
 		fb_poly_init();
-#endif
-#ifdef WITH_FT
-		ft_poly_init();
+	}
 #endif
 #ifdef WITH_EP
+	if (mods & RLC_CORE_EP) {
 		ep_curve_init();
+	}
 #endif
 #ifdef WITH_EB
+	if (mods & RLC_CORE_EB) {
 		eb_curve_init();
+	}
 #endif
 #ifdef WITH_ED
+	if (mods & RLC_CORE_ED) {
 		ed_curve_init();
+	}
 #endif
 #ifdef WITH_PP
+	if (mods & RLC_CORE_PP) {
 		pp_map_init();
-#endif
-	}
-	CATCH_ANY {
-		return RLC_ERR;
 	}
-
-	return RLC_OK;
+#endif
+	ctx->mods |= mods;
 }
 
 int core_clean(void) {
+	int mods = core_ctx->mods;
+
 	rand_clean();
+#if BENCH > 0
+	bench_clean();
+#endif
 #ifdef WITH_FP
-	fp_prime_clean();
+	if (mods & RLC_CORE_FP) {
+		fp_prime_clean();
+	}
 #endif
 #ifdef WITH_FB
-	fb_poly_clean();
+	if (mods & RLC_CORE_FB) {
+		fb_poly_clean();
+	}
 #endif
 #ifdef WITH_FT
 	ft_poly_clean();
 #endif
 #ifdef WITH_EP
-	ep_curve_clean();
+	if (mods & RLC_CORE_EP) {
+		ep_curve_clean();
+	}
 #endif
 #ifdef WITH_EB
-	eb_curve_clean();
+	if (mods & RLC_CORE_EB) {
+		eb_curve_clean();
+	}
 #endif
 #ifdef WITH_ED
-	ed_curve_clean();
+	if (mods & RLC_CORE_ED) {
+		ed_curve_clean();
+	}
 #endif
 #ifdef WITH_PP
-	pp_map_clean();
+	if (mods & RLC_CORE_PP) {
+		pp_map_clean();
+	}
 #endif
 	arch_clean();
+	core_ctx->mods = 0;
 	core_ctx = NULL;
 	return RLC_OK;
 }
@@ -186,3 +245,17 @@ ctx_t *core_get(void) {
 void core_set(ctx_t *ctx) {
 	core_ctx = ctx;
 }
+
+void core_cnt_get(ull_t cnt[RLC_CNT_MAX]) {
+#ifdef COUNT
+	memcpy(cnt, core_get()->cnt, sizeof(core_get()->cnt));
+#else
+	memset(cnt, 0, RLC_CNT_MAX * sizeof(ull_t));
+#endif
+}
+
+void core_cnt_reset(void) {
+#ifdef COUNT
+	memset(core_get()->cnt, 0, sizeof(core_get()->cnt));
+#endif
+}
@@ -194,6 +194,42 @@ int util_cmp_const(const void *a, const void *b, int size) {
 	return (result == 0 ? RLC_EQ : RLC_NE);
 }
 
+uint64_t util_hash(const void *a, int size) {
+	const uint8_t *_a = (const uint8_t *)a;
+	uint64_t h = 0xCBF29CE484222325ULL;
+	int i;
+
+	/* FNV-1a with the 64-bit offset basis and prime. */
+	for (i = 0; i < size; i++) {
+		h ^= _a[i];
+		h *= 0x100000001B3ULL;
+	}
+	return h;
+}
+
+void util_hash_put(uint64_t *keys, int *vals, int slots, uint64_t key,
+		int val) {
+	int s, mask = slots - 1;
+
+	for (s = (int)(key & mask); vals[s] >= 0; s = (s + 1) & mask);
+	keys[s] = key;
+	vals[s] = val;
+}
+
+int util_hash_get(const uint64_t *keys, const int *vals, int slots,
+		uint64_t key, int *slot) {
+	int s, mask = slots - 1;
+
+	s = (*slot < 0 ? (int)(key & mask) : (*slot + 1) & mask);
+	for (; vals[s] >= 0; s = (s + 1) & mask) {
+		if (keys[s] == key) {
+			*slot = s;
+			return vals[s];
+		}
+	}
+	return -1;
+}
+
 void util_print(const char *format, ...) {
 #ifndef QUIET
 #if ARCH == AVR && !defined(OPSYS)
@@ -986,18 +986,26 @@ static int reduction(void) {
 
 static int exponentiation(void) {
 	int code = RLC_ERR;
-	bn_t a, b, c, p;
+	bn_t a, b, c, p, e[64], f[64];
 
 	bn_null(a);
 	bn_null(b);
 	bn_null(c);
 	bn_null(p);
+	for (int i = 0; i < 64; i++) {
+		bn_null(e[i]);
+		bn_null(f[i]);
+	}
 
 	TRY {
 		bn_new(a);
 		bn_new(b);
 		bn_new(c);
 		bn_new(p);
+		for (int i = 0; i < 64; i++) {
+			bn_new(e[i]);
+			bn_new(f[i]);
+		}
 
 #if BN_MOD != PMERS
 		bn_gen_prime(p, RLC_BN_BITS);
@@ -1040,6 +1048,59 @@ static int exponentiation(void) {
 		}
 		TEST_END;
 
+		TEST_BEGIN("simultaneous modular exponentiation is correct") {
+			bn_set_dig(c, 1);
+			for (int j = 0; j < 4; j++) {
+				bn_rand(e[j], RLC_POS, RLC_BN_BITS);
+				bn_mod(e[j], e[j], p);
+				bn_rand(f[j], RLC_POS, RLC_BN_BITS / (j + 1));
+				if (j == 3) {
+					bn_neg(f[j], f[j]);
+				}
+				bn_mxp(a, e[j], f[j], p);
+				bn_mul(c, c, a);
+				bn_mod(c, c, p);
+			}
+			bn_mxp_sim(b, (const bn_t *)e, (const bn_t *)f, 4, p);
+			TEST_ASSERT(bn_cmp(b, c) == RLC_EQ, end);
+			bn_mxp_sim(b, (const bn_t *)e, (const bn_t *)f, 1, p);
+			bn_mxp(c, e[0], f[0], p);
+			TEST_ASSERT(bn_cmp(b, c) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("simultaneous exponentiation with many bases is correct") {
+			bn_set_dig(c, 1);
+			for (int j = 0; j < 64; j++) {
+				bn_rand(e[j], RLC_POS, RLC_BN_BITS);
+				bn_mod(e[j], e[j], p);
+				bn_rand(f[j], RLC_POS, 16);
+				bn_mxp(a, e[j], f[j], p);
+				bn_mul(c, c, a);
+				bn_mod(c, c, p);
+			}
+			/* Many bases with short exponents use the bucket method. */
+			bn_mxp_sim(b, (const bn_t *)e, (const bn_t *)f, 64, p);
+			TEST_ASSERT(bn_cmp(b, c) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("constant-time simultaneous exponentiation is correct") {
+			for (int j = 0; j < 4; j++) {
+				bn_rand(e[j], RLC_POS, RLC_BN_BITS);
+				bn_mod(e[j], e[j], p);
+				bn_rand(f[j], RLC_POS, RLC_BN_BITS / (j + 1));
+				if (j == 3) {
+					bn_neg(f[j], f[j]);
+				}
+			}
+			bn_zero(f[2]);
+			bn_mxp_sim(c, (const bn_t *)e, (const bn_t *)f, 4, p);
+			bn_mxp_sim_const(b, (const bn_t *)e, (const bn_t *)f, 4, p);
+			TEST_ASSERT(bn_cmp(b, c) == RLC_EQ, end);
+		}
+		TEST_END;
+
 #if BN_MXP == BASIC || !defined(STRIP)
 		TEST_BEGIN("basic modular exponentiation is correct") {
 			bn_rand(a, RLC_POS, RLC_BN_BITS);
@@ -1079,6 +1140,10 @@ static int exponentiation(void) {
 	bn_free(b);
 	bn_free(c);
 	bn_free(p);
+	for (int i = 0; i < 64; i++) {
+		bn_free(e[i]);
+		bn_free(f[i]);
+	}
 	return code;
 }
 
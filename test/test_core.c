@@ -98,6 +98,122 @@ int main(void) {
 		core_set(old_ctx);
 	} TEST_END;
 
+	TEST_ONCE("selective initialization of modules is correct") {
+		ctx_t new_ctx, *old_ctx;
+		old_ctx = core_get();
+		core_set(&new_ctx);
+		TEST_ASSERT(core_init_with(RLC_CORE_FP) == RLC_OK, end);
+		TEST_ASSERT(core_get()->mods == RLC_CORE_FP, end);
+#if defined(WITH_EP)
+		/* Modules are set up on demand when configuring parameters. */
+		if (ep_param_set_any() == RLC_OK) {
+			TEST_ASSERT(core_get()->mods & RLC_CORE_EP, end);
+			TEST_ASSERT(!(core_get()->mods & RLC_CORE_EB), end);
+		}
+#endif
+#if defined(WITH_PP)
+		if (ep_param_set_any_pairf() == RLC_OK) {
+			TEST_ASSERT(core_get()->mods & RLC_CORE_PP, end);
+		}
+#endif
+		core_clean();
+		core_set(old_ctx);
+	} TEST_END;
+
+#if defined(COUNT) && defined(WITH_FP)
+	TEST_ONCE("field operation counters are correct") {
+		ull_t cnt[RLC_CNT_MAX];
+		fp_t a, b;
+
+		fp_null(a);
+		fp_null(b);
+		fp_new(a);
+		fp_new(b);
+		TEST_ASSERT(fp_param_set_any() == RLC_OK, end);
+		fp_rand(a);
+		fp_rand(b);
+		core_cnt_reset();
+		fp_mul(a, a, b);
+		fp_mul(a, a, b);
+		fp_sqr(b, a);
+		fp_add(a, a, b);
+		core_cnt_get(cnt);
+		/* Squarings may be computed as multiplications. */
+		TEST_ASSERT(cnt[RLC_CNT_FP_MUL] + cnt[RLC_CNT_FP_SQR] == 3, end);
+		TEST_ASSERT(cnt[RLC_CNT_FP_ADD] == 1, end);
+		TEST_ASSERT(cnt[RLC_CNT_FP_INV] == 0, end);
+		core_cnt_reset();
+		core_cnt_get(cnt);
+		TEST_ASSERT(cnt[RLC_CNT_FP_MUL] == 0, end);
+		fp_free(a);
+		fp_free(b);
+	} TEST_END;
+#endif
+
+#if BENCH > 0 && defined(TIMER)
+	TEST_ONCE("benchmark results are written correctly") {
+		const char *path = "test_core_bench.out";
+		char line[2][1024];
+		FILE *f;
+		int i, j, k, n[2];
+
+		for (j = RLC_BENCH_JSON; j <= RLC_BENCH_CSV; j++) {
+			TEST_ASSERT(bench_output(j, path) == RLC_OK, end);
+			bench_reset_label("a \"quoted\" label");
+			for (i = 0; i < BENCH; i++) {
+				bench_before();
+				bench_after();
+			}
+			bench_compute(BENCH);
+			bench_print();
+			TEST_ASSERT(bench_stat(RLC_BENCH_MIN) <= bench_stat(RLC_BENCH_MED),
+					end);
+			TEST_ASSERT(bench_stat(RLC_BENCH_MED) <= bench_stat(RLC_BENCH_P90),
+					end);
+			TEST_ASSERT(bench_stat(RLC_BENCH_P90) <= bench_stat(RLC_BENCH_P99),
+					end);
+			/* Unlabeled results are only printed. */
+			bench_reset();
+			bench_before();
+			bench_after();
+			bench_compute(1);
+			bench_print();
+			bench_output(RLC_BENCH_TXT, NULL);
+
+			f = fopen(path, "r");
+			TEST_ASSERT(f != NULL, end);
+			for (k = 0; k < 2 && fgets(line[k], sizeof(line[k]), f); k++);
+			TEST_ASSERT(fgetc(f) == EOF, end);
+			fclose(f);
+			remove(path);
+			if (j == RLC_BENCH_JSON) {
+				TEST_ASSERT(k == 1, end);
+				TEST_ASSERT(strncmp(line[0], "{\"label\": \"a \\\"quoted\\\" "
+						"label\", \"unit\": ", 40) == 0, end);
+				TEST_ASSERT(strstr(line[0], ", \"median\": ") != NULL, end);
+				TEST_ASSERT(strstr(line[0], ", \"p90\": ") != NULL, end);
+				TEST_ASSERT(strstr(line[0], ", \"p99\": ") != NULL, end);
+				TEST_ASSERT(strcmp(line[0] + strlen(line[0]) - 2, "}\n") == 0,
+						end);
+			} else {
+				TEST_ASSERT(k == 2, end);
+				TEST_ASSERT(strncmp(line[0], "label,unit,mean,min,median,p90,"
+						"p99,stddev,samples", 49) == 0, end);
+				TEST_ASSERT(strncmp(line[1], "\"a \"\"quoted\"\" label\",",
+						21) == 0, end);
+				/* Both rows have the same number of columns. */
+				for (k = 0; k < 2; k++) {
+					n[k] = 0;
+					for (i = 0; line[k][i] != '\0'; i++) {
+						n[k] += (line[k][i] == ',');
+					}
+				}
+				TEST_ASSERT(n[0] == n[1], end);
+			}
+		}
+	} TEST_END;
+#endif
+
 	code = RLC_OK;
 
 #if MULTI == OPENMP
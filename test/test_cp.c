@@ -241,6 +241,36 @@ static int benaloh(void) {
 			TEST_ASSERT(cp_bdpe_dec(&out, buf, len, prv) == RLC_OK, end);
 			TEST_ASSERT(in == out, end);
 		} TEST_END;
+
+		/* Block size larger than the decryption table. */
+		result = cp_bdpe_gen(pub, prv, 65537, RLC_BN_BITS);
+
+		TEST_BEGIN("benaloh decryption with large blocks is correct") {
+			TEST_ASSERT(result == RLC_OK, end);
+			len = RLC_BN_BITS / 8 + 1;
+			rand_bytes(buf, 3);
+			in = ((buf[0] << 16) | (buf[1] << 8) | buf[2]) % 65537;
+			TEST_ASSERT(cp_bdpe_enc(buf, &len, in, pub) == RLC_OK, end);
+			TEST_ASSERT(cp_bdpe_dec(&out, buf, len, prv) == RLC_OK, end);
+			TEST_ASSERT(in == out, end);
+		} TEST_END;
+
+		TEST_ONCE("benaloh decryption needs a precomputed table") {
+			TEST_ASSERT(result == RLC_OK, end);
+			len = RLC_BN_BITS / 8 + 1;
+			rand_bytes(buf, 1);
+			in = buf[0];
+			TEST_ASSERT(cp_bdpe_enc(buf, &len, in, pub) == RLC_OK, end);
+			free(prv->keys);
+			free(prv->vals);
+			prv->keys = NULL;
+			prv->vals = NULL;
+			TEST_ASSERT(cp_bdpe_dec(&out, buf, len, prv) == RLC_ERR, end);
+			TEST_ASSERT(prv->keys == NULL, end);
+			TEST_ASSERT(cp_bdpe_pre(prv) == RLC_OK, end);
+			TEST_ASSERT(cp_bdpe_dec(&out, buf, len, prv) == RLC_OK, end);
+			TEST_ASSERT(in == out, end);
+		} TEST_END;
 	} CATCH_ANY {
 		ERROR(end);
 	}
@@ -256,39 +286,51 @@ static int benaloh(void) {
 
 static int paillier(void) {
 	int code = RLC_ERR;
-	bn_t a, b, c, d, n, l, s;
+	bn_t a, b, c, d, s, e[3], k[3];
+	phpe_t pub, prv;
+	phpe_pool_t pool;
 	uint8_t in[RLC_BN_BITS / 8 + 1], out[RLC_BN_BITS / 8 + 1];
-	int in_len, out_len;
+	int in_len, out_len, hits, miss;
 	int result;
 
 	bn_null(a);
 	bn_null(b);
 	bn_null(c);
 	bn_null(d);
-	bn_null(n);
-	bn_null(l);
+	phpe_null(pub);
+	phpe_null(prv);
+	phpe_pool_null(pool);
 	bn_null(s);
+	for (int i = 0; i < 3; i++) {
+		bn_null(e[i]);
+		bn_null(k[i]);
+	}
 
 	TRY {
 		bn_new(a);
 		bn_new(b);
 		bn_new(c);
 		bn_new(d);
-		bn_new(n);
-		bn_new(l);
+		phpe_new(pub);
+		phpe_new(prv);
+		phpe_pool_new(pool, 2);
 		bn_new(s);
+		for (int i = 0; i < 3; i++) {
+			bn_new(e[i]);
+			bn_new(k[i]);
+		}
 
-		result = cp_phpe_gen(n, l, RLC_BN_BITS / 2);
+		result = cp_phpe_gen(pub, prv, RLC_BN_BITS / 2);
 
 		TEST_BEGIN("paillier encryption/decryption is correct") {
 			TEST_ASSERT(result == RLC_OK, end);
-			in_len = bn_size_bin(n);
+			in_len = bn_size_bin(pub->n);
 			out_len = RLC_BN_BITS / 8 + 1;
 			memset(in, 0, sizeof(in));
 			rand_bytes(in + (in_len - 10), 10);
-			TEST_ASSERT(cp_phpe_enc(out, &out_len, in, in_len, n) == RLC_OK,
+			TEST_ASSERT(cp_phpe_enc(out, &out_len, in, in_len, pub) == RLC_OK,
 					end);
-			TEST_ASSERT(cp_phpe_dec(out, in_len, out, out_len, n, l) == RLC_OK,
+			TEST_ASSERT(cp_phpe_dec(out, in_len, out, out_len, prv) == RLC_OK,
 					end);
 			TEST_ASSERT(memcmp(in, out, in_len) == 0, end);
 		}
@@ -296,26 +338,26 @@ static int paillier(void) {
 
 		TEST_BEGIN("paillier encryption/decryption is homomorphic") {
 			TEST_ASSERT(result == RLC_OK, end);
-			in_len = bn_size_bin(n);
+			in_len = bn_size_bin(pub->n);
 			out_len = RLC_BN_BITS / 8 + 1;
 			memset(in, 0, sizeof(in));
 			rand_bytes(in + (in_len - 10), 10);
 			bn_read_bin(a, in, in_len);
-			TEST_ASSERT(cp_phpe_enc(out, &out_len, in, in_len, n) == RLC_OK,
+			TEST_ASSERT(cp_phpe_enc(out, &out_len, in, in_len, pub) == RLC_OK,
 					end);
 			bn_read_bin(b, out, out_len);
 			memset(in, 0, sizeof(in));
 			rand_bytes(in + (in_len - 10), 10);
 			bn_read_bin(c, in, in_len);
 			out_len = RLC_BN_BITS / 8 + 1;
-			TEST_ASSERT(cp_phpe_enc(out, &out_len, in, in_len, n) == RLC_OK,
+			TEST_ASSERT(cp_phpe_enc(out, &out_len, in, in_len, pub) == RLC_OK,
 					end);
 			bn_read_bin(d, out, out_len);
 			bn_mul(b, b, d);
-			bn_sqr(s, n);
+			bn_sqr(s, pub->n);
 			bn_mod(b, b, s);
 			bn_write_bin(out, out_len, b);
-			TEST_ASSERT(cp_phpe_dec(out, in_len, out, out_len, n, l) == RLC_OK,
+			TEST_ASSERT(cp_phpe_dec(out, in_len, out, out_len, prv) == RLC_OK,
 					end);
 			bn_add(a, a, c);
 			bn_write_bin(in, in_len, a);
@@ -323,6 +365,73 @@ static int paillier(void) {
 			TEST_ASSERT(memcmp(in, out, in_len) == 0, end);
 		}
 		TEST_END;
+
+		TEST_BEGIN("paillier vector operations are homomorphic") {
+			TEST_ASSERT(result == RLC_OK, end);
+			in_len = bn_size_bin(pub->n);
+			bn_zero(a);
+			bn_zero(b);
+			for (int j = 0; j < 3; j++) {
+				out_len = RLC_BN_BITS / 8 + 1;
+				memset(in, 0, sizeof(in));
+				rand_bytes(in + (in_len - 8), 8);
+				bn_read_bin(c, in, in_len);
+				bn_rand(k[j], RLC_POS, 64);
+				bn_add(a, a, c);
+				bn_mul(d, c, k[j]);
+				bn_add(b, b, d);
+				TEST_ASSERT(cp_phpe_enc(out, &out_len, in, in_len, pub) ==
+						RLC_OK, end);
+				bn_read_bin(e[j], out, out_len);
+			}
+			/* Check the sum of plaintexts. */
+			TEST_ASSERT(cp_phpe_add_vec(c, e, 3, pub) == RLC_OK, end);
+			bn_write_bin(out, out_len, c);
+			TEST_ASSERT(cp_phpe_dec(out, in_len, out, out_len, prv) ==
+					RLC_OK, end);
+			bn_write_bin(in, in_len, a);
+			TEST_ASSERT(memcmp(in, out, in_len) == 0, end);
+			/* Check the inner product with the scalars. */
+			TEST_ASSERT(cp_phpe_ip(c, e, k, 3, pub) == RLC_OK, end);
+			bn_write_bin(out, out_len, c);
+			TEST_ASSERT(cp_phpe_dec(out, in_len, out, out_len, prv) ==
+					RLC_OK, end);
+			bn_write_bin(in, in_len, b);
+			TEST_ASSERT(memcmp(in, out, in_len) == 0, end);
+			/* Check that scaling and adding matches the inner product. */
+			TEST_ASSERT(cp_phpe_scal_vec(e, e, k, 3, pub) == RLC_OK, end);
+			TEST_ASSERT(cp_phpe_add_vec(d, e, 3, pub) == RLC_OK, end);
+			TEST_ASSERT(bn_cmp(c, d) == RLC_EQ, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("paillier encryption with randomizer pools is correct") {
+			TEST_ASSERT(result == RLC_OK, end);
+			TEST_ASSERT(cp_phpe_pre(pool, pub) == RLC_OK, end);
+			TEST_ASSERT(pool->len == 2, end);
+			hits = pool->hits;
+			miss = pool->miss;
+			in_len = bn_size_bin(pub->n);
+			for (int j = 0; j < 3; j++) {
+				out_len = RLC_BN_BITS / 8 + 1;
+				memset(in, 0, sizeof(in));
+				rand_bytes(in + (in_len - 10), 10);
+				TEST_ASSERT(cp_phpe_enc_pre(out, &out_len, in, in_len, pub,
+						pool) == RLC_OK, end);
+				TEST_ASSERT(cp_phpe_dec(out, in_len, out, out_len, prv) ==
+						RLC_OK, end);
+				TEST_ASSERT(memcmp(in, out, in_len) == 0, end);
+			}
+			TEST_ASSERT(pool->hits == hits + 2 && pool->miss == miss + 1, end);
+			/* The pool must not be used with a different key. */
+			bn_add_dig(pub->n, pub->n, 2);
+			out_len = RLC_BN_BITS / 8 + 1;
+			TEST_ASSERT(cp_phpe_pre(pool, pub) == RLC_ERR, end);
+			TEST_ASSERT(cp_phpe_enc_pre(out, &out_len, in, in_len, pub,
+					pool) == RLC_ERR, end);
+			bn_sub_dig(pub->n, pub->n, 2);
+		}
+		TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -334,9 +443,14 @@ static int paillier(void) {
 	bn_free(b);
 	bn_free(c);
 	bn_free(d);
-	bn_free(n);
-	bn_free(l);
+	phpe_free(pub);
+	phpe_free(prv);
+	phpe_pool_free(pool);
 	bn_free(s);
+	for (int i = 0; i < 3; i++) {
+		bn_free(e[i]);
+		bn_free(k[i]);
+	}
 	return code;
 }
 
@@ -398,6 +512,26 @@ uint8_t result[] = {
 
 #endif
 
+/* Test vector taken from RFC 7748, Section 5.2. */
+
+uint8_t x25519_k[] = {
+	0xA5, 0x46, 0xE3, 0x6B, 0xF0, 0x52, 0x7C, 0x9D, 0x3B, 0x16, 0x15, 0x4B,
+	0x82, 0x46, 0x5E, 0xDD, 0x62, 0x14, 0x4C, 0x0A, 0xC1, 0xFC, 0x5A, 0x18,
+	0x50, 0x6A, 0x22, 0x44, 0xBA, 0x44, 0x9A, 0xC4
+};
+
+uint8_t x25519_u[] = {
+	0xE6, 0xDB, 0x68, 0x67, 0x58, 0x30, 0x30, 0xDB, 0x35, 0x94, 0xC1, 0xA4,
+	0x24, 0xB1, 0x5F, 0x7C, 0x72, 0x66, 0x24, 0xEC, 0x26, 0xB3, 0x35, 0x3B,
+	0x10, 0xA9, 0x03, 0xA6, 0xD0, 0xAB, 0x1C, 0x4C
+};
+
+uint8_t x25519_r[] = {
+	0xC3, 0xDA, 0x55, 0x37, 0x9D, 0xE9, 0xC6, 0x90, 0x8E, 0x94, 0xEA, 0x4D,
+	0xF2, 0x8D, 0x08, 0x4F, 0x32, 0xEC, 0xCF, 0x03, 0x49, 0x1C, 0x71, 0xF7,
+	0x54, 0xB4, 0x07, 0x55, 0x77, 0xA2, 0x85, 0x52
+};
+
 #define ASSIGNP(CURVE)														\
 	RLC_GET(str, CURVE##_A, sizeof(CURVE##_A));								\
 	bn_read_str(da, str, strlen(str), 16);									\
@@ -438,6 +572,7 @@ static int ecdh(void) {
 	bn_t da, d_b;
 	ec_t qa, q_b;
 	uint8_t key[RLC_MD_LEN], k1[RLC_MD_LEN], k2[RLC_MD_LEN];
+	uint8_t xa[32], xb[32], ya[32], yb[32], za[32], zb[32];
 
 	bn_null(da);
 	bn_null(d_b);
@@ -498,6 +633,25 @@ static int ecdh(void) {
 			TEST_END;
 		}
 #endif
+
+		if (fp_param_get() == PRIME_25519) {
+			TEST_BEGIN("x25519 key agreement is correct") {
+				TEST_ASSERT(cp_x25519_gen(xa, ya) == RLC_OK, end);
+				TEST_ASSERT(cp_x25519_gen(xb, yb) == RLC_OK, end);
+				TEST_ASSERT(cp_x25519_key(za, xb, ya) == RLC_OK, end);
+				TEST_ASSERT(cp_x25519_key(zb, xa, yb) == RLC_OK, end);
+				TEST_ASSERT(memcmp(za, zb, 32) == 0, end);
+				memset(ya, 0, sizeof(ya));
+				TEST_ASSERT(cp_x25519_key(za, xb, ya) == RLC_ERR, end);
+			} TEST_END;
+
+			TEST_ONCE("x25519 satisfies test vectors") {
+				TEST_ASSERT(cp_x25519_key(za, x25519_k, x25519_u) == RLC_OK,
+						end);
+				TEST_ASSERT(memcmp(za, x25519_r, 32) == 0, end);
+			}
+			TEST_END;
+		}
 		(void)str;
 		(void)key;
 	}
@@ -664,19 +818,25 @@ static int ecies(void) {
 static int ecdsa(void) {
 	int code = RLC_ERR;
 	bn_t d, r, s;
-	ec_t q;
+	ec_t q, t[RLC_EC_TABLE];
 	uint8_t m[5] = { 0, 1, 2, 3, 4 }, h[RLC_MD_LEN];
 
 	bn_null(d);
 	bn_null(r);
 	bn_null(s);
 	ec_null(q);
+	for (int i = 0; i < RLC_EC_TABLE; i++) {
+		ec_null(t[i]);
+	}
 
 	TRY {
 		bn_new(d);
 		bn_new(r);
 		bn_new(s);
 		ec_new(q);
+		for (int i = 0; i < RLC_EC_TABLE; i++) {
+			ec_new(t[i]);
+		}
 
 		TEST_BEGIN("ecdsa signature is correct") {
 			TEST_ASSERT(cp_ecdsa_gen(d, q) == RLC_OK, end);
@@ -687,6 +847,23 @@ static int ecdsa(void) {
 			TEST_ASSERT(cp_ecdsa_ver(r, s, h, RLC_MD_LEN, 1, q) == 1, end);
 		}
 		TEST_END;
+
+		TEST_BEGIN("ecdsa with precomputed public key is correct") {
+			TEST_ASSERT(cp_ecdsa_gen(d, q) == RLC_OK, end);
+			ec_mul_pre(t, q);
+			TEST_ASSERT(cp_ecdsa_sig(r, s, m, sizeof(m), 0, d) == RLC_OK, end);
+			TEST_ASSERT(cp_ecdsa_ver_pre(r, s, m, sizeof(m), 0,
+				(const ec_t *)t) == 1, end);
+			m[0] ^= 1;
+			TEST_ASSERT(cp_ecdsa_ver_pre(r, s, m, sizeof(m), 0,
+				(const ec_t *)t) == 0, end);
+			m[0] ^= 1;
+			TEST_ASSERT(cp_ecdsa_gen(d, q) == RLC_OK, end);
+			TEST_ASSERT(cp_ecdsa_ver_pre(r, s, m, sizeof(m), 0,
+				(const ec_t *)t) == 1, end);
+			TEST_ASSERT(cp_ecdsa_ver(r, s, m, sizeof(m), 0, q) == 0, end);
+		}
+		TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -698,23 +875,32 @@ static int ecdsa(void) {
 	bn_free(r);
 	bn_free(s);
 	ec_free(q);
+	for (int i = 0; i < RLC_EC_TABLE; i++) {
+		ec_free(t[i]);
+	}
 	return code;
 }
 
 static int ecss(void) {
 	int code = RLC_ERR;
 	bn_t d, r;
-	ec_t q;
+	ec_t q, t[RLC_EC_TABLE];
 	uint8_t m[5] = { 0, 1, 2, 3, 4 };
 
 	bn_null(d);
 	bn_null(r);
 	ec_null(q);
+	for (int i = 0; i < RLC_EC_TABLE; i++) {
+		ec_null(t[i]);
+	}
 
 	TRY {
 		bn_new(d);
 		bn_new(r);
 		ec_new(q);
+		for (int i = 0; i < RLC_EC_TABLE; i++) {
+			ec_new(t[i]);
+		}
 
 		TEST_BEGIN("ecss signature is correct") {
 			TEST_ASSERT(cp_ecss_gen(d, q) == RLC_OK, end);
@@ -722,6 +908,19 @@ static int ecss(void) {
 			TEST_ASSERT(cp_ecss_ver(r, d, m, sizeof(m), q) == 1, end);
 		}
 		TEST_END;
+
+		TEST_BEGIN("ecss with precomputed public key is correct") {
+			TEST_ASSERT(cp_ecss_gen(d, q) == RLC_OK, end);
+			ec_mul_pre(t, q);
+			TEST_ASSERT(cp_ecss_sig(r, d, m, sizeof(m), d) == RLC_OK, end);
+			TEST_ASSERT(cp_ecss_ver_pre(r, d, m, sizeof(m),
+				(const ec_t *)t) == 1, end);
+			m[0] ^= 1;
+			TEST_ASSERT(cp_ecss_ver_pre(r, d, m, sizeof(m),
+				(const ec_t *)t) == 0, end);
+			m[0] ^= 1;
+		}
+		TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -732,6 +931,9 @@ static int ecss(void) {
 	bn_free(d);
 	bn_free(r);
 	ec_free(q);
+	for (int i = 0; i < RLC_EC_TABLE; i++) {
+		ec_free(t[i]);
+	}
 	return code;
 }
 
@@ -742,7 +944,7 @@ static int vbnn(void) {
 	bn_t ska, skb;
 	ec_t pka, pkb;
 	bn_t msk, z, h;
-	ec_t r, mpk;
+	ec_t r, mpk, t[RLC_EC_TABLE];
 
 	uint8_t m[] = "Thrice the brinded cat hath mew'd.";
 
@@ -755,6 +957,9 @@ static int vbnn(void) {
 	ec_null(mpk);
 	bn_null(pka);
 	bn_null(pkb);
+	for (int i = 0; i < RLC_EC_TABLE; i++) {
+		ec_null(t[i]);
+	}
 
 	TRY {
 		bn_new(z);
@@ -766,6 +971,9 @@ static int vbnn(void) {
 		ec_new(mpk);
 		ec_new(pka);
 		ec_new(pkb);
+		for (int i = 0; i < RLC_EC_TABLE; i++) {
+			ec_new(t[i]);
+		}
 
 		TEST_BEGIN("vbnn is correct") {
 			TEST_ASSERT(cp_vbnn_gen(msk, mpk) == RLC_OK, end);
@@ -778,6 +986,16 @@ static int vbnn(void) {
 			TEST_ASSERT(cp_vbnn_ver(r, z, h, ida, sizeof(ida), m, sizeof(m), mpk) == 0, end);
 		}
 		TEST_END;
+
+		TEST_BEGIN("vbnn with precomputed master key is correct") {
+			TEST_ASSERT(cp_vbnn_gen(msk, mpk) == RLC_OK, end);
+			ec_mul_pre(t, mpk);
+			TEST_ASSERT(cp_vbnn_gen_prv(ska, pka, msk, ida, sizeof(ida)) == RLC_OK, end);
+			TEST_ASSERT(cp_vbnn_sig(r, z, h, ida, sizeof(ida), m, sizeof(m), ska, pka) == RLC_OK, end);
+			TEST_ASSERT(cp_vbnn_ver_pre(r, z, h, ida, sizeof(ida), m, sizeof(m), (const ec_t *)t) == 1, end);
+			TEST_ASSERT(cp_vbnn_ver_pre(r, z, h, idb, sizeof(idb), m, sizeof(m), (const ec_t *)t) == 0, end);
+		}
+		TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -793,27 +1011,198 @@ end:
 	ec_free(mpk);
 	ec_free(pka);
 	ec_free(pkb);
+	for (int i = 0; i < RLC_EC_TABLE; i++) {
+		ec_free(t[i]);
+	}
 	return code;
 }
 
 #endif /* WITH_EC */
 
+#if defined(WITH_ED)
+
+/* Test vector 1 from RFC 8032, Section 7.1. */
+#define EDDSA_K		"9D61B19DEFFD5A60BA844AF492EC2CC44449C5697B326919703BAC031CAE7F60"
+#define EDDSA_S		"0B107A8E4341516524BE5B59F0F55BD26BB4F91C70391EC6AC3BA3901582B85F"
+#define EDDSA_Q		"1A5107F7681A02AF2523A6DAF372E10E3A0764C9D3FE4BD5B70AB18201985AD7"
+#define EDDSA_R		"5501492265E073D874D9E5B81E7F87848A826E80CCE2869072AC60C3004356E5"
+
+/**
+ * Compares a point with its RFC 8032 encoding, given as a byte-reversed string.
+ */
+static int eddsa_cmp(const ed_t p, const char *str) {
+	uint8_t e[RLC_FP_BYTES], x[RLC_FP_BYTES], y[RLC_FP_BYTES];
+	bn_t t;
+	ed_t u;
+	int result = 0;
+
+	bn_null(t);
+	ed_null(u);
+
+	TRY {
+		bn_new(t);
+		ed_new(u);
+		bn_read_str(t, str, strlen(str), 16);
+		bn_write_bin(e, RLC_FP_BYTES, t);
+		ed_norm(u, p);
+		fp_write_bin(x, RLC_FP_BYTES, u->x);
+		fp_write_bin(y, RLC_FP_BYTES, u->y);
+		/* The parity of x is stored in the most significant bit. */
+		result = ((e[0] >> 7) == (x[RLC_FP_BYTES - 1] & 1));
+		e[0] &= 0x7F;
+		result &= (memcmp(y, e, RLC_FP_BYTES) == 0);
+	}
+	CATCH_ANY {
+		result = 0;
+	}
+	FINALLY {
+		bn_free(t);
+		ed_free(u);
+	}
+	return result;
+}
+
+static int eddsa(void) {
+	int i, j, code = RLC_ERR;
+	bn_t d, n, s[4];
+	ed_t q[4], r[4];
+	uint8_t k[RLC_FP_BYTES], h[RLC_MD_LEN_SH512], m[4][5], *ms[4];
+	int ls[4];
+
+	bn_null(d);
+	bn_null(n);
+	for (i = 0; i < 4; i++) {
+		bn_null(s[i]);
+		ed_null(q[i]);
+		ed_null(r[i]);
+	}
+
+	TRY {
+		bn_new(d);
+		bn_new(n);
+		for (i = 0; i < 4; i++) {
+			bn_new(s[i]);
+			ed_new(q[i]);
+			ed_new(r[i]);
+			rand_bytes(m[i], sizeof(m[i]));
+			ms[i] = m[i];
+			ls[i] = sizeof(m[i]);
+		}
+
+		TEST_BEGIN("eddsa signature is correct") {
+			TEST_ASSERT(cp_eddsa_gen(k, q[0]) == RLC_OK, end);
+			TEST_ASSERT(cp_eddsa_sig(r[0], s[0], m[0], sizeof(m[0]), k,
+					q[0]) == RLC_OK, end);
+			TEST_ASSERT(cp_eddsa_ver(r[0], s[0], m[0], sizeof(m[0]),
+					q[0]) == 1, end);
+			m[0][0] ^= 1;
+			TEST_ASSERT(cp_eddsa_ver(r[0], s[0], m[0], sizeof(m[0]),
+					q[0]) == 0, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("eddsa signature matches test vector") {
+			/* Derive the public key from the private key by hand. */
+			bn_read_str(d, EDDSA_K, strlen(EDDSA_K), 16);
+			bn_write_bin(k, RLC_FP_BYTES, d);
+			md_map_sh512(h, k, RLC_FP_BYTES);
+			h[0] &= 0xF8;
+			h[RLC_FP_BYTES - 1] &= 0x7F;
+			h[RLC_FP_BYTES - 1] |= 0x40;
+			for (j = 0; j < RLC_FP_BYTES / 2; j++) {
+				uint8_t t = h[j];
+				h[j] = h[RLC_FP_BYTES - 1 - j];
+				h[RLC_FP_BYTES - 1 - j] = t;
+			}
+			bn_read_bin(d, h, RLC_FP_BYTES);
+			ed_curve_get_ord(n);
+			bn_mod(d, d, n);
+			ed_mul_gen(q[0], d);
+			TEST_ASSERT(eddsa_cmp(q[0], EDDSA_Q), end);
+			TEST_ASSERT(cp_eddsa_sig(r[0], s[0], m[0], 0, k, q[0]) == RLC_OK,
+					end);
+			TEST_ASSERT(eddsa_cmp(r[0], EDDSA_R), end);
+			bn_read_str(d, EDDSA_S, strlen(EDDSA_S), 16);
+			TEST_ASSERT(bn_cmp(s[0], d) == RLC_EQ, end);
+			TEST_ASSERT(cp_eddsa_ver(r[0], s[0], m[0], 0, q[0]) == 1, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("eddsa batch verification is correct") {
+			for (j = 0; j < 4; j++) {
+				TEST_ASSERT(cp_eddsa_gen(k, q[j]) == RLC_OK, end);
+				TEST_ASSERT(cp_eddsa_sig(r[j], s[j], m[j], sizeof(m[j]), k,
+						q[j]) == RLC_OK, end);
+			}
+			TEST_ASSERT(cp_eddsa_ver_sim(r, s, ms, ls, q, 4) == 1, end);
+			m[2][0] ^= 1;
+			TEST_ASSERT(cp_eddsa_ver_sim(r, s, ms, ls, q, 4) == 0, end);
+			m[2][0] ^= 1;
+			bn_add_dig(s[3], s[3], 1);
+			TEST_ASSERT(cp_eddsa_ver_sim(r, s, ms, ls, q, 4) == 0, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("eddsa verifications agree on small-order components") {
+			/* Add the point (0, -1) of order 2 to the public key. */
+			ed_set_infty(r[1]);
+			fp_neg(r[1]->y, r[1]->y);
+			ed_norm(r[1], r[1]);
+			TEST_ASSERT(cp_eddsa_gen(k, q[0]) == RLC_OK, end);
+			ed_add(q[0], q[0], r[1]);
+			ed_norm(q[0], q[0]);
+			TEST_ASSERT(cp_eddsa_sig(r[0], s[0], m[0], sizeof(m[0]), k,
+					q[0]) == RLC_OK, end);
+			TEST_ASSERT(cp_eddsa_ver(r[0], s[0], m[0], sizeof(m[0]),
+					q[0]) == 1, end);
+			TEST_ASSERT(cp_eddsa_ver_sim(r, s, ms, ls, q, 1) == 1, end);
+			/* A commitment with a small-order component fails both. */
+			ed_add(r[0], r[0], r[1]);
+			ed_norm(r[0], r[0]);
+			TEST_ASSERT(cp_eddsa_ver(r[0], s[0], m[0], sizeof(m[0]),
+					q[0]) == 0, end);
+			TEST_ASSERT(cp_eddsa_ver_sim(r, s, ms, ls, q, 1) == 0, end);
+		}
+		TEST_END;
+	}
+	CATCH_ANY {
+		ERROR(end);
+	}
+	code = RLC_OK;
+
+  end:
+	bn_free(d);
+	bn_free(n);
+	for (i = 0; i < 4; i++) {
+		bn_free(s[i]);
+		ed_free(q[i]);
+		ed_free(r[i]);
+	}
+	return code;
+}
+
+#endif /* WITH_ED */
+
 #if defined(WITH_PC)
 
 static int sokaka(void) {
 	int code = RLC_ERR, l = RLC_MD_LEN;
 	sokaka_t k;
 	bn_t s;
+	idc_t c;
 	uint8_t k1[RLC_MD_LEN], k2[RLC_MD_LEN];
 	char ia[5] = { 'A', 'l', 'i', 'c', 'e' };
 	char ib[3] = { 'B', 'o', 'b' };
+	char ic[5] = { 'C', 'a', 'r', 'o', 'l' };
 
 	sokaka_null(k);
 	bn_null(s);
+	idc_null(c);
 
 	TRY {
 		sokaka_new(k);
 		bn_new(s);
+		idc_new(c, 1);
 
 		cp_sokaka_gen(s);
 
@@ -827,6 +1216,39 @@ static int sokaka(void) {
 			TEST_ASSERT(memcmp(k1, k2, l) == 0, end);
 		} TEST_END;
 
+		TEST_BEGIN("key agreement with cached identity pairings is correct") {
+			TEST_ASSERT(cp_sokaka_gen_prv(k, ia, 5, s) == RLC_OK, end);
+			TEST_ASSERT(cp_sokaka_key(k1, l, ia, 5, k, ib, 3) == RLC_OK, end);
+			cp_idc_clean(c);
+			cp_idc_make(c, 1);
+			TEST_ASSERT(cp_sokaka_key_pre(k2, l, ia, 5, k, ib, 3, c) == RLC_OK,
+				end);
+			TEST_ASSERT(memcmp(k1, k2, l) == 0, end);
+			memset(k2, 0, l);
+			TEST_ASSERT(cp_sokaka_key_pre(k2, l, ia, 5, k, ib, 3, c) == RLC_OK,
+				end);
+			TEST_ASSERT(memcmp(k1, k2, l) == 0, end);
+			/* With a single entry, a new identity evicts the cached one. */
+			TEST_ASSERT(cp_sokaka_key_pre(k2, l, ia, 5, k, ic, 5, c) == RLC_OK,
+				end);
+			TEST_ASSERT(memcmp(k1, k2, l) != 0, end);
+			TEST_ASSERT(cp_sokaka_key_pre(k2, l, ia, 5, k, ib, 3, c) == RLC_OK,
+				end);
+			TEST_ASSERT(memcmp(k1, k2, l) == 0, end);
+			TEST_ASSERT(c->len == 1 && c->hits == 1 && c->miss == 3, end);
+		} TEST_END;
+
+		TEST_ONCE("identity pairing caches are bound to a private key") {
+			cp_idc_clean(c);
+			cp_idc_make(c, 1);
+			TEST_ASSERT(cp_sokaka_gen_prv(k, ia, 5, s) == RLC_OK, end);
+			TEST_ASSERT(cp_sokaka_key_pre(k2, l, ia, 5, k, ib, 3, c) == RLC_OK,
+				end);
+			TEST_ASSERT(cp_sokaka_gen_prv(k, ic, 5, s) == RLC_OK, end);
+			TEST_ASSERT(cp_sokaka_key_pre(k2, l, ic, 5, k, ib, 3, c) == RLC_ERR,
+				end);
+		} TEST_END;
+
 	} CATCH_ANY {
 		ERROR(end);
 	}
@@ -835,6 +1257,7 @@ static int sokaka(void) {
   end:
 	sokaka_free(k);
 	bn_free(s);
+	idc_free(c);
 	return code;
 }
 
@@ -845,17 +1268,21 @@ static int ibe(void) {
 	g2_t prv;
 	uint8_t in[10], out[10 + 2 * RLC_FP_BYTES + 1];
 	char id[5] = { 'A', 'l', 'i', 'c', 'e' };
+	char ids[3][5] = { "Alice", "Bob", "Carol" };
 	int il, ol;
 	int result;
+	idc_t c;
 
 	bn_null(s);
 	g1_null(pub);
 	g2_null(prv);
+	idc_null(c);
 
 	TRY {
 		bn_new(s);
 		g1_new(pub);
 		g2_new(prv);
+		idc_new(c, 2);
 
 		result = cp_ibe_gen(s, pub);
 
@@ -869,6 +1296,36 @@ static int ibe(void) {
 			TEST_ASSERT(cp_ibe_dec(out, &il, out, ol, prv) == RLC_OK, end);
 			TEST_ASSERT(memcmp(in, out, il) == 0, end);
 		} TEST_END;
+
+		TEST_BEGIN("identity-based encryption with cached pairings is correct") {
+			cp_idc_clean(c);
+			cp_idc_make(c, 2);
+			for (int j = 0; j < 6; j++) {
+				/* Carol evicts Bob, the least recently used identity. */
+				char *u = ids[j % 2 == 0 ? 0 : (j < 3 ? 1 : 2)];
+				il = 10;
+				ol = il + 1 + 2 * RLC_FP_BYTES;
+				rand_bytes(in, il);
+				TEST_ASSERT(cp_ibe_gen_prv(prv, u, 5, s) == RLC_OK, end);
+				TEST_ASSERT(cp_ibe_enc_pre(out, &ol, in, il, u, 5, pub, c) ==
+					RLC_OK, end);
+				TEST_ASSERT(cp_ibe_dec(out, &il, out, ol, prv) == RLC_OK, end);
+				TEST_ASSERT(memcmp(in, out, il) == 0, end);
+			}
+			TEST_ASSERT(c->len == 2 && c->hits == 3 && c->miss == 3, end);
+		} TEST_END;
+
+		TEST_ONCE("identity pairing caches are bound to a public key") {
+			il = 10;
+			rand_bytes(in, il);
+			ol = il + 1 + 2 * RLC_FP_BYTES;
+			TEST_ASSERT(cp_ibe_enc_pre(out, &ol, in, il, ids[0], 5, pub, c) ==
+				RLC_OK, end);
+			TEST_ASSERT(cp_ibe_gen(s, pub) == RLC_OK, end);
+			ol = il + 1 + 2 * RLC_FP_BYTES;
+			TEST_ASSERT(cp_ibe_enc_pre(out, &ol, in, il, ids[0], 5, pub, c) ==
+				RLC_ERR, end);
+		} TEST_END;
 	} CATCH_ANY {
 		ERROR(end);
 	}
@@ -878,15 +1335,18 @@ static int ibe(void) {
 	bn_free(s);
 	g1_free(pub);
 	g2_free(prv);
+	idc_free(c);
 	return code;
 }
 
 static int bgn(void) {
-	int result, code = RLC_ERR;
+	int result, hits, miss, code = RLC_ERR;
 	g1_t c[2], d[2];
 	g2_t e[2], f[2];
 	gt_t g[4];
 	bgn_t pub, prv;
+	pc_dlog_t t1, t2, tt;
+	bgn_pool_t pool;
 	dig_t in, out, t;
 
 	g1_null(c[0]);
@@ -899,6 +1359,10 @@ static int bgn(void) {
 	g2_null(f[1]);
 	bgn_null(pub);
 	bgn_null(prv);
+	pc_dlog_null(t1);
+	pc_dlog_null(t2);
+	pc_dlog_null(tt);
+	bgn_pool_null(pool);
 
 	TRY {
 		g1_new(c[0]);
@@ -915,6 +1379,10 @@ static int bgn(void) {
 			gt_null(g[i]);
 			gt_new(g[i]);
 		}
+		pc_dlog_new(t1, 64);
+		pc_dlog_new(t2, 64);
+		pc_dlog_new(tt, 64);
+		bgn_pool_new(pool, 2);
 
 		result = cp_bgn_gen(pub, prv);
 
@@ -969,6 +1437,51 @@ static int bgn(void) {
 			TEST_ASSERT(in + in == t, end);
 		} TEST_END;
 
+		TEST_BEGIN("boneh-go-nissim decryption with baby-step tables is correct") {
+			TEST_ASSERT(cp_bgn_tab1(t1, prv) == RLC_OK, end);
+			TEST_ASSERT(cp_bgn_tab2(t2, prv) == RLC_OK, end);
+			TEST_ASSERT(cp_bgn_tab(tt, prv) == RLC_OK, end);
+			rand_bytes((unsigned char *)&in, sizeof(dig_t));
+			in = in % 1024;
+			out = in % 3;
+			TEST_ASSERT(cp_bgn_enc1(c, in, pub) == RLC_OK, end);
+			TEST_ASSERT(cp_bgn_dec1_tab(&t, c, prv, t1, 4096) == RLC_OK, end);
+			TEST_ASSERT(in == t, end);
+			TEST_ASSERT(cp_bgn_dec1_tab(&t, c, prv, t1, in) == RLC_ERR, end);
+			TEST_ASSERT(cp_bgn_enc2(e, out, pub) == RLC_OK, end);
+			TEST_ASSERT(cp_bgn_dec2_tab(&t, e, prv, t2, 4096) == RLC_OK, end);
+			TEST_ASSERT(out == t, end);
+			TEST_ASSERT(cp_bgn_mul(g, c, e) == RLC_OK, end);
+			TEST_ASSERT(cp_bgn_dec_tab(&t, g, prv, tt, 4096) == RLC_OK, end);
+			TEST_ASSERT(in * out == t, end);
+		} TEST_END;
+
+		TEST_BEGIN("boneh-go-nissim encryption with randomizer pools is correct") {
+			TEST_ASSERT(cp_bgn_pre(pool, pub) == RLC_OK, end);
+			TEST_ASSERT(pool->len1 == 2 && pool->len2 == 2, end);
+			hits = pool->hits;
+			miss = pool->miss;
+			rand_bytes((unsigned char *)&in, sizeof(dig_t));
+			in = in % 11;
+			for (int j = 0; j < 3; j++) {
+				TEST_ASSERT(cp_bgn_enc1_pre(c, in, pub, pool) == RLC_OK, end);
+				TEST_ASSERT(cp_bgn_dec1(&out, c, prv) == RLC_OK, end);
+				TEST_ASSERT(in == out, end);
+				TEST_ASSERT(cp_bgn_enc2_pre(e, in, pub, pool) == RLC_OK, end);
+				TEST_ASSERT(cp_bgn_dec2(&out, e, prv) == RLC_OK, end);
+				TEST_ASSERT(in == out, end);
+			}
+			TEST_ASSERT(pool->hits == hits + 4 && pool->miss == miss + 2, end);
+			/* The pool must not be used with a different key. */
+			g1_copy(d[0], pub->gx);
+			g1_dbl(pub->gx, pub->gx);
+			g1_norm(pub->gx, pub->gx);
+			TEST_ASSERT(cp_bgn_pre(pool, pub) == RLC_ERR, end);
+			TEST_ASSERT(cp_bgn_enc1_pre(c, in, pub, pool) == RLC_ERR, end);
+			TEST_ASSERT(cp_bgn_enc2_pre(e, in, pub, pool) == RLC_ERR, end);
+			g1_copy(pub->gx, d[0]);
+		} TEST_END;
+
 	} CATCH_ANY {
 		ERROR(end);
 	}
@@ -988,6 +1501,10 @@ static int bgn(void) {
 	for (int i = 0; i < 4; i++) {
 		gt_free(g[i]);
 	}
+	pc_dlog_free(t1);
+	pc_dlog_free(t2);
+	pc_dlog_free(tt);
+	bgn_pool_free(pool);
 	return code;
 }
 
@@ -1147,6 +1664,19 @@ static int cls(void) {
 			TEST_ASSERT(cp_clb_gen(t, u, vs, x, y, zs, 5) == RLC_OK, end);
 			TEST_ASSERT(cp_clb_sig(a, As, b, Bs, c, msgs, lens, t, u, vs, 5) == RLC_OK, end);
 			TEST_ASSERT(cp_clb_ver(a, As, b, Bs, c, msgs, lens, x, y, zs, 5) == 1, end);
+			/* Check adversarial signatures. */
+			lens[2] = sizeof(m) - 1;
+			TEST_ASSERT(cp_clb_ver(a, As, b, Bs, c, msgs, lens, x, y, zs, 5) == 0, end);
+			lens[2] = sizeof(m);
+			g1_copy(B, Bs[1]);
+			g1_copy(Bs[1], Bs[2]);
+			TEST_ASSERT(cp_clb_ver(a, As, b, Bs, c, msgs, lens, x, y, zs, 5) == 0, end);
+			g1_copy(Bs[1], B);
+			g1_copy(A, As[3]);
+			g1_copy(As[3], a);
+			TEST_ASSERT(cp_clb_ver(a, As, b, Bs, c, msgs, lens, x, y, zs, 5) == 0, end);
+			g1_copy(As[3], A);
+			TEST_ASSERT(cp_clb_ver(a, As, b, Bs, c, msgs, lens, x, y, zs, 5) == 1, end);
 		}
 		TEST_END;
 	}
@@ -1180,11 +1710,13 @@ static int cls(void) {
 static int pss(void) {
 	int i, code = RLC_ERR;
 	bn_t u, v, _v[5];
-	g1_t a, b;
+	g1_t a, b, as[3], bs[3];
 	g2_t g, x, y, _y[5];
 	uint8_t m[5] = { 0, 1, 2, 3, 4 };
 	uint8_t *msgs[5] = {m, m, m, m, m};
 	int lens[5] = {sizeof(m), sizeof(m), sizeof(m), sizeof(m), sizeof(m)};
+	uint8_t *ms[3] = {m, m, m}, **bms[3] = {msgs, msgs, msgs};
+	int ls[3] = {sizeof(m), sizeof(m), sizeof(m)}, *bls[3] = {lens, lens, lens};
 
 	bn_null(u);
 	bn_null(v);
@@ -1197,6 +1729,10 @@ static int pss(void) {
 		bn_null(_v[i]);
 		g2_null(_y[i]);
 	}
+	for (i = 0; i < 3; i++) {
+		g1_null(as[i]);
+		g1_null(bs[i]);
+	}
 
 	TRY {
 		bn_new(u);
@@ -1210,6 +1746,10 @@ static int pss(void) {
 			bn_new(_v[i]);
 			g2_new(_y[i]);
 		}
+		for (i = 0; i < 3; i++) {
+			g1_new(as[i]);
+			g1_new(bs[i]);
+		}
 
 		TEST_BEGIN("pointcheval-sanders simple signature is correct") {
 			TEST_ASSERT(cp_pss_gen(u, v, g, x, y) == RLC_OK, end);
@@ -1228,6 +1768,32 @@ static int pss(void) {
 			TEST_ASSERT(cp_psb_ver(a, b, msgs, lens, g, x, _y, 5) == 1, end);
 		}
 		TEST_END;
+
+		TEST_BEGIN("pointcheval-sanders batch verification is correct") {
+			TEST_ASSERT(cp_pss_gen(u, v, g, x, y) == RLC_OK, end);
+			for (int j = 0; j < 3; j++) {
+				m[0] = j;
+				TEST_ASSERT(cp_pss_sig(as[j], bs[j], m, sizeof(m), u, v) == RLC_OK, end);
+			}
+			m[0] = 0;
+			TEST_ASSERT(cp_pss_ver_sim(as, bs, ms, ls, g, x, y, 3) == 0, end);
+			for (int j = 0; j < 3; j++) {
+				TEST_ASSERT(cp_pss_sig(as[j], bs[j], m, sizeof(m), u, v) == RLC_OK, end);
+			}
+			TEST_ASSERT(cp_pss_ver_sim(as, bs, ms, ls, g, x, y, 3) == 1, end);
+			g1_copy(bs[1], bs[0]);
+			TEST_ASSERT(cp_pss_ver_sim(as, bs, ms, ls, g, x, y, 3) == 0, end);
+			TEST_ASSERT(cp_psb_gen(u, _v, g, x, _y, 5) == RLC_OK, end);
+			for (int j = 0; j < 3; j++) {
+				TEST_ASSERT(cp_psb_sig(as[j], bs[j], msgs, lens, u, _v, 5) == RLC_OK, end);
+			}
+			TEST_ASSERT(cp_psb_ver_sim(as, bs, bms, bls, g, x, _y, 5, 3) == 1, end);
+			g1_copy(bs[2], bs[0]);
+			TEST_ASSERT(cp_psb_ver_sim(as, bs, bms, bls, g, x, _y, 5, 3) == 0, end);
+			g1_set_infty(as[0]);
+			TEST_ASSERT(cp_psb_ver_sim(as, bs, bms, bls, g, x, _y, 5, 3) == 0, end);
+		}
+		TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -1246,6 +1812,10 @@ static int pss(void) {
 		bn_free(_v[i]);
 		g2_free(_y[i]);
 	}
+	for (i = 0; i < 3; i++) {
+		g1_free(as[i]);
+		g1_free(bs[i]);
+	}
   	return code;
 }
 
@@ -1298,7 +1868,7 @@ static int zss(void) {
 static int lhs(void) {
 	int code = RLC_ERR;
 	uint8_t k[S][K];
-	bn_t m, n, msg[S][L], sk[S], d[S], x[S][L];
+	bn_t m, n, msg[S][L], sk[S], d[S], x[S][L], e[S][L], *_e[S];
 	g1_t _r, h, as[S], cs[S], sig[S];
 	g1_t a[S][L], c[S][L], r[S][L];
 	g2_t _s, s[S][L], pk[S], y[S], z[S];
@@ -1327,12 +1897,14 @@ static int lhs(void) {
 			for (int j = 0; j < L; j++) {
 				bn_null(x[i][j]);
 				bn_null(msg[i][j]);
+				bn_null(e[i][j]);
 				g1_null(a[i][j]);
 				g1_null(c[i][j]);
 				g1_null(r[i][j]);
 				g2_null(s[i][j]);
 				bn_new(x[i][j]);
 				bn_new(msg[i][j]);
+				bn_new(e[i][j]);
 				g1_new(a[i][j]);
 				g1_new(c[i][j]);
 				g1_new(r[i][j]);
@@ -1408,6 +1980,13 @@ static int lhs(void) {
 			}
 			TEST_ASSERT(cp_cmlhs_ver(_r, _s, sig, z, as, cs, m, id,
 				sizeof(id), label, h, hs, f, flen, y, pk, S) == 1, end);
+			g1_neg(_r, _r);
+			TEST_ASSERT(cp_cmlhs_ver(_r, _s, sig, z, as, cs, m, id,
+				sizeof(id), label, h, hs, f, flen, y, pk, S) == 0, end);
+			g1_neg(_r, _r);
+			g1_neg(sig[0], sig[0]);
+			TEST_ASSERT(cp_cmlhs_ver(_r, _s, sig, z, as, cs, m, id,
+				sizeof(id), label, h, hs, f, flen, y, pk, S) == 0, end);
 		}
 		TEST_END;
 
@@ -1445,6 +2024,41 @@ static int lhs(void) {
 
 			TEST_ASSERT(cp_mklhs_ver(_r, m, d, ls, lens, f, flen, pk, S) == 1,
 				end);
+			g1_neg(_r, _r);
+			TEST_ASSERT(cp_mklhs_ver(_r, m, d, ls, lens, f, flen, pk, S) == 0,
+				end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("multi-key homomorphic signature with large weights is correct") {
+			for (int j = 0; j < S; j++) {
+				cp_mklhs_gen(sk[j], pk[j]);
+				for (int l = 0; l < L; l++) {
+					bn_rand_mod(msg[j][l], n);
+					bn_rand_mod(e[j][l], n);
+					cp_mklhs_sig(a[j][l], msg[j][l], ls[l], lens[l], sk[j]);
+				}
+				_e[j] = e[j];
+				cp_mklhs_fun_lot(d[j], msg[j], e[j], L);
+			}
+
+			g1_set_infty(_r);
+			bn_zero(m);
+			for (int j = 0; j < S; j++) {
+				cp_mklhs_evl_lot(r[0][j], a[j], e[j], L);
+				g1_add(_r, _r, r[0][j]);
+				bn_add(m, m, d[j]);
+				bn_mod(m, m, n);
+			}
+			g1_norm(_r, _r);
+
+			TEST_ASSERT(cp_mklhs_ver_lot(_r, m, d, ls, lens, _e, flen, pk,
+				S) == 1, end);
+			/* Moving a message between users keeps the sum but not the tag. */
+			bn_add_dig(d[0], d[0], 1);
+			bn_sub_dig(d[1], d[1], 1);
+			TEST_ASSERT(cp_mklhs_ver_lot(_r, m, d, ls, lens, _e, flen, pk,
+				S) == 0, end);
 		}
 		TEST_END;
 	}
@@ -1467,6 +2081,7 @@ static int lhs(void) {
 		  for (int j = 0; j < L; j++) {
 			  bn_free(x[i][j]);
 			  bn_free(msg[i][j]);
+			  bn_free(e[i][j]);
 			  g1_free(a[i][j]);
 			  g1_free(c[i][j]);
 			  g1_free(r[i][j]);
@@ -1612,6 +2227,18 @@ int main(void) {
 	}
 #endif
 
+#if defined(WITH_ED)
+	util_banner("Protocols based on Edwards curves:\n", 0);
+	if (ed_param_set_any() == RLC_OK) {
+		if (eddsa() != RLC_OK) {
+			core_clean();
+			return 1;
+		}
+	} else {
+		THROW(ERR_NO_CURVE);
+	}
+#endif
+
 	util_banner("All tests have passed.\n", 0);
 
 	core_clean();
@@ -825,8 +825,8 @@ static int fixed(void) {
 
 static int simultaneous(void) {
 	int code = RLC_ERR;
-	bn_t n, k, l;
-	ed_t p, q, r;
+	bn_t n, k, l, m[4];
+	ed_t p, q, r, t[4];
 
 	bn_null(n);
 	bn_null(k);
@@ -834,6 +834,10 @@ static int simultaneous(void) {
 	ed_null(p);
 	ed_null(q);
 	ed_null(r);
+	for (int i = 0; i < 4; i++) {
+		bn_null(m[i]);
+		ed_null(t[i]);
+	}
 
 	TRY {
 		bn_new(n);
@@ -842,6 +846,10 @@ static int simultaneous(void) {
 		ed_new(p);
 		ed_new(q);
 		ed_new(r);
+		for (int i = 0; i < 4; i++) {
+			bn_new(m[i]);
+			ed_new(t[i]);
+		}
 
 		ed_curve_get_gen(p);
 		ed_curve_get_ord(n);
@@ -1052,6 +1060,28 @@ static int simultaneous(void) {
 			ed_mul_sim(q, p, k, q, l);
 			TEST_ASSERT(ed_cmp(q, r) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("simultaneous multiplication of many points is correct") {
+			ed_set_infty(q);
+			for (int i = 0; i < 4; i++) {
+				bn_rand_mod(m[i], n);
+				ed_rand(t[i]);
+				if (i == 1) {
+					bn_neg(m[i], m[i]);
+				}
+				if (i == 2) {
+					bn_rand(m[i], RLC_POS, 128);
+				}
+				ed_mul(r, t[i], m[i]);
+				ed_add(q, q, r);
+			}
+			ed_mul_sim_lot(r, (const ed_t *)t, (const bn_t *)m, 4);
+			TEST_ASSERT(ed_cmp(q, r) == RLC_EQ, end);
+			bn_zero(m[3]);
+			ed_mul_sim_lot(q, (const ed_t *)t, (const bn_t *)m, 3);
+			ed_mul_sim_lot(r, (const ed_t *)t, (const bn_t *)m, 4);
+			TEST_ASSERT(ed_cmp(q, r) == RLC_EQ, end);
+		} TEST_END;
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1065,6 +1095,10 @@ static int simultaneous(void) {
 	ed_free(p);
 	ed_free(q);
 	ed_free(r);
+	for (int i = 0; i < 4; i++) {
+		bn_free(m[i]);
+		ed_free(t[i]);
+	}
 	return code;
 }
 
@@ -169,13 +169,18 @@ int util(void) {
 
 int addition(void) {
 	int code = RLC_ERR;
-	ep_t a, b, c, d, e;
+	ep_t a, b, c, d, e, p[4], q[4], r[4];
 
 	ep_null(a);
 	ep_null(b);
 	ep_null(c);
 	ep_null(d);
 	ep_null(e);
+	for (int i = 0; i < 4; i++) {
+		ep_null(p[i]);
+		ep_null(q[i]);
+		ep_null(r[i]);
+	}
 
 	TRY {
 		ep_new(a);
@@ -183,6 +188,11 @@ int addition(void) {
 		ep_new(c);
 		ep_new(d);
 		ep_new(e);
+		for (int i = 0; i < 4; i++) {
+			ep_new(p[i]);
+			ep_new(q[i]);
+			ep_new(r[i]);
+		}
 
 		TEST_BEGIN("point addition is commutative") {
 			ep_rand(a);
@@ -281,6 +291,30 @@ int addition(void) {
 		} TEST_END;
 #endif
 
+		TEST_BEGIN("simultaneous point addition is correct") {
+			for (int i = 0; i < 4; i++) {
+				ep_rand(p[i]);
+				ep_rand(q[i]);
+			}
+			/* Cover doubling, inverses and the point at infinity. */
+			ep_copy(q[1], p[1]);
+			ep_neg(q[2], p[2]);
+			ep_set_infty(p[3]);
+			ep_add_sim(r, (const ep_t *)p, (const ep_t *)q, 4);
+			for (int i = 0; i < 4; i++) {
+				ep_add(d, p[i], q[i]);
+				ep_norm(d, d);
+				TEST_ASSERT(ep_cmp(r[i], d) == RLC_EQ, end);
+			}
+			ep_add_sim(p, (const ep_t *)p, (const ep_t *)q, 4);
+			for (int i = 0; i < 4; i++) {
+				TEST_ASSERT(ep_cmp(p[i], r[i]) == RLC_EQ, end);
+			}
+			/* An empty batch must leave the outputs untouched. */
+			ep_copy(d, r[0]);
+			ep_add_sim(r, (const ep_t *)p, (const ep_t *)q, 0);
+			TEST_ASSERT(ep_cmp(r[0], d) == RLC_EQ, end);
+		} TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -292,6 +326,11 @@ int addition(void) {
 	ep_free(c);
 	ep_free(d);
 	ep_free(e);
+	for (int i = 0; i < 4; i++) {
+		ep_free(p[i]);
+		ep_free(q[i]);
+		ep_free(r[i]);
+	}
 	return code;
 }
 
@@ -815,6 +854,89 @@ static int fixed(void) {
 			ep_free(t[i]);
 		}
 #endif
+
+		TEST_BEGIN("runtime-depth fixed point multiplication is correct") {
+			ep_pre_t u;
+			uint8_t *bin;
+			int len;
+
+			ep_pre_null(u);
+			for (int d = 1; d <= 6; d++) {
+				ep_pre_new(u, d);
+				ep_rand(p);
+				ep_mul_pre_dynam(u, p);
+				bn_zero(k);
+				ep_mul_fix_dynam(r, u, k);
+				TEST_ASSERT(ep_is_infty(r), end);
+				bn_set_dig(k, 1);
+				ep_mul_fix_dynam(r, u, k);
+				TEST_ASSERT(ep_cmp(p, r) == RLC_EQ, end);
+				bn_rand_mod(k, n);
+				ep_mul(r, p, k);
+				ep_mul_fix_dynam(q, u, k);
+				TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+				bn_neg(k, k);
+				ep_mul_fix_dynam(r, u, k);
+				ep_neg(r, r);
+				TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+				TEST_ASSERT(ep_pre_mem(u) >= (int)((1 << d) * sizeof(ep_t)), end);
+				for (int j = 0; j < 2; j++) {
+					len = ep_pre_size_bin(u, j);
+					bin = RLC_ALLOCA(uint8_t, len);
+					ep_pre_write_bin(bin, len, u, j);
+					ep_pre_free(u);
+					ep_pre_new(u, 1);
+					ep_pre_read_bin(u, bin, len);
+					RLC_FREE(bin);
+					TEST_ASSERT(u->depth == d, end);
+					bn_rand_mod(k, n);
+					ep_mul(r, p, k);
+					ep_mul_fix_dynam(q, u, k);
+					TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+				}
+				ep_pre_free(u);
+			}
+		} TEST_END;
+
+		if (ep_curve_size_pre() > 0) {
+			TEST_BEGIN("persisted generator table is correct") {
+				int len = ep_curve_size_pre(), param = ep_param_get();
+				uint8_t *bin = RLC_ALLOCA(uint8_t, len);
+				const uint8_t *tab = bin + RLC_EP_PRE_HDR + sizeof(ep_st);
+
+				ep_curve_write_pre(bin, len);
+				TEST_ASSERT(ep_curve_map_pre(bin, len) == RLC_OK, end);
+				TEST_ASSERT((const uint8_t *)ep_curve_get_tab() == tab, end);
+				bn_rand_mod(k, n);
+				ep_curve_get_gen(p);
+				ep_mul(r, p, k);
+				ep_mul_gen(q, k);
+				TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+				ep_param_set(ep_param_get());
+				TEST_ASSERT((const uint8_t *)ep_curve_get_tab() == tab, end);
+				ep_mul_gen(q, k);
+				TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+				TEST_ASSERT(ep_curve_map_pre(NULL, 0) == RLC_OK, end);
+				TEST_ASSERT((const uint8_t *)ep_curve_get_tab() != tab, end);
+				ep_mul_gen(q, k);
+				TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+				/* Register the table before the module is set up. */
+				core_clean();
+				core_init_with(0);
+				TEST_ASSERT(ep_curve_map_pre(bin, len) == RLC_OK, end);
+				ep_param_set(param);
+				TEST_ASSERT((const uint8_t *)ep_curve_get_tab() == tab, end);
+				ep_mul_gen(q, k);
+				TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+				TEST_ASSERT(ep_curve_map_pre(NULL, 0) == RLC_OK, end);
+				bin[len - 1] ^= 1;
+				TEST_ASSERT(ep_curve_map_pre(bin, len) == RLC_ERR, end);
+				bin[len - 1] ^= 1;
+				bin[4] ^= 1;
+				TEST_ASSERT(ep_curve_map_pre(bin, len) == RLC_ERR, end);
+				RLC_FREE(bin);
+			} TEST_END;
+		}
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -832,8 +954,8 @@ static int fixed(void) {
 
 static int simultaneous(void) {
 	int code = RLC_ERR;
-	bn_t n, k, l;
-	ep_t p, q, r;
+	bn_t n, k, l, m[4], *v = RLC_ALLOCA(bn_t, 1024);
+	ep_t p, q, r, t[4], *u = RLC_ALLOCA(ep_t, 1024);
 
 	bn_null(n);
 	bn_null(k);
@@ -841,14 +963,33 @@ static int simultaneous(void) {
 	ep_null(p);
 	ep_null(q);
 	ep_null(r);
+	for (int i = 0; i < 4; i++) {
+		bn_null(m[i]);
+		ep_null(t[i]);
+	}
+	for (int i = 0; v != NULL && u != NULL && i < 1024; i++) {
+		bn_null(v[i]);
+		ep_null(u[i]);
+	}
 
 	TRY {
+		if (v == NULL || u == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
 		bn_new(n);
 		bn_new(k);
 		bn_new(l);
 		ep_new(p);
 		ep_new(q);
 		ep_new(r);
+		for (int i = 0; i < 4; i++) {
+			bn_new(m[i]);
+			ep_new(t[i]);
+		}
+		for (int i = 0; i < 1024; i++) {
+			bn_new(v[i]);
+			ep_new(u[i]);
+		}
 
 		ep_curve_get_gen(p);
 		ep_curve_get_ord(n);
@@ -1059,6 +1200,65 @@ static int simultaneous(void) {
 			ep_mul_sim(q, p, k, q, l);
 			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("simultaneous multiplication of many points is correct") {
+			ep_set_infty(q);
+			for (int i = 0; i < 4; i++) {
+				bn_rand_mod(m[i], n);
+				ep_rand(t[i]);
+				if (i == 1) {
+					bn_neg(m[i], m[i]);
+				}
+				if (i == 2) {
+					bn_rand(m[i], RLC_POS, 128);
+				}
+				ep_mul(r, t[i], m[i]);
+				ep_add(q, q, r);
+			}
+			ep_norm(q, q);
+			ep_mul_sim_lot(r, (const ep_t *)t, (const bn_t *)m, 4);
+			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+			bn_zero(m[3]);
+			ep_mul_sim_lot(q, (const ep_t *)t, (const bn_t *)m, 3);
+			ep_mul_sim_lot(r, (const ep_t *)t, (const bn_t *)m, 4);
+			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+			ep_set_infty(t[0]);
+			ep_mul_sim_lot(q, (const ep_t *)t + 1, (const bn_t *)m + 1, 2);
+			ep_mul_sim_lot(r, (const ep_t *)t, (const bn_t *)m, 3);
+			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+			/* Scalars wider than the field must not overflow the recoding. */
+			ep_set_infty(q);
+			for (int i = 0; i < 4; i++) {
+				ep_rand(t[i]);
+				bn_rand(m[i], RLC_POS, RLC_FP_BITS + RLC_DIG);
+				bn_mod(k, m[i], n);
+				ep_mul(r, t[i], k);
+				ep_add(q, q, r);
+			}
+			ep_norm(q, q);
+			ep_mul_sim_lot(r, (const ep_t *)t, (const bn_t *)m, 4);
+			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_BEGIN("simultaneous multiplication with buckets is correct") {
+			for (int i = 0; i < 4; i++) {
+				ep_rand(t[i]);
+				bn_zero(m[i]);
+			}
+			/* Repeat points so that many terms can be checked cheaply. */
+			for (int i = 0; i < 1024; i++) {
+				bn_rand_mod(v[i], n);
+				if (i % 3 == 0) {
+					bn_neg(v[i], v[i]);
+				}
+				ep_copy(u[i], t[i % 4]);
+				bn_add(m[i % 4], m[i % 4], v[i]);
+				bn_mod(m[i % 4], m[i % 4], n);
+			}
+			ep_mul_sim_lot(q, (const ep_t *)t, (const bn_t *)m, 4);
+			ep_mul_sim_lot(r, (const ep_t *)u, (const bn_t *)v, 1024);
+			TEST_ASSERT(ep_cmp(q, r) == RLC_EQ, end);
+		} TEST_END;
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1072,6 +1272,16 @@ static int simultaneous(void) {
 	ep_free(p);
 	ep_free(q);
 	ep_free(r);
+	for (int i = 0; i < 4; i++) {
+		bn_free(m[i]);
+		ep_free(t[i]);
+	}
+	for (int i = 0; v != NULL && u != NULL && i < 1024; i++) {
+		bn_free(v[i]);
+		ep_free(u[i]);
+	}
+	RLC_FREE(v);
+	RLC_FREE(u);
 	return code;
 }
 
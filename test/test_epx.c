@@ -182,13 +182,18 @@ int util(void) {
 
 int addition(void) {
 	int code = RLC_ERR;
-	ep2_t a, b, c, d, e;
+	ep2_t a, b, c, d, e, p[4], q[4], r[4];
 
 	ep2_null(a);
 	ep2_null(b);
 	ep2_null(c);
 	ep2_null(d);
 	ep2_null(e);
+	for (int i = 0; i < 4; i++) {
+		ep2_null(p[i]);
+		ep2_null(q[i]);
+		ep2_null(r[i]);
+	}
 
 	TRY {
 		ep2_new(a);
@@ -196,6 +201,11 @@ int addition(void) {
 		ep2_new(c);
 		ep2_new(d);
 		ep2_new(e);
+		for (int i = 0; i < 4; i++) {
+			ep2_new(p[i]);
+			ep2_new(q[i]);
+			ep2_new(r[i]);
+		}
 
 		TEST_BEGIN("point addition is commutative") {
 			ep2_rand(a);
@@ -293,6 +303,30 @@ int addition(void) {
 		} TEST_END;
 #endif
 
+		TEST_BEGIN("simultaneous point addition is correct") {
+			for (int i = 0; i < 4; i++) {
+				ep2_rand(p[i]);
+				ep2_rand(q[i]);
+			}
+			/* Cover doubling, inverses and the point at infinity. */
+			ep2_copy(q[1], p[1]);
+			ep2_neg(q[2], p[2]);
+			ep2_set_infty(p[3]);
+			ep2_add_sim(r, p, q, 4);
+			for (int i = 0; i < 4; i++) {
+				ep2_add(d, p[i], q[i]);
+				ep2_norm(d, d);
+				TEST_ASSERT(ep2_cmp(r[i], d) == RLC_EQ, end);
+			}
+			ep2_add_sim(p, p, q, 4);
+			for (int i = 0; i < 4; i++) {
+				TEST_ASSERT(ep2_cmp(p[i], r[i]) == RLC_EQ, end);
+			}
+			/* An empty batch must leave the outputs untouched. */
+			ep2_copy(d, r[0]);
+			ep2_add_sim(r, p, q, 0);
+			TEST_ASSERT(ep2_cmp(r[0], d) == RLC_EQ, end);
+		} TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -304,6 +338,11 @@ int addition(void) {
 	ep2_free(c);
 	ep2_free(d);
 	ep2_free(e);
+	for (int i = 0; i < 4; i++) {
+		ep2_free(p[i]);
+		ep2_free(q[i]);
+		ep2_free(r[i]);
+	}
 	return code;
 }
 
@@ -804,6 +843,80 @@ static int fixed(void) {
 			ep2_free(t[i]);
 		}
 #endif
+
+		TEST_BEGIN("runtime-depth fixed point multiplication is correct") {
+			ep2_pre_t u;
+			uint8_t *bin;
+			int len;
+
+			ep2_pre_null(u);
+			for (int d = 1; d <= 6; d++) {
+				ep2_pre_new(u, d);
+				ep2_rand(p);
+				ep2_mul_pre_dynam(u, p);
+				bn_zero(k);
+				ep2_mul_fix_dynam(r, u, k);
+				TEST_ASSERT(ep2_is_infty(r), end);
+				bn_set_dig(k, 1);
+				ep2_mul_fix_dynam(r, u, k);
+				TEST_ASSERT(ep2_cmp(p, r) == RLC_EQ, end);
+				bn_rand_mod(k, n);
+				ep2_mul(r, p, k);
+				ep2_mul_fix_dynam(q, u, k);
+				TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
+				bn_neg(k, k);
+				ep2_mul_fix_dynam(r, u, k);
+				ep2_neg(r, r);
+				TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
+				TEST_ASSERT(ep2_pre_mem(u) >= (int)((1 << d) * sizeof(ep2_t)), end);
+				for (int j = 0; j < 2; j++) {
+					len = ep2_pre_size_bin(u, j);
+					bin = RLC_ALLOCA(uint8_t, len);
+					ep2_pre_write_bin(bin, len, u, j);
+					ep2_pre_free(u);
+					ep2_pre_new(u, 1);
+					ep2_pre_read_bin(u, bin, len);
+					RLC_FREE(bin);
+					TEST_ASSERT(u->depth == d, end);
+					bn_rand_mod(k, n);
+					ep2_mul(r, p, k);
+					ep2_mul_fix_dynam(q, u, k);
+					TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
+				}
+				ep2_pre_free(u);
+			}
+		} TEST_END;
+
+		if (ep2_curve_size_pre() > 0) {
+			TEST_BEGIN("persisted generator table is correct") {
+				int len = ep2_curve_size_pre();
+				uint8_t *bin = RLC_ALLOCA(uint8_t, len);
+				const uint8_t *tab = bin + RLC_EP_PRE_HDR + sizeof(ep2_st);
+
+				ep2_curve_write_pre(bin, len);
+				TEST_ASSERT(ep2_curve_map_pre(bin, len) == RLC_OK, end);
+				TEST_ASSERT((const uint8_t *)ep2_curve_get_tab() == tab, end);
+				bn_rand_mod(k, n);
+				ep2_curve_get_gen(p);
+				ep2_mul(r, p, k);
+				ep2_mul_gen(q, k);
+				TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
+				ep_param_set(ep_param_get());
+				TEST_ASSERT((const uint8_t *)ep2_curve_get_tab() == tab, end);
+				ep2_mul_gen(q, k);
+				TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
+				TEST_ASSERT(ep2_curve_map_pre(NULL, 0) == RLC_OK, end);
+				TEST_ASSERT((const uint8_t *)ep2_curve_get_tab() != tab, end);
+				ep2_mul_gen(q, k);
+				TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
+				bin[len - 1] ^= 1;
+				TEST_ASSERT(ep2_curve_map_pre(bin, len) == RLC_ERR, end);
+				bin[len - 1] ^= 1;
+				bin[4] ^= 1;
+				TEST_ASSERT(ep2_curve_map_pre(bin, len) == RLC_ERR, end);
+				RLC_FREE(bin);
+			} TEST_END;
+		}
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -821,8 +934,8 @@ static int fixed(void) {
 
 static int simultaneous(void) {
 	int code = RLC_ERR;
-	bn_t n, k, l;
-	ep2_t p, q, r;
+	bn_t n, k, l, m[4];
+	ep2_t p, q, r, t[4];
 
 	bn_null(n);
 	bn_null(k);
@@ -830,6 +943,10 @@ static int simultaneous(void) {
 	ep2_null(p);
 	ep2_null(q);
 	ep2_null(r);
+	for (int i = 0; i < 4; i++) {
+		bn_null(m[i]);
+		ep2_null(t[i]);
+	}
 
 	TRY {
 		bn_new(n);
@@ -838,6 +955,10 @@ static int simultaneous(void) {
 		ep2_new(p);
 		ep2_new(q);
 		ep2_new(r);
+		for (int i = 0; i < 4; i++) {
+			bn_new(m[i]);
+			ep2_new(t[i]);
+		}
 
 		ep2_curve_get_gen(p);
 		ep2_curve_get_ord(n);
@@ -1048,6 +1169,33 @@ static int simultaneous(void) {
 			ep2_mul_sim(q, p, k, q, l);
 			TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("simultaneous multiplication of many points is correct") {
+			ep2_set_infty(q);
+			for (int i = 0; i < 4; i++) {
+				bn_rand_mod(m[i], n);
+				ep2_rand(t[i]);
+				if (i == 1) {
+					bn_neg(m[i], m[i]);
+				}
+				if (i == 2) {
+					bn_rand(m[i], RLC_POS, 128);
+				}
+				ep2_mul(r, t[i], m[i]);
+				ep2_add(q, q, r);
+			}
+			ep2_norm(q, q);
+			ep2_mul_sim_lot(r, t, (const bn_t *)m, 4);
+			TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
+			bn_zero(m[3]);
+			ep2_mul_sim_lot(q, t, (const bn_t *)m, 3);
+			ep2_mul_sim_lot(r, t, (const bn_t *)m, 4);
+			TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
+			ep2_set_infty(t[0]);
+			ep2_mul_sim_lot(q, t + 1, (const bn_t *)m + 1, 2);
+			ep2_mul_sim_lot(r, t, (const bn_t *)m, 3);
+			TEST_ASSERT(ep2_cmp(q, r) == RLC_EQ, end);
+		} TEST_END;
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1061,6 +1209,10 @@ static int simultaneous(void) {
 	ep2_free(p);
 	ep2_free(q);
 	ep2_free(r);
+	for (int i = 0; i < 4; i++) {
+		bn_free(m[i]);
+		ep2_free(t[i]);
+	}
 	return code;
 }
 
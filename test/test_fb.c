@@ -138,6 +138,43 @@ static int util(void) {
 			TEST_ASSERT(fb_size_str(a, 2) == (1 + fb_bits(a)), end);
 		}
 		TEST_END;
+
+		TEST_BEGIN("shared precomputed tables are consistent") {
+			fb_t c, d;
+			fb_pre_t t;
+
+			fb_null(c);
+			fb_null(d);
+			fb_pre_null(t);
+			fb_new(c);
+			fb_new(d);
+			fb_pre_new(t);
+			TEST_ASSERT(fb_poly_pre_get() != NULL, end);
+			fb_poly_pre_build(t);
+			do {
+				fb_rand(a);
+			} while (fb_is_zero(a));
+			fb_inv(b, a);
+			fb_srt(c, a);
+			fb_poly_pre_set(t);
+			TEST_ASSERT(fb_poly_pre_get() == t, end);
+			fb_inv(d, a);
+			TEST_ASSERT(fb_cmp(b, d) == RLC_EQ, end);
+			fb_srt(d, a);
+			TEST_ASSERT(fb_cmp(c, d) == RLC_EQ, end);
+			if (fb_trc(a) == 0) {
+				fb_slv(c, a);
+				fb_sqr(d, c);
+				fb_add(d, d, c);
+				TEST_ASSERT(fb_cmp(a, d) == RLC_EQ, end);
+			}
+			fb_poly_pre_set(NULL);
+			TEST_ASSERT(fb_poly_pre_get() != t, end);
+			fb_pre_free(t);
+			fb_free(c);
+			fb_free(d);
+		}
+		TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -685,15 +685,27 @@ static int reduction(void) {
 	int code = RLC_ERR;
 	fp_t a, b;
 	dv_t t;
+#ifdef FP_ADX
+	fp_t c;
+	dv_t u;
+#endif
 
 	fp_null(a);
 	fp_null(b);
 	dv_null(t);
+#ifdef FP_ADX
+	fp_null(c);
+	dv_null(u);
+#endif
 
 	TRY {
 		fp_new(a);
 		fp_new(b);
 		dv_new(t);
+#ifdef FP_ADX
+		fp_new(c);
+		dv_new(u);
+#endif
 		dv_zero(t, 2 * RLC_FP_DIGS);
 
 		TEST_BEGIN("modular reduction is correct") {
@@ -733,6 +745,37 @@ static int reduction(void) {
 			TEST_END;
 		}
 #endif
+
+#ifdef FP_ADX
+		if (fp_adx_low()) {
+			TEST_BEGIN("mulx/adx kernels agree with the portable kernels") {
+				fp_rand(a);
+				fp_rand(b);
+				if (i % 2 == 0) {
+					/* Exercise the carry chains with the largest inputs. */
+					fp_set_dig(a, 1);
+					fp_neg(a, a);
+					fp_copy(b, a);
+				}
+				fp_muln_low(t, a, b);
+				fp_adx_low_set(0);
+				fp_muln_low(u, a, b);
+				fp_adx_low_set(1);
+				TEST_ASSERT(dv_cmp(t, u, 2 * RLC_FP_DIGS) == RLC_EQ, end);
+				fp_sqrn_low(t, a);
+				fp_adx_low_set(0);
+				fp_sqrn_low(u, a);
+				fp_adx_low_set(1);
+				TEST_ASSERT(dv_cmp(t, u, 2 * RLC_FP_DIGS) == RLC_EQ, end);
+				dv_copy(u, t, 2 * RLC_FP_DIGS);
+				fp_rdcn_low(b, t);
+				fp_adx_low_set(0);
+				fp_rdcn_low(c, u);
+				fp_adx_low_set(1);
+				TEST_ASSERT(fp_cmp(b, c) == RLC_EQ, end);
+			} TEST_END;
+		}
+#endif
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -742,6 +785,10 @@ static int reduction(void) {
 	fb_free(a);
 	fb_free(b);
 	dv_free(t);
+#ifdef FP_ADX
+	fb_free(c);
+	dv_free(u);
+#endif
 	return code;
 }
 
@@ -1050,6 +1097,123 @@ static int digit(void) {
 	return code;
 }
 
+static int batching(void) {
+	int code = RLC_ERR;
+	fp_t a[40], b[8], c[8], d;
+	fp_x8_t u, v, w;
+
+	for (int i = 0; i < 40; i++) {
+		fp_null(a[i]);
+	}
+	for (int i = 0; i < 8; i++) {
+		fp_null(b[i]);
+		fp_null(c[i]);
+	}
+	fp_null(d);
+
+	TRY {
+		for (int i = 0; i < 40; i++) {
+			fp_new(a[i]);
+		}
+		for (int i = 0; i < 8; i++) {
+			fp_new(b[i]);
+			fp_new(c[i]);
+		}
+		fp_new(d);
+
+		TEST_BEGIN("batch conversion is correct") {
+			for (int i = 0; i < 8; i++) {
+				fp_rand(a[i]);
+			}
+			fp_set_dig(a[0], 0);
+			fp_set_dig(a[1], 1);
+			fp_x8_conv(u, (const fp_t *)a);
+			fp_x8_back(c, u);
+			for (int i = 0; i < 8; i++) {
+				TEST_ASSERT(fp_cmp(c[i], a[i]) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_BEGIN("batch addition is consistent") {
+			for (int i = 0; i < 8; i++) {
+				fp_rand(a[i]);
+				fp_rand(b[i]);
+			}
+			fp_neg(b[0], a[0]);
+			fp_x8_conv(u, (const fp_t *)a);
+			fp_x8_conv(v, (const fp_t *)b);
+			fp_add_x8(w, u, v);
+			fp_x8_back(c, w);
+			for (int i = 0; i < 8; i++) {
+				fp_add(d, a[i], b[i]);
+				TEST_ASSERT(fp_cmp(c[i], d) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+#if FP_MUL == COMBA || !defined(STRIP)
+		TEST_BEGIN("batch multiplication is consistent") {
+			for (int i = 0; i < 8; i++) {
+				fp_rand(a[i]);
+				fp_rand(b[i]);
+			}
+			fp_set_dig(b[0], 0);
+			fp_neg(a[1], a[1]);
+			fp_x8_conv(u, (const fp_t *)a);
+			fp_x8_conv(v, (const fp_t *)b);
+			fp_mul_x8(w, u, v);
+			fp_x8_back(c, w);
+			for (int i = 0; i < 8; i++) {
+				fp_mul_comba(d, a[i], b[i]);
+				TEST_ASSERT(fp_cmp(c[i], d) == RLC_EQ, end);
+			}
+		} TEST_END;
+#endif
+
+		TEST_BEGIN("batch squaring is consistent") {
+			for (int i = 0; i < 8; i++) {
+				fp_rand(a[i]);
+			}
+			fp_prime_conv_dig(a[0], 0);
+			fp_x8_conv(u, (const fp_t *)a);
+			fp_sqr_x8(w, u);
+			fp_x8_back(c, w);
+			for (int i = 0; i < 8; i++) {
+				fp_sqr(d, a[i]);
+				TEST_ASSERT(fp_cmp(c[i], d) == RLC_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_BEGIN("simultaneous inversion of many elements is correct") {
+			for (int i = 0; i < 37; i++) {
+				do {
+					fp_rand(a[i]);
+				} while (fp_is_zero(a[i]));
+			}
+			fp_inv(b[0], a[0]);
+			fp_inv(b[1], a[20]);
+			fp_inv(b[2], a[36]);
+			fp_inv_sim(a, (const fp_t *)a, 37);
+			TEST_ASSERT(fp_cmp(a[0], b[0]) == RLC_EQ &&
+					fp_cmp(a[20], b[1]) == RLC_EQ &&
+					fp_cmp(a[36], b[2]) == RLC_EQ, end);
+		} TEST_END;
+	}
+	CATCH_ANY {
+		ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	for (int i = 0; i < 40; i++) {
+		fp_free(a[i]);
+	}
+	for (int i = 0; i < 8; i++) {
+		fp_free(b[i]);
+		fp_free(c[i]);
+	}
+	fp_free(d);
+	return code;
+}
+
 int main(void) {
 	if (core_init() != RLC_OK) {
 		core_clean();
@@ -1133,6 +1297,11 @@ int main(void) {
 		return 1;
 	}
 
+	if (batching() != RLC_OK) {
+		core_clean();
+		return 1;
+	}
+
 	util_banner("All tests have passed.\n", 0);
 
 	core_clean();
@@ -2422,16 +2422,20 @@ static int squaring6(void) {
 
 static int inversion6(void) {
 	int code = RLC_ERR;
-	fp6_t a, b, c;
+	fp6_t a, b, c, d[2];
 
 	fp6_null(a);
 	fp6_null(b);
 	fp6_null(c);
+	fp6_null(d[0]);
+	fp6_null(d[1]);
 
 	TRY {
 		fp6_new(a);
 		fp6_new(b);
 		fp6_new(c);
+		fp6_new(d[0]);
+		fp6_new(d[1]);
 
 		TEST_BEGIN("inversion is correct") {
 			do {
@@ -2441,6 +2445,20 @@ static int inversion6(void) {
 			fp6_mul(c, a, b);
 			TEST_ASSERT(fp6_cmp_dig(c, 1) == RLC_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("simultaneous inversion is correct") {
+			do {
+				fp6_rand(a);
+				fp6_rand(b);
+			} while (fp6_is_zero(a) || fp6_is_zero(b));
+			fp6_copy(d[0], a);
+			fp6_copy(d[1], b);
+			fp6_inv(a, a);
+			fp6_inv(b, b);
+			fp6_inv_sim(d, d, 2);
+			TEST_ASSERT(fp6_cmp(d[0], a) == RLC_EQ &&
+					fp6_cmp(d[1], b) == RLC_EQ, end);
+		} TEST_END;
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -2451,6 +2469,8 @@ static int inversion6(void) {
 	fp6_free(a);
 	fp6_free(b);
 	fp6_free(c);
+	fp6_free(d[0]);
+	fp6_free(d[1]);
 	return code;
 }
 
@@ -4419,16 +4439,24 @@ static int exponentiation12(void) {
 static int compression12(void) {
 	int code = RLC_ERR;
 	uint8_t bin[12 * RLC_FP_BYTES];
-	fp12_t a, b, c;
+	fp12_t a, b, c, d[2], e[2];
 
 	fp12_null(a);
 	fp12_null(b);
 	fp12_null(c);
+	fp12_null(d[0]);
+	fp12_null(d[1]);
+	fp12_null(e[0]);
+	fp12_null(e[1]);
 
 	TRY {
 		fp12_new(a);
 		fp12_new(b);
 		fp12_new(c);
+		fp12_new(d[0]);
+		fp12_new(d[1]);
+		fp12_new(e[0]);
+		fp12_new(e[1]);
 
 		TEST_BEGIN("compression is consistent") {
 			fp12_rand(a);
@@ -4442,20 +4470,62 @@ static int compression12(void) {
 			TEST_ASSERT(fp12_cmp(a, c) == RLC_EQ, end);
 		} TEST_END;
 
+		TEST_BEGIN("torus-based compression is consistent") {
+			fp12_rand(a);
+			fp12_pck_max(b, a);
+			TEST_ASSERT(fp12_upk_max(c, b) == 1, end);
+			TEST_ASSERT(fp12_cmp(a, c) == RLC_EQ, end);
+			fp12_rand(a);
+			fp12_conv_cyc(a, a);
+			fp12_pck_max(b, a);
+			TEST_ASSERT(fp6_is_zero(b[1]) && fp2_is_zero(b[0][0]), end);
+			TEST_ASSERT(fp12_upk_max(c, b) == 1, end);
+			TEST_ASSERT(fp12_cmp(a, c) == RLC_EQ, end);
+			fp12_set_dig(a, 1);
+			fp12_pck_max(b, a);
+			TEST_ASSERT(fp12_upk_max(c, b) == 1, end);
+			TEST_ASSERT(fp12_cmp(a, c) == RLC_EQ, end);
+		} TEST_END;
+
+		TEST_BEGIN("simultaneous torus-based decompression is correct") {
+			fp12_rand(d[0]);
+			fp12_conv_cyc(d[0], d[0]);
+			fp12_rand(d[1]);
+			fp12_conv_cyc(d[1], d[1]);
+			fp12_pck_max(e[0], d[0]);
+			fp12_pck_max(e[1], d[1]);
+			TEST_ASSERT(fp12_upk_max_sim(e, e, 2) == 1, end);
+			TEST_ASSERT(fp12_cmp(d[0], e[0]) == RLC_EQ &&
+					fp12_cmp(d[1], e[1]) == RLC_EQ, end);
+			fp12_zero(e[0]);
+			fp12_zero(e[1]);
+			fp2_rand(e[1][0][2]);
+			fp12_rand(d[0]);
+			fp12_rand(d[1]);
+			TEST_ASSERT(fp12_upk_max_sim(d, e, 2) == 0, end);
+			TEST_ASSERT(fp12_cmp_dig(d[0], 1) == RLC_EQ &&
+					fp12_cmp_dig(d[1], 1) == RLC_EQ, end);
+		} TEST_END;
+
 		TEST_BEGIN("compression is consistent with reading and writing") {
 			fp12_rand(a);
 			fp12_conv_cyc(a, a);
 			fp12_write_bin(bin, 8 * RLC_FP_BYTES, a, 1);
 			fp12_read_bin(b, bin, 8 * RLC_FP_BYTES);
 			TEST_ASSERT(fp12_cmp(a, b) == RLC_EQ, end);
+			fp12_write_bin(bin, 4 * RLC_FP_BYTES, a, 2);
+			fp12_read_bin(b, bin, 4 * RLC_FP_BYTES);
+			TEST_ASSERT(fp12_cmp(a, b) == RLC_EQ, end);
 		}
 		TEST_END;
 
 		TEST_BEGIN("getting the size of a compressed field element is correct") {
 			fp12_rand(a);
 			TEST_ASSERT(fp12_size_bin(a, 0) == 12 * RLC_FP_BYTES, end);
+			TEST_ASSERT(fp12_size_bin(a, 2) == 12 * RLC_FP_BYTES, end);
 			fp12_conv_cyc(a, a);
 			TEST_ASSERT(fp12_size_bin(a, 1) == 8 * RLC_FP_BYTES, end);
+			TEST_ASSERT(fp12_size_bin(a, 2) == 4 * RLC_FP_BYTES, end);
 		}
 		TEST_END;
 	}
@@ -4468,6 +4538,10 @@ static int compression12(void) {
 	fp12_free(a);
 	fp12_free(b);
 	fp12_free(c);
+	fp12_free(d[0]);
+	fp12_free(d[1]);
+	fp12_free(e[0]);
+	fp12_free(e[1]);
 	return code;
 }
 
@@ -601,6 +601,83 @@ static int hashing1(void) {
 	return code;
 }
 
+static int dlog1(void) {
+	int len, code = RLC_ERR;
+	dig_t k, l;
+	uint8_t *bin = NULL;
+	g1_t a, b, c;
+	pc_dlog_t t, u;
+
+	g1_null(a);
+	g1_null(b);
+	g1_null(c);
+	pc_dlog_null(t);
+	pc_dlog_null(u);
+
+	TRY {
+		g1_new(a);
+		g1_new(b);
+		g1_new(c);
+		pc_dlog_new(t, 256);
+		pc_dlog_new(u, 2);
+
+		g1_rand(a);
+		g1_dlog_tab(t, a);
+
+		TEST_BEGIN("bounded discrete logarithm is correct") {
+			rand_bytes((uint8_t *)&k, sizeof(dig_t));
+			k %= 65536;
+			g1_mul_dig(b, a, k);
+			TEST_ASSERT(g1_dlog(&l, b, a, t, 65536) == RLC_OK, end);
+			TEST_ASSERT(l == k, end);
+			TEST_ASSERT(g1_dlog(&l, b, a, NULL, 65536) == RLC_OK, end);
+			TEST_ASSERT(l == k, end);
+			TEST_ASSERT(g1_dlog(&l, b, a, t, k) == RLC_ERR, end);
+			/* The table must not be used with a different base. */
+			g1_dbl(c, a);
+			TEST_ASSERT(g1_dlog(&l, b, c, t, 65536) == RLC_ERR, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("kangaroo discrete logarithm is correct") {
+			rand_bytes((uint8_t *)&k, sizeof(dig_t));
+			k %= 65536;
+			g1_mul_dig(b, a, k);
+			TEST_ASSERT(g1_dlog_kgr(&l, b, a, 65536) == RLC_OK, end);
+			TEST_ASSERT(l == k, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("reading and writing a baby-step table are correct") {
+			len = pc_dlog_size_bin(t);
+			bin = (uint8_t *)malloc(len);
+			TEST_ASSERT(bin != NULL, end);
+			pc_dlog_write_bin(bin, len, t);
+			pc_dlog_read_bin(u, bin, len);
+			TEST_ASSERT(u->size == t->size, end);
+			rand_bytes((uint8_t *)&k, sizeof(dig_t));
+			k %= 65536;
+			g1_mul_dig(b, a, k);
+			TEST_ASSERT(g1_dlog(&l, b, a, u, 65536) == RLC_OK, end);
+			TEST_ASSERT(l == k, end);
+		}
+		TEST_END;
+
+	}
+	CATCH_ANY {
+		ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	g1_free(a);
+	g1_free(b);
+	g1_free(c);
+	pc_dlog_free(t);
+	pc_dlog_free(u);
+	free(bin);
+	return code;
+}
+
 static int memory2(void) {
 	err_t e;
 	int code = RLC_ERR;
@@ -1168,6 +1245,63 @@ static int hashing2(void) {
 	return code;
 }
 
+static int dlog2(void) {
+	int code = RLC_ERR;
+	dig_t k, l;
+	g2_t a, b, c;
+	pc_dlog_t t;
+
+	g2_null(a);
+	g2_null(b);
+	g2_null(c);
+	pc_dlog_null(t);
+
+	TRY {
+		g2_new(a);
+		g2_new(b);
+		g2_new(c);
+		pc_dlog_new(t, 256);
+
+		g2_rand(a);
+		g2_dlog_tab(t, a);
+
+		TEST_BEGIN("bounded discrete logarithm is correct") {
+			rand_bytes((uint8_t *)&k, sizeof(dig_t));
+			k %= 65536;
+			g2_mul_dig(b, a, k);
+			TEST_ASSERT(g2_dlog(&l, b, a, t, 65536) == RLC_OK, end);
+			TEST_ASSERT(l == k, end);
+			TEST_ASSERT(g2_dlog(&l, b, a, NULL, 65536) == RLC_OK, end);
+			TEST_ASSERT(l == k, end);
+			TEST_ASSERT(g2_dlog(&l, b, a, t, k) == RLC_ERR, end);
+			/* The table must not be used with a different base. */
+			g2_dbl(c, a);
+			TEST_ASSERT(g2_dlog(&l, b, c, t, 65536) == RLC_ERR, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("kangaroo discrete logarithm is correct") {
+			rand_bytes((uint8_t *)&k, sizeof(dig_t));
+			k %= 65536;
+			g2_mul_dig(b, a, k);
+			TEST_ASSERT(g2_dlog_kgr(&l, b, a, 65536) == RLC_OK, end);
+			TEST_ASSERT(l == k, end);
+		}
+		TEST_END;
+
+	}
+	CATCH_ANY {
+		ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	g2_free(a);
+	g2_free(b);
+	g2_free(c);
+	pc_dlog_free(t);
+	return code;
+}
+
 static int memory(void) {
 	err_t e;
 	int code = RLC_ERR;
@@ -1195,17 +1329,22 @@ static int memory(void) {
 }
 
 int util(void) {
-	int code = RLC_ERR;
-	gt_t a, b, c;
+	int l, code = RLC_ERR;
+	gt_t a, b, c, d[2];
+	uint8_t bin[24 * RLC_PC_BYTES];
 
 	gt_null(a);
 	gt_null(b);
 	gt_null(c);
+	gt_null(d[0]);
+	gt_null(d[1]);
 
 	TRY {
 		gt_new(a);
 		gt_new(b);
 		gt_new(c);
+		gt_new(d[0]);
+		gt_new(d[1]);
 
 		TEST_BEGIN("comparison is consistent") {
 			gt_rand(a);
@@ -1251,6 +1390,34 @@ int util(void) {
 			TEST_ASSERT(gt_is_unity(a), end);
 		}
 		TEST_END;
+
+		TEST_BEGIN("reading and writing an element are consistent") {
+			for (int j = 0; j < 3; j++) {
+				if (j > 0 && ep_param_embed() != 12) {
+					break;
+				}
+				gt_rand(a);
+				l = gt_size_bin(a, j);
+				gt_write_bin(bin, l, a, j);
+				gt_read_bin(b, bin, l);
+				TEST_ASSERT(gt_cmp(a, b) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
+
+		TEST_BEGIN("simultaneous reading of elements is consistent") {
+			gt_rand(a);
+			gt_rand(b);
+			l = gt_size_bin(a, 2);
+			if (gt_size_bin(b, 2) == l) {
+				gt_write_bin(bin, l, a, 2);
+				gt_write_bin(bin + l, l, b, 2);
+				gt_read_bin_sim(d, bin, l, 2);
+				TEST_ASSERT(gt_cmp(a, d[0]) == RLC_EQ &&
+						gt_cmp(b, d[1]) == RLC_EQ, end);
+			}
+		}
+		TEST_END;
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1261,6 +1428,8 @@ int util(void) {
 	gt_free(a);
 	gt_free(b);
 	gt_free(c);
+	gt_free(d[0]);
+	gt_free(d[1]);
 	return code;
 }
 
@@ -1576,6 +1745,63 @@ static int pairing(void) {
 	return code;
 }
 
+static int dlog(void) {
+	int code = RLC_ERR;
+	dig_t k, l;
+	gt_t a, b, c;
+	pc_dlog_t t;
+
+	gt_null(a);
+	gt_null(b);
+	gt_null(c);
+	pc_dlog_null(t);
+
+	TRY {
+		gt_new(a);
+		gt_new(b);
+		gt_new(c);
+		pc_dlog_new(t, 256);
+
+		gt_rand(a);
+		gt_dlog_tab(t, a);
+
+		TEST_BEGIN("bounded discrete logarithm is correct") {
+			rand_bytes((uint8_t *)&k, sizeof(dig_t));
+			k %= 65536;
+			gt_exp_dig(b, a, k);
+			TEST_ASSERT(gt_dlog(&l, b, a, t, 65536) == RLC_OK, end);
+			TEST_ASSERT(l == k, end);
+			TEST_ASSERT(gt_dlog(&l, b, a, NULL, 65536) == RLC_OK, end);
+			TEST_ASSERT(l == k, end);
+			TEST_ASSERT(gt_dlog(&l, b, a, t, k) == RLC_ERR, end);
+			/* The table must not be used with a different base. */
+			gt_sqr(c, a);
+			TEST_ASSERT(gt_dlog(&l, b, c, t, 65536) == RLC_ERR, end);
+		}
+		TEST_END;
+
+		TEST_BEGIN("kangaroo discrete logarithm is correct") {
+			rand_bytes((uint8_t *)&k, sizeof(dig_t));
+			k %= 4096;
+			gt_exp_dig(b, a, k);
+			TEST_ASSERT(gt_dlog_kgr(&l, b, a, 4096) == RLC_OK, end);
+			TEST_ASSERT(l == k, end);
+		}
+		TEST_END;
+
+	}
+	CATCH_ANY {
+		ERROR(end);
+	}
+	code = RLC_OK;
+  end:
+	gt_free(a);
+	gt_free(b);
+	gt_free(c);
+	pc_dlog_free(t);
+	return code;
+}
+
 int test1(void) {
 	util_banner("Utilities:", 1);
 
@@ -1622,6 +1848,10 @@ int test1(void) {
 		return RLC_ERR;
 	}
 
+	if (dlog1() != RLC_OK) {
+		return RLC_ERR;
+	}
+
 	return RLC_OK;
 }
 
@@ -1671,6 +1901,10 @@ int test2(void) {
 		return RLC_ERR;
 	}
 
+	if (dlog2() != RLC_OK) {
+		return RLC_ERR;
+	}
+
 	return RLC_OK;
 }
 
@@ -1712,6 +1946,10 @@ int test(void) {
 		return RLC_ERR;
 	}
 
+	if (dlog() != RLC_OK) {
+		return RLC_ERR;
+	}
+
 	return RLC_OK;
 }
 
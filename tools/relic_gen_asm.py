@@ -0,0 +1,413 @@
+#!/usr/bin/env python3
+#
+# RELIC is an Efficient LIbrary for Cryptography
+# Copyright (C) 2007-2019 RELIC Authors
+#
+# This file is part of RELIC. RELIC is legal property of its developers,
+# whose names are not listed here. Please refer to the COPYRIGHT file
+# for contact information.
+#
+# RELIC is free software; you can redistribute it and/or modify it under the
+# terms of the version 2.1 (or later) of the GNU Lesser General Public License
+# as published by the Free Software Foundation; or version 2.0 of the Apache
+# License as published by the Apache Software Foundation. See the LICENSE files
+# for more details.
+#
+# RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+# WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+# A PARTICULAR PURPOSE. See the LICENSE files for more details.
+#
+# You should have received a copy of the GNU Lesser General Public or the
+# Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+# or <https://www.apache.org/licenses/>.
+#
+"""Generates fully unrolled x86-64 prime field kernels for a precision.
+
+The output is a low-level backend (ARITH=x64-asm-gen) that replaces
+fp_muln_low, fp_sqrn_low, fp_rdcn_low and fp2_muln_low with straight-line
+assembly and takes every other function from the easy backend. The kernels
+depend only on the number of digits, the modulus and the Montgomery constant
+are read from the library context, so any prime of FP_PRIME bits works.
+Running the script twice with the same arguments produces identical files.
+
+Usage: relic_gen_asm.py --bits FP_PRIME --easy src/low/easy --out DIR
+"""
+
+import argparse
+import os
+import sys
+
+WSIZE = 64
+
+PREAMBLE = """/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2019 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or modify it under the
+ * terms of the version 2.1 (or later) of the GNU Lesser General Public License
+ * as published by the Free Software Foundation; or version 2.0 of the Apache
+ * License as published by the Apache Software Foundation. See the LICENSE files
+ * for more details.
+ *
+ * RELIC is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the LICENSE files for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public or the
+ * Apache License along with RELIC. If not, see <https://www.gnu.org/licenses/>
+ * or <https://www.apache.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * {what}
+ *
+ * Generated by tools/relic_gen_asm.py for {bits}-bit primes, do not edit.
+ *
+ * @ingroup fp
+ */
+"""
+
+# Accumulator registers of the column-wise (Comba) loops.
+ACC = ["%r8", "%r9", "%r10"]
+
+
+def mem(base, index):
+	"""Returns the operand addressing digit index from base."""
+	reg, off = base
+	disp = off + 8 * index
+	return ("%d(%s)" % (disp, reg)) if disp else ("(%s)" % reg)
+
+
+class Column:
+	"""Three-digit accumulator for product scanning."""
+
+	def __init__(self, out):
+		self.out = out
+		self.r = list(ACC)
+
+	def clear(self):
+		for r in self.r:
+			self.out.append("\txorq\t%s, %s" % (r, r))
+
+	def add_rax_rdx(self):
+		r0, r1, r2 = self.r
+		self.out.append("\taddq\t%%rax, %s" % r0)
+		self.out.append("\tadcq\t%%rdx, %s" % r1)
+		self.out.append("\tadcq\t$0, %s" % r2)
+
+	def mul(self, x, y, twice=False):
+		self.out.append("\tmovq\t%s, %%rax" % x)
+		self.out.append("\tmulq\t%s" % y)
+		self.add_rax_rdx()
+		if twice:
+			self.add_rax_rdx()
+
+	def add(self, x):
+		r0, r1, r2 = self.r
+		self.out.append("\taddq\t%s, %s" % (x, r0))
+		self.out.append("\tadcq\t$0, %s" % r1)
+		self.out.append("\tadcq\t$0, %s" % r2)
+
+	def shift(self, dst=None):
+		r0, r1, r2 = self.r
+		if dst is not None:
+			self.out.append("\tmovq\t%s, %s" % (r0, dst))
+		self.out.append("\txorq\t%s, %s" % (r0, r0))
+		self.r = [r1, r2, r0]
+
+
+def emit_muln(out, c, a, b, n):
+	"""Emits c = a * b for n-digit operands using product scanning."""
+	col = Column(out)
+	col.clear()
+	for k in range(2 * n - 1):
+		for i in range(max(0, k - n + 1), min(k, n - 1) + 1):
+			col.mul(mem(a, i), mem(b, k - i))
+		col.shift(mem(c, k))
+	out.append("\tmovq\t%s, %s" % (col.r[0], mem(c, 2 * n - 1)))
+
+
+def emit_sqrn(out, c, a, n):
+	"""Emits c = a^2, computing each cross product once and adding it twice."""
+	col = Column(out)
+	col.clear()
+	for k in range(2 * n - 1):
+		for i in range(max(0, k - n + 1), (k + 1) // 2):
+			col.mul(mem(a, i), mem(a, k - i), twice=True)
+		if k % 2 == 0:
+			col.mul(mem(a, k // 2), mem(a, k // 2))
+		col.shift(mem(c, k))
+	out.append("\tmovq\t%s, %s" % (col.r[0], mem(c, 2 * n - 1)))
+
+
+def emit_rdcn(out, c, a, p, u, q, n):
+	"""Emits Montgomery reduction c = a * R^(-1) mod p with digits of the
+	quotient spilled to q and a constant-time final subtraction."""
+	col = Column(out)
+	col.clear()
+	for i in range(n):
+		col.add(mem(a, i))
+		for j in range(i):
+			col.mul(mem(q, j), mem(p, i - j))
+		out.append("\tmovq\t%s, %%rax" % col.r[0])
+		out.append("\timulq\t%s, %%rax" % u)
+		out.append("\tmovq\t%%rax, %s" % mem(q, i))
+		out.append("\tmulq\t%s" % mem(p, 0))
+		col.add_rax_rdx()
+		col.shift()
+	for i in range(n, 2 * n):
+		col.add(mem(a, i))
+		for j in range(i - n + 1, n):
+			col.mul(mem(q, j), mem(p, i - j))
+		col.shift(mem(c, i - n))
+	top = col.r[0]
+	emit_subp(out, c, p, q, top, n)
+
+
+def emit_subp(out, c, p, t, top, n):
+	"""Emits c = c - p if (top, c) >= p, without branches. Uses t as scratch."""
+	for i in range(n):
+		out.append("\tmovq\t%s, %%rax" % mem(c, i))
+		out.append("\t%s\t%s, %%rax" % ("subq" if i == 0 else "sbbq", mem(p, i)))
+		out.append("\tmovq\t%%rax, %s" % mem(t, i))
+	# Borrow is set only if the carry digit was zero and c < p.
+	out.append("\tsbbq\t$0, %s" % top)
+	for i in range(n):
+		out.append("\tmovq\t%s, %%rax" % mem(t, i))
+		out.append("\tcmovcq\t%s, %%rax" % mem(c, i))
+		out.append("\tmovq\t%%rax, %s" % mem(c, i))
+
+
+def emit_addn(out, c, a, b, n):
+	"""Emits c = a + b for n digits, ignoring the final carry."""
+	for i in range(n):
+		out.append("\tmovq\t%s, %%rax" % mem(a, i))
+		out.append("\t%s\t%s, %%rax" % ("addq" if i == 0 else "adcq", mem(b, i)))
+		out.append("\tmovq\t%%rax, %s" % mem(c, i))
+
+
+def emit_subn(out, c, a, b, n):
+	"""Emits c = a - b for n digits, leaving the borrow in the carry flag."""
+	for i in range(n):
+		out.append("\tmovq\t%s, %%rax" % mem(a, i))
+		out.append("\t%s\t%s, %%rax" % ("subq" if i == 0 else "sbbq", mem(b, i)))
+		out.append("\tmovq\t%%rax, %s" % mem(c, i))
+
+
+def emit_fp2_muln(out, n):
+	"""Emits the Karatsuba product of two elements of F_{p^2} = F_p[i]/(i^2 + 1)
+	without reduction. Arguments: c0, c1, a0, a1, b0, b1 and p on the stack."""
+	c0, c1 = ("%rdi", 0), ("%rsi", 0)
+	a0, a1, b0, b1 = ("%r12", 0), ("%r13", 0), ("%r14", 0), ("%r15", 0)
+	p = ("%rbx", 0)
+	t0, t1, t2 = ("%rsp", 0), ("%rsp", 8 * n), ("%rsp", 16 * n)
+	saved = ["%rbx", "%r12", "%r13", "%r14", "%r15"]
+	for r in saved:
+		out.append("\tpushq\t%s" % r)
+	out.append("\tmovq\t%d(%%rsp), %%rbx" % (8 * (len(saved) + 1)))
+	out.append("\tsubq\t$%d, %%rsp" % (8 * 4 * n))
+	out.append("\tmovq\t%rdx, %r12")
+	out.append("\tmovq\t%rcx, %r13")
+	out.append("\tmovq\t%r8, %r14")
+	out.append("\tmovq\t%r9, %r15")
+	out.append("\t/* t0 = a_0 + a_1, t1 = b_0 + b_1. */")
+	emit_addn(out, t0, a0, a1, n)
+	emit_addn(out, t1, b0, b1, n)
+	out.append("\t/* c_0 = a_0 * b_0, c_1 = a_1 * b_1. */")
+	emit_muln(out, c0, a0, b0, n)
+	emit_muln(out, c1, a1, b1, n)
+	out.append("\t/* t2 = (a_0 + a_1) * (b_0 + b_1) - c_0 - c_1. */")
+	emit_muln(out, t2, t0, t1, n)
+	emit_subn(out, t2, t2, c0, 2 * n)
+	emit_subn(out, t2, t2, c1, 2 * n)
+	out.append("\t/* c_0 = c_0 - c_1, adding p * R if it underflows. */")
+	emit_subn(out, c0, c0, c1, 2 * n)
+	out.append("\tsbbq\t%r11, %r11")
+	# Mask the modulus first, since andq clobbers the carry flag.
+	for i in range(n):
+		out.append("\tmovq\t%s, %%rax" % mem(p, i))
+		out.append("\tandq\t%r11, %rax")
+		out.append("\tmovq\t%%rax, %s" % mem(t0, i))
+	for i in range(n):
+		out.append("\tmovq\t%s, %%rax" % mem(t0, i))
+		out.append("\t%s\t%%rax, %s" % ("addq" if i == 0 else "adcq", mem(c0, n + i)))
+	out.append("\t/* c_1 = t2. */")
+	for i in range(2 * n):
+		out.append("\tmovq\t%s, %%rax" % mem(t2, i))
+		out.append("\tmovq\t%%rax, %s" % mem(c1, i))
+	out.append("\taddq\t$%d, %%rsp" % (8 * 4 * n))
+	for r in reversed(saved):
+		out.append("\tpopq\t%s" % r)
+
+
+def function(name, body):
+	out = ["", ".global %s" % name, "#if !defined(__APPLE__)",
+		".type %s, @function" % name, "#endif", "%s:" % name]
+	out.extend(body)
+	out.append("\tret")
+	return out
+
+
+def asm_file(what, bits, funcs):
+	out = [PREAMBLE.format(what=what, bits=bits).rstrip("\n"), "",
+		"#include \"relic_fp_low.h\"", "", ".text"]
+	for name, body in funcs:
+		out.extend(function(name, body))
+	out.extend(["", "#if defined(__linux__) && defined(__ELF__)",
+		".section .note.GNU-stack,\"\",%progbits", "#endif", ""])
+	return "\n".join(out)
+
+
+def c_file(what, bits, easy, renamed, extra):
+	out = [PREAMBLE.format(what=what, bits=bits).rstrip("\n"), ""]
+	out.append("#include \"relic_core.h\"")
+	out.append("#include \"relic_fp_low.h\"")
+	out.append("#include \"relic_fpx_low.h\"")
+	out.append("")
+	out.append("/* Functions implemented in assembly and their callers are renamed in the easy code. */")
+	for name in renamed:
+		out.append("#undef %s" % name)
+		out.append("#define %s\t%s_easy" % (name, name[:-len("_low")]))
+	out.append("")
+	out.append("#include \"%s\"" % easy)
+	out.append("")
+	out.append("/* Restore the original names for the definitions below. */")
+	for name in renamed:
+		out.append("#undef %s" % name)
+		out.append("#ifdef LABEL")
+		out.append("#define %s\tPREFIX(%s)" % (name, name))
+		out.append("#endif")
+	out.append(extra.rstrip("\n"))
+	out.append("")
+	return "\n".join(out)
+
+
+MUL_WRAPPER = """
+void fp_mulm_low(dig_t *c, const dig_t *a, const dig_t *b) {
+	rlc_align dig_t t[2 * RLC_FP_DIGS];
+
+	fp_muln_low(t, a, b);
+	fp_rdc(c, t);
+}
+"""
+
+SQR_WRAPPER = """
+void fp_sqrm_low(dig_t *c, const dig_t *a) {
+	rlc_align dig_t t[2 * RLC_FP_DIGS];
+
+	fp_sqrn_low(t, a);
+	fp_rdc(c, t);
+}
+"""
+
+RDC_WRAPPER = """
+/**
+ * Montgomery reduction in assembly modulo m, with u = -m^(-1) mod 2^64.
+ */
+void fp_rdcn_gen(dig_t *c, dig_t *a, const dig_t *m, dig_t u);
+
+void fp_rdcn_low(dig_t *c, dig_t *a) {
+	fp_rdcn_gen(c, a, fp_prime_get(), *(fp_prime_get_rdc()));
+}
+"""
+
+FP2_WRAPPER = """
+/**
+ * Karatsuba product in assembly, valid only for F_p[i]/(i^2 + 1) and a
+ * modulus with room for one carry in the most significant digit.
+ */
+void fp2_muln_gen(dig_t *c0, dig_t *c1, const dig_t *a0, const dig_t *a1,
+		const dig_t *b0, const dig_t *b1, const dig_t *m);
+
+void fp2_muln_low(dv2_t c, fp2_t a, fp2_t b) {
+#if defined(FP_QNRES) && defined(RLC_FP_ROOM)
+	fp2_muln_gen(c[0], c[1], a[0], a[1], b[0], b[1], fp_prime_get());
+#else
+	fp2_muln_easy(c, a, b);
+#endif
+}
+
+void fp2_mulm_low(fp2_t c, fp2_t a, fp2_t b) {
+	rlc_align dv2_t t;
+
+	dv2_null(t);
+
+	TRY {
+		dv2_new(t);
+		fp2_muln_low(t, a, b);
+		fp2_rdcn_low(c, t);
+	} CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	} FINALLY {
+		dv2_free(t);
+	}
+}
+"""
+
+
+def generate(bits, easydir, outdir):
+	n = (bits + WSIZE - 1) // WSIZE
+	if n < 2 or n > 12:
+		sys.exit("Moduli of %d bits are not supported." % bits)
+
+	mul, sqr, rdc, fp2 = [], [], [], []
+	mul.append("\tmovq\t%rdx, %rcx")
+	emit_muln(mul, ("%rdi", 0), ("%rsi", 0), ("%rcx", 0), n)
+	emit_sqrn(sqr, ("%rdi", 0), ("%rsi", 0), n)
+	# The quotient digits live in the red zone below the stack pointer.
+	rdc.append("\tmovq\t%rdx, %r11")
+	emit_rdcn(rdc, ("%rdi", 0), ("%rsi", 0), ("%r11", 0), "%rcx",
+		("%rsp", -8 * n), n)
+	emit_fp2_muln(fp2, n)
+
+	def easy(name):
+		return os.path.join(easydir, name).replace(os.sep, "/")
+
+	files = {
+		"relic_fp_mul_low.s": asm_file("Unrolled prime field multiplication.",
+			bits, [("fp_muln_low", mul)]),
+		"relic_fp_sqr_low.s": asm_file("Unrolled prime field squaring.",
+			bits, [("fp_sqrn_low", sqr)]),
+		"relic_fp_rdc_low.s": asm_file("Unrolled Montgomery reduction.",
+			bits, [("fp_rdcn_gen", rdc)]),
+		"relic_fpx_mul_low.s": asm_file("Unrolled quadratic extension multiplication.",
+			bits, [("fp2_muln_gen", fp2)]),
+		"relic_fp_mul_low.c": c_file("Prime field multiplication.", bits,
+			easy("relic_fp_mul_low.c"), ["fp_muln_low", "fp_mulm_low"], MUL_WRAPPER),
+		"relic_fp_sqr_low.c": c_file("Prime field squaring.", bits,
+			easy("relic_fp_sqr_low.c"), ["fp_sqrn_low", "fp_sqrm_low"], SQR_WRAPPER),
+		"relic_fp_rdc_low.c": c_file("Prime field modular reduction.", bits,
+			easy("relic_fp_rdc_low.c"), ["fp_rdcn_low"], RDC_WRAPPER),
+		"relic_fpx_mul_low.c": c_file("Extension field multiplication.", bits,
+			easy("relic_fpx_mul_low.c"), ["fp2_muln_low", "fp2_mulm_low"],
+			FP2_WRAPPER),
+	}
+	os.makedirs(outdir, exist_ok=True)
+	for name, text in sorted(files.items()):
+		path = os.path.join(outdir, name)
+		# Keep timestamps of unchanged files to avoid needless rebuilds.
+		if os.path.exists(path):
+			with open(path) as f:
+				if f.read() == text:
+					continue
+		with open(path, "w") as f:
+			f.write(text)
+
+
+def main():
+	parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+	parser.add_argument("--bits", type=int, required=True, help="FP_PRIME")
+	parser.add_argument("--easy", required=True, help="easy backend folder")
+	parser.add_argument("--out", required=True, help="output folder")
+	args = parser.parse_args()
+	generate(args.bits, os.path.abspath(args.easy), args.out)
+
+
+if __name__ == "__main__":
+	main()
@@ -52,14 +52,14 @@ PREAMBLE
 REDEF() {
 	cat "relic_$1.h" | grep "$1_" | grep -v define | grep -v typedef | grep -v '\\' | grep '(' | grep -v '^ \*' | sed 's/const //' | sed 's/\*//' | sed -r 's/[a-z,_0-9]+ ([a-z,_,0-9]+)\(.*/\#undef \1/'
 	echo
-	cat "relic_$1.h" | grep "$1_" | grep -v define | grep -v typedef | grep -v '\\' | grep '(' | sed 's/\*//' | sed 's/const //' | sed -r 's/[a-z,_,0-9]+ ([a-z,_,0-9]+)\(.*/\#define \1 \tPREFIX\(\1\)/'
+	cat "relic_$1.h" | grep "$1_" | grep -v define | grep -v typedef | grep -v '\\' | grep '(' | grep -v '^ \*' | sed 's/\*//' | sed 's/const //' | sed -r 's/[a-z,_,0-9]+ ([a-z,_,0-9]+)\(.*/\#define \1 \tPREFIX\(\1\)/'
 	echo
 }
 
 REDEF2() {
 	cat "relic_$1.h" | grep "$2_" | grep -v define | grep -v typedef | grep -v '\\' | grep '(' | grep -v '^ \*' | sed 's/const //' | sed 's/\*//' | sed -r 's/[a-z,_0-9]+ ([a-z,_,0-9]+)\(.*/\#undef \1/'
 	echo
-	cat "relic_$1.h" | grep "$2_" | grep -v define | grep -v typedef | grep -v '\\' | grep '(' | sed 's/\*//' | sed 's/const //' | sed -r 's/[a-z,_,0-9]+ ([a-z,_,0-9]+)\(.*/\#define \1 \tPREFIX\(\1\)/'
+	cat "relic_$1.h" | grep "$2_" | grep -v define | grep -v typedef | grep -v '\\' | grep '(' | grep -v '^ \*' | sed 's/\*//' | sed 's/const //' | sed -r 's/[a-z,_,0-9]+ ([a-z,_,0-9]+)\(.*/\#define \1 \tPREFIX\(\1\)/'
 	echo
 }
 
@@ -116,6 +116,10 @@ echo
 REDEF fp
 REDEF_LOW fp
 
+echo "#undef fp_rdcn_gen"
+echo "#define fp_rdcn_gen	PREFIX(fp_rdcn_gen)"
+echo
+
 echo "#undef fp_st"
 echo "#undef fp_t"
 echo "#define fp_st	PREFIX(fp_st)"
@@ -166,6 +170,9 @@ echo "#undef fp18_t"
 echo
 REDEF2 fpx fp2
 REDEF2_LOW fpx fp2
+echo "#undef fp2_muln_gen"
+echo "#define fp2_muln_gen	PREFIX(fp2_muln_gen)"
+echo
 REDEF2 fpx fp3
 REDEF2_LOW fpx fp3
 REDEF2 fpx fp6